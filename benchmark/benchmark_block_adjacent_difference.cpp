@@ -290,7 +290,7 @@ auto run_benchmark(benchmark::State& state, hipStream_t stream, size_t N)
 
     const std::vector<T> input = benchmark_utils::get_random_data<T>(size, T(0), T(10));
     const std::vector<int> tile_sizes
-        = benchmark_utils::get_random_data<int>(num_blocks, 0, items_per_block);
+        = benchmark_utils::get_uniform_random_data<int>(num_blocks, 0, items_per_block);
     
     T* d_input;
     int* d_tile_sizes;
@@ -387,7 +387,9 @@ int main(int argc, char *argv[])
     cli::Parser parser(argc, argv);
     parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
     parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    benchmark_utils::add_data_generation_options(parser);
     parser.run_and_exit_if_error();
+    benchmark_utils::apply_data_generation_options(parser);
 
     // Parse argv
     benchmark::Initialize(&argc, argv);
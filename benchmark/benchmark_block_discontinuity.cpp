@@ -279,7 +279,9 @@ int main(int argc, char *argv[])
     cli::Parser parser(argc, argv);
     parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
     parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    benchmark_utils::add_data_generation_options(parser);
     parser.run_and_exit_if_error();
+    benchmark_utils::apply_data_generation_options(parser);
 
     // Parse argv
     benchmark::Initialize(&argc, argv);
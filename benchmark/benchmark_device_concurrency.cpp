@@ -0,0 +1,345 @@
+// MIT License
+//
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// Several host threads drive DeviceRadixSort, DeviceScan, DeviceSelect and
+// DeviceReduce on their own streams and share one CachingDeviceAllocator for
+// temporary storage. Every call is synchronized like a request in a server.
+// Reported are the aggregate throughput, per-call latency percentiles and the
+// fraction of allocator calls which found the allocator mutex already locked.
+
+#include "common_benchmark_header.hpp"
+
+// HIP API
+#include "hipcub/device/device_radix_sort.hpp"
+#include "hipcub/device/device_reduce.hpp"
+#include "hipcub/device/device_scan.hpp"
+#include "hipcub/device/device_select.hpp"
+#include "hipcub/util_allocator.hpp"
+
+#ifndef DEFAULT_N
+const size_t DEFAULT_N = 64 * 1024;
+#endif
+
+const unsigned int calls_per_thread = 64;
+
+using key_type = unsigned int;
+
+// Device buffers of one stream
+struct stream_context
+{
+    hipStream_t    stream;
+    key_type*      d_input;
+    key_type*      d_output;
+    unsigned char* d_flags;
+    unsigned int*  d_selected_count;
+};
+
+// Measurements of one host thread
+struct thread_statistics
+{
+    std::vector<double> latencies_us;
+    size_t              allocator_calls     = 0;
+    size_t              allocator_contended = 0;
+};
+
+// Temporary storage is taken from the shared allocator. Before every allocator
+// call the allocator mutex is probed to estimate how often threads contend.
+template<class Call>
+void run_with_allocator(hipcub::CachingDeviceAllocator& allocator,
+                        thread_statistics&              statistics,
+                        hipStream_t                     stream,
+                        Call                            call)
+{
+    auto probe = [&]()
+    {
+        statistics.allocator_calls++;
+        if(allocator.mutex.try_lock())
+        {
+            allocator.mutex.unlock();
+        }
+        else
+        {
+            statistics.allocator_contended++;
+        }
+    };
+
+    size_t temp_storage_bytes = 0;
+    HIP_CHECK(call(nullptr, temp_storage_bytes));
+    void* d_temp_storage = nullptr;
+    probe();
+    HIP_CHECK(allocator.DeviceAllocate(&d_temp_storage, temp_storage_bytes, stream));
+    HIP_CHECK(call(d_temp_storage, temp_storage_bytes));
+    probe();
+    HIP_CHECK(allocator.DeviceFree(d_temp_storage));
+}
+
+void run_call(hipcub::CachingDeviceAllocator& allocator,
+              thread_statistics&              statistics,
+              const stream_context&           context,
+              size_t                          size,
+              unsigned int                    call_index)
+{
+    const hipStream_t stream = context.stream;
+    switch(call_index % 4)
+    {
+        case 0:
+            run_with_allocator(allocator,
+                               statistics,
+                               stream,
+                               [&](void* d_temp_storage, size_t& bytes)
+                               {
+                                   return hipcub::DeviceRadixSort::SortKeys(d_temp_storage,
+                                                                            bytes,
+                                                                            context.d_input,
+                                                                            context.d_output,
+                                                                            size,
+                                                                            0,
+                                                                            sizeof(key_type) * 8,
+                                                                            stream);
+                               });
+            break;
+        case 1:
+            run_with_allocator(allocator,
+                               statistics,
+                               stream,
+                               [&](void* d_temp_storage, size_t& bytes)
+                               {
+                                   return hipcub::DeviceScan::InclusiveSum(d_temp_storage,
+                                                                           bytes,
+                                                                           context.d_input,
+                                                                           context.d_output,
+                                                                           size,
+                                                                           stream);
+                               });
+            break;
+        case 2:
+            run_with_allocator(allocator,
+                               statistics,
+                               stream,
+                               [&](void* d_temp_storage, size_t& bytes)
+                               {
+                                   return hipcub::DeviceSelect::Flagged(d_temp_storage,
+                                                                        bytes,
+                                                                        context.d_input,
+                                                                        context.d_flags,
+                                                                        context.d_output,
+                                                                        context.d_selected_count,
+                                                                        static_cast<int>(size),
+                                                                        stream);
+                               });
+            break;
+        default:
+            run_with_allocator(allocator,
+                               statistics,
+                               stream,
+                               [&](void* d_temp_storage, size_t& bytes)
+                               {
+                                   return hipcub::DeviceReduce::Sum(d_temp_storage,
+                                                                    bytes,
+                                                                    context.d_input,
+                                                                    context.d_output,
+                                                                    size,
+                                                                    stream);
+                               });
+            break;
+    }
+}
+
+double percentile(std::vector<double>& values, double fraction)
+{
+    if(values.empty())
+    {
+        return 0.0;
+    }
+    const size_t index = std::min(values.size() - 1, static_cast<size_t>(fraction * values.size()));
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+}
+
+void run_benchmark(benchmark::State& state,
+                   size_t            size,
+                   unsigned int      thread_count,
+                   unsigned int      stream_count)
+{
+    using clock = std::chrono::high_resolution_clock;
+
+    // Every thread needs at least one stream of its own
+    stream_count = std::max(stream_count, thread_count);
+
+    const std::vector<key_type> input
+        = benchmark_utils::get_random_data<key_type>(size, key_type(0), key_type(1000000));
+    const std::vector<unsigned char> flags = benchmark_utils::get_random_data01<unsigned char>(size, 0.5f);
+
+    std::vector<stream_context> contexts(stream_count);
+    for(auto& context : contexts)
+    {
+        HIP_CHECK(hipStreamCreateWithFlags(&context.stream, hipStreamNonBlocking));
+        HIP_CHECK(hipMalloc(&context.d_input, size * sizeof(key_type)));
+        HIP_CHECK(hipMalloc(&context.d_output, size * sizeof(key_type)));
+        HIP_CHECK(hipMalloc(&context.d_flags, size * sizeof(unsigned char)));
+        HIP_CHECK(hipMalloc(&context.d_selected_count, sizeof(unsigned int)));
+        HIP_CHECK(hipMemcpy(context.d_input,
+                            input.data(),
+                            size * sizeof(key_type),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(context.d_flags,
+                            flags.data(),
+                            size * sizeof(unsigned char),
+                            hipMemcpyHostToDevice));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipcub::CachingDeviceAllocator allocator;
+
+    int device_id = 0;
+    HIP_CHECK(hipGetDevice(&device_id));
+
+    std::vector<thread_statistics> statistics(thread_count);
+    for(auto _ : state)
+    {
+        std::vector<std::thread> threads;
+        const auto               start = clock::now();
+        for(unsigned int t = 0; t < thread_count; t++)
+        {
+            threads.emplace_back(
+                [&, t]()
+                {
+                    HIP_CHECK(hipSetDevice(device_id));
+                    for(unsigned int i = 0; i < calls_per_thread; i++)
+                    {
+                        // Thread t drives streams t, t + thread_count, ...
+                        const unsigned int streams_per_thread
+                            = (stream_count - 1 - t) / thread_count + 1;
+                        const stream_context& context
+                            = contexts[t + (i % streams_per_thread) * thread_count];
+
+                        const auto call_start = clock::now();
+                        run_call(allocator, statistics[t], context, size, t + i);
+                        HIP_CHECK(hipStreamSynchronize(context.stream));
+                        const auto call_end = clock::now();
+                        statistics[t].latencies_us.push_back(
+                            std::chrono::duration<double, std::micro>(call_end - call_start)
+                                .count());
+                    }
+                });
+        }
+        for(auto& thread : threads)
+        {
+            thread.join();
+        }
+        const auto end = clock::now();
+        state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+    }
+
+    std::vector<double> latencies;
+    size_t              allocator_calls     = 0;
+    size_t              allocator_contended = 0;
+    for(const auto& s : statistics)
+    {
+        latencies.insert(latencies.end(), s.latencies_us.begin(), s.latencies_us.end());
+        allocator_calls += s.allocator_calls;
+        allocator_contended += s.allocator_contended;
+    }
+
+    state.counters["p50_us"] = percentile(latencies, 0.50);
+    state.counters["p99_us"] = percentile(latencies, 0.99);
+    state.counters["max_us"] = percentile(latencies, 1.0);
+    state.counters["allocator_contention"]
+        = allocator_calls == 0 ? 0.0 : double(allocator_contended) / allocator_calls;
+    state.SetBytesProcessed(state.iterations() * thread_count * calls_per_thread * size
+                            * sizeof(key_type));
+    state.SetItemsProcessed(state.iterations() * thread_count * calls_per_thread * size);
+
+    HIP_CHECK(allocator.FreeAllCached());
+    for(auto& context : contexts)
+    {
+        HIP_CHECK(hipFree(context.d_input));
+        HIP_CHECK(hipFree(context.d_output));
+        HIP_CHECK(hipFree(context.d_flags));
+        HIP_CHECK(hipFree(context.d_selected_count));
+        HIP_CHECK(hipStreamDestroy(context.stream));
+    }
+}
+
+#define CREATE_BENCHMARK(THREADS, STREAMS)                                                  \
+    benchmark::RegisterBenchmark(("concurrency<Threads:" #THREADS ",Streams:" #STREAMS ">"), \
+                                 &run_benchmark,                                            \
+                                 size,                                                      \
+                                 THREADS,                                                   \
+                                 STREAMS)
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values per call");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    benchmark_utils::add_data_generation_options(parser);
+    parser.run_and_exit_if_error();
+    benchmark_utils::apply_data_generation_options(parser);
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t size   = parser.get<size_t>("size");
+    const int    trials = parser.get<int>("trials");
+
+    std::cout << "benchmark_device_concurrency" << std::endl;
+
+    // HIP
+    hipDeviceProp_t devProp;
+    int             device_id = 0;
+    HIP_CHECK(hipGetDevice(&device_id));
+    HIP_CHECK(hipGetDeviceProperties(&devProp, device_id));
+    std::cout << "[HIP] Device name: " << devProp.name << std::endl;
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks = {
+        CREATE_BENCHMARK(1, 1),
+        CREATE_BENCHMARK(1, 4),
+        CREATE_BENCHMARK(2, 2),
+        CREATE_BENCHMARK(4, 4),
+        CREATE_BENCHMARK(4, 8),
+        CREATE_BENCHMARK(8, 8),
+        CREATE_BENCHMARK(8, 16),
+    };
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+
+    return 0;
+}
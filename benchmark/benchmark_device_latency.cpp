@@ -0,0 +1,321 @@
+// MIT License
+//
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// Per-call latency of DeviceReduce, DeviceScan and DeviceSelect for the small
+// inputs where launch latency and host overhead dominate. Every iteration is a
+// single end-to-end call: temporary storage size query, the call itself and the
+// synchronization of the stream. The host time of the query and of the call and
+// the device time of the call (measured with events) are reported separately.
+
+#include "common_benchmark_header.hpp"
+
+// HIP API
+#include "hipcub/device/device_reduce.hpp"
+#include "hipcub/device/device_scan.hpp"
+#include "hipcub/device/device_select.hpp"
+
+#ifndef DEFAULT_N
+const size_t DEFAULT_N = 64 * 1024;
+#endif
+
+const unsigned int warmup_size = 10;
+
+template<class T>
+struct select_below
+{
+    T threshold;
+
+    HIPCUB_HOST_DEVICE
+    bool operator()(const T& value) const
+    {
+        return value < threshold;
+    }
+};
+
+struct reduce_sum
+{
+    static const char* name()
+    {
+        return "reduce_sum";
+    }
+
+    template<class T>
+    static hipError_t run(void*        d_temp_storage,
+                          size_t&      temp_storage_bytes,
+                          T*           d_input,
+                          T*           d_output,
+                          unsigned int* /*d_selected_count*/,
+                          size_t       size,
+                          hipStream_t  stream)
+    {
+        return hipcub::DeviceReduce::Sum(d_temp_storage,
+                                         temp_storage_bytes,
+                                         d_input,
+                                         d_output,
+                                         size,
+                                         stream);
+    }
+};
+
+struct inclusive_sum
+{
+    static const char* name()
+    {
+        return "inclusive_sum";
+    }
+
+    template<class T>
+    static hipError_t run(void*        d_temp_storage,
+                          size_t&      temp_storage_bytes,
+                          T*           d_input,
+                          T*           d_output,
+                          unsigned int* /*d_selected_count*/,
+                          size_t       size,
+                          hipStream_t  stream)
+    {
+        return hipcub::DeviceScan::InclusiveSum(d_temp_storage,
+                                                temp_storage_bytes,
+                                                d_input,
+                                                d_output,
+                                                size,
+                                                stream);
+    }
+};
+
+struct select_if
+{
+    static const char* name()
+    {
+        return "select_if";
+    }
+
+    template<class T>
+    static hipError_t run(void*        d_temp_storage,
+                          size_t&      temp_storage_bytes,
+                          T*           d_input,
+                          T*           d_output,
+                          unsigned int* d_selected_count,
+                          size_t       size,
+                          hipStream_t  stream)
+    {
+        return hipcub::DeviceSelect::If(d_temp_storage,
+                                        temp_storage_bytes,
+                                        d_input,
+                                        d_output,
+                                        d_selected_count,
+                                        static_cast<int>(size),
+                                        select_below<T>{T(500)},
+                                        stream);
+    }
+};
+
+template<class T, class Algorithm>
+void run_benchmark(benchmark::State& state, size_t size, const hipStream_t stream)
+{
+    using clock = std::chrono::high_resolution_clock;
+    using us    = std::chrono::duration<double, std::micro>;
+
+    std::vector<T> input = benchmark_utils::get_random_data<T>(size, T(0), T(1000));
+
+    T*            d_input;
+    T*            d_output;
+    unsigned int* d_selected_count;
+    HIP_CHECK(hipMalloc(&d_input, size * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_output, size * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_selected_count, sizeof(unsigned int)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+    // Temporary storage is allocated once up front, as a caching allocator would,
+    // so that hipMalloc does not show up in the per-call latency.
+    size_t temp_storage_size_bytes = 0;
+    void*  d_temp_storage          = nullptr;
+    HIP_CHECK(Algorithm::run(d_temp_storage,
+                             temp_storage_size_bytes,
+                             d_input,
+                             d_output,
+                             d_selected_count,
+                             size,
+                             stream));
+    HIP_CHECK(hipMalloc(&d_temp_storage, temp_storage_size_bytes));
+
+    hipEvent_t start_event;
+    hipEvent_t stop_event;
+    HIP_CHECK(hipEventCreate(&start_event));
+    HIP_CHECK(hipEventCreate(&stop_event));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(size_t i = 0; i < warmup_size; i++)
+    {
+        HIP_CHECK(Algorithm::run(d_temp_storage,
+                                 temp_storage_size_bytes,
+                                 d_input,
+                                 d_output,
+                                 d_selected_count,
+                                 size,
+                                 stream));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double query_us  = 0.0;
+    double launch_us = 0.0;
+    double sync_us   = 0.0;
+    double device_us = 0.0;
+    for(auto _ : state)
+    {
+        const auto start = clock::now();
+
+        size_t query_bytes = 0;
+        HIP_CHECK(Algorithm::run(static_cast<void*>(nullptr),
+                                 query_bytes,
+                                 d_input,
+                                 d_output,
+                                 d_selected_count,
+                                 size,
+                                 stream));
+        const auto queried = clock::now();
+
+        HIP_CHECK(hipEventRecord(start_event, stream));
+        HIP_CHECK(Algorithm::run(d_temp_storage,
+                                 query_bytes,
+                                 d_input,
+                                 d_output,
+                                 d_selected_count,
+                                 size,
+                                 stream));
+        HIP_CHECK(hipEventRecord(stop_event, stream));
+        const auto launched = clock::now();
+
+        HIP_CHECK(hipStreamSynchronize(stream));
+        const auto end = clock::now();
+
+        float device_ms = 0.0f;
+        HIP_CHECK(hipEventElapsedTime(&device_ms, start_event, stop_event));
+
+        query_us += us(queried - start).count();
+        launch_us += us(launched - queried).count();
+        sync_us += us(end - launched).count();
+        device_us += device_ms * 1000.0;
+
+        state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+    }
+
+    // Averages per call, in microseconds
+    state.counters["query_us"]  = benchmark::Counter(query_us, benchmark::Counter::kAvgIterations);
+    state.counters["launch_us"] = benchmark::Counter(launch_us, benchmark::Counter::kAvgIterations);
+    state.counters["sync_us"]   = benchmark::Counter(sync_us, benchmark::Counter::kAvgIterations);
+    state.counters["device_us"] = benchmark::Counter(device_us, benchmark::Counter::kAvgIterations);
+    state.counters["host_us"]
+        = benchmark::Counter(query_us + launch_us, benchmark::Counter::kAvgIterations);
+    state.SetBytesProcessed(state.iterations() * size * sizeof(T));
+    state.SetItemsProcessed(state.iterations() * size);
+
+    HIP_CHECK(hipEventDestroy(start_event));
+    HIP_CHECK(hipEventDestroy(stop_event));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_selected_count));
+    HIP_CHECK(hipFree(d_temp_storage));
+}
+
+template<class T, class Algorithm>
+void add_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                    const std::vector<size_t>&                    sizes,
+                    const std::string&                            type_name,
+                    const hipStream_t                             stream)
+{
+    for(const size_t size : sizes)
+    {
+        const std::string name = std::string("latency<") + Algorithm::name()
+                                 + ",Datatype:" + type_name + ",Size:" + std::to_string(size)
+                                 + ">";
+        benchmarks.push_back(
+            benchmark::RegisterBenchmark(name.c_str(), &run_benchmark<T, Algorithm>, size, stream));
+    }
+}
+
+#define CREATE_BENCHMARKS(T)                                                        \
+    add_benchmarks<T, reduce_sum>(benchmarks, sizes, #T, stream);                   \
+    add_benchmarks<T, inclusive_sum>(benchmarks, sizes, #T, stream);                \
+    add_benchmarks<T, select_if>(benchmarks, sizes, #T, stream)
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_N, "largest number of values");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    benchmark_utils::add_data_generation_options(parser);
+    parser.run_and_exit_if_error();
+    benchmark_utils::apply_data_generation_options(parser);
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t size   = parser.get<size_t>("size");
+    const int    trials = parser.get<int>("trials");
+
+    std::cout << "benchmark_device_latency" << std::endl;
+
+    // HIP
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+    hipDeviceProp_t devProp;
+    int             device_id = 0;
+    HIP_CHECK(hipGetDevice(&device_id));
+    HIP_CHECK(hipGetDeviceProperties(&devProp, device_id));
+    std::cout << "[HIP] Device name: " << devProp.name << std::endl;
+
+    // Sizes: 1K, 4K, 16K, ... up to and including size
+    std::vector<size_t> sizes;
+    for(size_t s = 1024; s < size; s *= 4)
+    {
+        sizes.push_back(s);
+    }
+    sizes.push_back(size);
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks;
+    CREATE_BENCHMARKS(int);
+    CREATE_BENCHMARKS(float);
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMicrosecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+
+    HIP_CHECK(hipStreamDestroy(stream));
+
+    return 0;
+}
@@ -43,7 +43,8 @@ void run_benchmark(benchmark::State& state,
                    const hipStream_t stream,
                    ReduceKernel reduce)
 {
-    std::vector<T> input = benchmark_utils::get_random_data<T>(size, T(0), T(1000));
+    const benchmark_utils::host_buffer<T> input
+        = benchmark_utils::get_random_host_buffer<T>(size, T(0), T(1000));
 
     T * d_input;
     OutputT * d_output;
@@ -161,7 +162,9 @@ int main(int argc, char *argv[])
     cli::Parser parser(argc, argv);
     parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
     parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    benchmark_utils::add_data_generation_options(parser);
     parser.run_and_exit_if_error();
+    benchmark_utils::apply_data_generation_options(parser);
 
     // Parse argv
     benchmark::Initialize(&argc, argv);
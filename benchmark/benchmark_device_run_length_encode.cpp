@@ -46,7 +46,7 @@ void run_encode_benchmark(benchmark::State& state, size_t max_length, hipStream_
     std::vector<key_type> input(size);
 
     unsigned int runs_count = 0;
-    std::vector<size_t> key_counts = benchmark_utils::get_random_data<size_t>(100000, 1, max_length);
+    std::vector<size_t> key_counts = benchmark_utils::get_uniform_random_data<size_t>(100000, 1, max_length);
     size_t offset = 0;
     while(offset < size)
     {
@@ -151,7 +151,7 @@ void run_non_trivial_runs_benchmark(benchmark::State& state, size_t max_length,
     std::vector<key_type> input(size);
 
     unsigned int runs_count = 0;
-    std::vector<size_t> key_counts = benchmark_utils::get_random_data<size_t>(100000, 1, max_length);
+    std::vector<size_t> key_counts = benchmark_utils::get_uniform_random_data<size_t>(100000, 1, max_length);
     size_t offset = 0;
     while(offset < size)
     {
@@ -312,7 +312,9 @@ int main(int argc, char *argv[])
     cli::Parser parser(argc, argv);
     parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
     parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    benchmark_utils::add_data_generation_options(parser);
     parser.run_and_exit_if_error();
+    benchmark_utils::apply_data_generation_options(parser);
 
     // Parse argv
     benchmark::Initialize(&argc, argv);
@@ -47,8 +47,8 @@ void run_benchmark(benchmark::State& state,
         static_cast<size_t>(INT_MAX), static_cast<size_t>(probability * static_cast<float>(size * size))));
     std::vector<std::pair<int, int>> indices(num_nonzeroes_attempt);
     {
-        std::vector<int> flat_indices = benchmark_utils::get_random_data<int>(
-            2 * num_nonzeroes_attempt, 0, size - 1, 2 * num_nonzeroes_attempt);
+        std::vector<int> flat_indices = benchmark_utils::get_uniform_random_data<int>(
+            2 * num_nonzeroes_attempt, 0, size - 1);
         for(size_t i = 0; i < num_nonzeroes_attempt; i++)
         {
             indices[i] = std::make_pair(flat_indices[2 * i], flat_indices[2 * i + 1]);
@@ -187,7 +187,9 @@ int main(int argc, char *argv[])
     cli::Parser parser(argc, argv);
     parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
     parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    benchmark_utils::add_data_generation_options(parser);
     parser.run_and_exit_if_error();
+    benchmark_utils::apply_data_generation_options(parser);
 
     // Parse argv
     benchmark::Initialize(&argc, argv);
@@ -0,0 +1,434 @@
+// MIT License
+//
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Sweeps rocPRIM configurations of DeviceReduce, DeviceScan and DeviceRadixSort
+// for several size buckets and writes the fastest configuration of every
+// (algorithm, type, size bucket) as a header of type aliases which can be used
+// directly with hipcub::DeviceReduceWithConfig, hipcub::DeviceScanWithConfig and
+// hipcub::DeviceRadixSortWithConfig.
+
+#include "common_benchmark_header.hpp"
+
+// HIP API
+#include "hipcub/device/device_radix_sort.hpp"
+#include "hipcub/device/device_reduce.hpp"
+#include "hipcub/device/device_scan.hpp"
+
+#include <fstream>
+#include <map>
+
+#ifndef DEFAULT_N
+const size_t DEFAULT_N = 1 << 26;
+#endif
+
+const unsigned int batch_size  = 10;
+const unsigned int warmup_size = 5;
+
+// Best configuration found so far for one (algorithm, type, size bucket).
+struct tuning_result
+{
+    std::string alias_name;
+    std::string wrapper_name;
+    std::string config_name;
+    double      time = std::numeric_limits<double>::max();
+};
+
+// Benchmark name -> (result key, config name) of every registered candidate.
+struct tuning_candidate
+{
+    std::string result_key;
+    std::string alias_name;
+    std::string wrapper_name;
+    std::string config_name;
+};
+
+std::map<std::string, tuning_candidate>& get_candidates()
+{
+    static std::map<std::string, tuning_candidate> candidates;
+    return candidates;
+}
+
+std::map<std::string, tuning_result>& get_results()
+{
+    static std::map<std::string, tuning_result> results;
+    return results;
+}
+
+// Console reporter that additionally keeps the fastest candidate of every group.
+class tuning_reporter : public benchmark::ConsoleReporter
+{
+public:
+    void ReportRuns(const std::vector<Run>& reports) override
+    {
+        for(const auto& run : reports)
+        {
+            if(run.error_occurred || run.run_type != Run::RT_Iteration)
+            {
+                continue;
+            }
+            // Strip suffixes like "/manual_time" and "/iterations:N"
+            std::string name = run.benchmark_name();
+            name             = name.substr(0, name.find('/'));
+
+            const auto candidate = get_candidates().find(name);
+            if(candidate == get_candidates().end())
+            {
+                continue;
+            }
+            tuning_result& result = get_results()[candidate->second.result_key];
+            const double   time   = run.GetAdjustedRealTime();
+            if(time < result.time)
+            {
+                result.alias_name   = candidate->second.alias_name;
+                result.wrapper_name = candidate->second.wrapper_name;
+                result.config_name  = candidate->second.config_name;
+                result.time         = time;
+            }
+        }
+        benchmark::ConsoleReporter::ReportRuns(reports);
+    }
+};
+
+template<class T>
+struct type_name;
+
+template<>
+struct type_name<int>
+{
+    static std::string name() { return "int"; }
+};
+
+template<>
+struct type_name<unsigned int>
+{
+    static std::string name() { return "unsigned_int"; }
+};
+
+template<>
+struct type_name<float>
+{
+    static std::string name() { return "float"; }
+};
+
+template<>
+struct type_name<double>
+{
+    static std::string name() { return "double"; }
+};
+
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+struct reduce_candidate
+{
+    using config = ::rocprim::reduce_config<BlockSize,
+                                            ItemsPerThread,
+                                            ::rocprim::block_reduce_algorithm::using_warp_reduce>;
+
+    static std::string algorithm() { return "reduce"; }
+    static std::string wrapper() { return "hipcub::DeviceReduceWithConfig"; }
+    static std::string name()
+    {
+        return "rocprim::reduce_config<" + std::to_string(BlockSize) + ", "
+               + std::to_string(ItemsPerThread)
+               + ", rocprim::block_reduce_algorithm::using_warp_reduce>";
+    }
+
+    template<class T>
+    static hipError_t run(void*        d_temp_storage,
+                          size_t&      temp_storage_bytes,
+                          T*           d_input,
+                          T*           d_output,
+                          size_t       size,
+                          hipStream_t  stream)
+    {
+        return hipcub::DeviceReduceWithConfig<config>::Sum(d_temp_storage,
+                                                           temp_storage_bytes,
+                                                           d_input,
+                                                           d_output,
+                                                           size,
+                                                           stream);
+    }
+};
+
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+struct scan_candidate
+{
+    using config = ::rocprim::scan_config<BlockSize,
+                                          ItemsPerThread,
+                                          true,
+                                          ::rocprim::block_load_method::block_load_transpose,
+                                          ::rocprim::block_store_method::block_store_transpose,
+                                          ::rocprim::block_scan_algorithm::using_warp_scan>;
+
+    static std::string algorithm() { return "scan"; }
+    static std::string wrapper() { return "hipcub::DeviceScanWithConfig"; }
+    static std::string name()
+    {
+        return "rocprim::scan_config<" + std::to_string(BlockSize) + ", "
+               + std::to_string(ItemsPerThread)
+               + ", true, rocprim::block_load_method::block_load_transpose"
+                 ", rocprim::block_store_method::block_store_transpose"
+                 ", rocprim::block_scan_algorithm::using_warp_scan>";
+    }
+
+    template<class T>
+    static hipError_t run(void*        d_temp_storage,
+                          size_t&      temp_storage_bytes,
+                          T*           d_input,
+                          T*           d_output,
+                          size_t       size,
+                          hipStream_t  stream)
+    {
+        return hipcub::DeviceScanWithConfig<config>::InclusiveSum(d_temp_storage,
+                                                                  temp_storage_bytes,
+                                                                  d_input,
+                                                                  d_output,
+                                                                  size,
+                                                                  stream);
+    }
+};
+
+template<unsigned int BlockSize, unsigned int ItemsPerThread, unsigned int RadixBits>
+struct radix_sort_candidate
+{
+    using config = ::rocprim::radix_sort_config_v2<
+        ::rocprim::default_config,
+        ::rocprim::default_config,
+        ::rocprim::radix_sort_onesweep_config<::rocprim::kernel_config<256, 12>,
+                                              ::rocprim::kernel_config<BlockSize, ItemsPerThread>,
+                                              RadixBits>>;
+
+    static std::string algorithm() { return "radix_sort"; }
+    static std::string wrapper() { return "hipcub::DeviceRadixSortWithConfig"; }
+    static std::string name()
+    {
+        return "rocprim::radix_sort_config_v2<rocprim::default_config, rocprim::default_config"
+               ", rocprim::radix_sort_onesweep_config<rocprim::kernel_config<256, 12>"
+               ", rocprim::kernel_config<"
+               + std::to_string(BlockSize) + ", " + std::to_string(ItemsPerThread) + ">, "
+               + std::to_string(RadixBits) + ">>";
+    }
+
+    template<class T>
+    static hipError_t run(void*        d_temp_storage,
+                          size_t&      temp_storage_bytes,
+                          T*           d_input,
+                          T*           d_output,
+                          size_t       size,
+                          hipStream_t  stream)
+    {
+        return hipcub::DeviceRadixSortWithConfig<config>::SortKeys(d_temp_storage,
+                                                                   temp_storage_bytes,
+                                                                   d_input,
+                                                                   d_output,
+                                                                   size,
+                                                                   0,
+                                                                   sizeof(T) * 8,
+                                                                   stream);
+    }
+};
+
+template<class T, class Candidate>
+void run_benchmark(benchmark::State& state, size_t size, const hipStream_t stream)
+{
+    std::vector<T> input = benchmark_utils::get_random_data<T>(size, T(0), T(1000));
+
+    T* d_input;
+    T* d_output;
+    HIP_CHECK(hipMalloc(&d_input, size * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_output, size * sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Allocate temporary storage memory
+    size_t temp_storage_size_bytes = 0;
+    void*  d_temp_storage          = nullptr;
+    HIP_CHECK(Candidate::run(d_temp_storage, temp_storage_size_bytes, d_input, d_output, size, stream));
+    HIP_CHECK(hipMalloc(&d_temp_storage, temp_storage_size_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(size_t i = 0; i < warmup_size; i++)
+    {
+        HIP_CHECK(Candidate::run(d_temp_storage,
+                                 temp_storage_size_bytes,
+                                 d_input,
+                                 d_output,
+                                 size,
+                                 stream));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; i++)
+        {
+            HIP_CHECK(Candidate::run(d_temp_storage,
+                                     temp_storage_size_bytes,
+                                     d_input,
+                                     d_output,
+                                     size,
+                                     stream));
+        }
+        HIP_CHECK(hipStreamSynchronize(stream));
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_temp_storage));
+}
+
+template<class T, class Candidate>
+void add_candidate(std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                   const std::vector<size_t>&                    sizes,
+                   const hipStream_t                             stream)
+{
+    for(const size_t size : sizes)
+    {
+        const std::string group = Candidate::algorithm() + "_" + type_name<T>::name() + "_"
+                                  + std::to_string(size);
+        const std::string name = "tune<" + group + "," + Candidate::name() + ">";
+
+        get_candidates()[name]
+            = {group, group, Candidate::wrapper(), Candidate::name()};
+        benchmarks.push_back(
+            benchmark::RegisterBenchmark(name.c_str(), &run_benchmark<T, Candidate>, size, stream));
+    }
+}
+
+#define CREATE_REDUCE_CANDIDATES(T)                                                   \
+    add_candidate<T, reduce_candidate<128, 8>>(benchmarks, sizes, stream);            \
+    add_candidate<T, reduce_candidate<256, 8>>(benchmarks, sizes, stream);            \
+    add_candidate<T, reduce_candidate<256, 16>>(benchmarks, sizes, stream);           \
+    add_candidate<T, reduce_candidate<512, 8>>(benchmarks, sizes, stream);            \
+    add_candidate<T, reduce_candidate<1024, 4>>(benchmarks, sizes, stream)
+
+#define CREATE_SCAN_CANDIDATES(T)                                                     \
+    add_candidate<T, scan_candidate<128, 16>>(benchmarks, sizes, stream);             \
+    add_candidate<T, scan_candidate<256, 8>>(benchmarks, sizes, stream);              \
+    add_candidate<T, scan_candidate<256, 16>>(benchmarks, sizes, stream);             \
+    add_candidate<T, scan_candidate<512, 8>>(benchmarks, sizes, stream)
+
+#define CREATE_RADIX_SORT_CANDIDATES(T)                                               \
+    add_candidate<T, radix_sort_candidate<256, 12, 4>>(benchmarks, sizes, stream);    \
+    add_candidate<T, radix_sort_candidate<256, 12, 8>>(benchmarks, sizes, stream);    \
+    add_candidate<T, radix_sort_candidate<512, 8, 8>>(benchmarks, sizes, stream);     \
+    add_candidate<T, radix_sort_candidate<512, 16, 8>>(benchmarks, sizes, stream);    \
+    add_candidate<T, radix_sort_candidate<1024, 8, 8>>(benchmarks, sizes, stream)
+
+void write_tuned_config(const std::string& path, const std::string& device_name)
+{
+    std::ofstream output(path);
+    output << "// Generated by benchmark_device_tuning for " << device_name << ".\n"
+           << "// Every alias is the fastest configuration found for inputs of at most\n"
+           << "// the size in its name.\n\n"
+           << "#pragma once\n\n"
+           << "#include <hipcub/hipcub.hpp>\n\n"
+           << "namespace hipcub_tuned\n{\n\n";
+    for(const auto& result : get_results())
+    {
+        output << "using " << result.second.alias_name << " = " << result.second.wrapper_name
+               << "<\n    " << result.second.config_name << ">;\n\n";
+    }
+    output << "} // namespace hipcub_tuned\n";
+    std::cout << "[Tuning] Wrote " << get_results().size() << " configurations to " << path
+              << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_N, "largest size bucket");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.set_optional<std::string>("output",
+                                     "output",
+                                     "hipcub_tuned_config.hpp",
+                                     "file the tuned configurations are written to");
+    benchmark_utils::add_data_generation_options(parser);
+    parser.run_and_exit_if_error();
+    benchmark_utils::apply_data_generation_options(parser);
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t      size   = parser.get<size_t>("size");
+    const int         trials = parser.get<int>("trials");
+    const std::string output = parser.get<std::string>("output");
+
+    std::cout << "benchmark_device_tuning" << std::endl;
+
+    // HIP
+    hipStream_t     stream = 0; // default
+    hipDeviceProp_t devProp;
+    int             device_id = 0;
+    HIP_CHECK(hipGetDevice(&device_id));
+    HIP_CHECK(hipGetDeviceProperties(&devProp, device_id));
+    std::cout << "[HIP] Device name: " << devProp.name << std::endl;
+
+    // Size buckets: 2^10, 2^14, ... up to and including size
+    std::vector<size_t> sizes;
+    for(size_t bucket = size_t(1) << 10; bucket < size; bucket <<= 4)
+    {
+        sizes.push_back(bucket);
+    }
+    sizes.push_back(size);
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks;
+    CREATE_REDUCE_CANDIDATES(int);
+    CREATE_REDUCE_CANDIDATES(float);
+    CREATE_REDUCE_CANDIDATES(double);
+    CREATE_SCAN_CANDIDATES(int);
+    CREATE_SCAN_CANDIDATES(float);
+    CREATE_RADIX_SORT_CANDIDATES(unsigned int);
+    CREATE_RADIX_SORT_CANDIDATES(float);
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    tuning_reporter reporter;
+    benchmark::RunSpecifiedBenchmarks(&reporter);
+
+    write_tuned_config(output, devProp.name);
+
+    return 0;
+}
@@ -0,0 +1,227 @@
+// MIT License
+//
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// Host-side cost of the Device* entry points. Only the temporary storage size
+// query (d_temp_storage == nullptr), the config dispatch and the argument
+// marshalling are measured, so no kernel is launched and no device memory is
+// touched. Regressions in these paths are visible as plain CPU time.
+
+#include "common_benchmark_header.hpp"
+
+// HIP API
+#include "hipcub/device/device_radix_sort.hpp"
+#include "hipcub/device/device_reduce.hpp"
+#include "hipcub/device/device_scan.hpp"
+#include "hipcub/device/device_segmented_reduce.hpp"
+#include "hipcub/device/device_select.hpp"
+
+#ifndef DEFAULT_N
+const size_t DEFAULT_N = 1024 * 1024;
+#endif
+
+template<class T, class QueryOp>
+void run_query_benchmark(benchmark::State& state, size_t size, QueryOp query)
+{
+    // The size query never dereferences its arguments
+    T* d_input  = nullptr;
+    T* d_output = nullptr;
+
+    for(auto _ : state)
+    {
+        size_t temp_storage_bytes = 0;
+        HIP_CHECK(query(temp_storage_bytes, d_input, d_output, size));
+        benchmark::DoNotOptimize(temp_storage_bytes);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<class T>
+void reduce_sum(benchmark::State& state, size_t size)
+{
+    run_query_benchmark<T>(state,
+                           size,
+                           [](size_t& bytes, T* d_input, T* d_output, size_t n)
+                           {
+                               return hipcub::DeviceReduce::Sum(nullptr,
+                                                                bytes,
+                                                                d_input,
+                                                                d_output,
+                                                                n);
+                           });
+}
+
+template<class T>
+void exclusive_sum(benchmark::State& state, size_t size)
+{
+    run_query_benchmark<T>(state,
+                           size,
+                           [](size_t& bytes, T* d_input, T* d_output, size_t n)
+                           {
+                               return hipcub::DeviceScan::ExclusiveSum(nullptr,
+                                                                       bytes,
+                                                                       d_input,
+                                                                       d_output,
+                                                                       n);
+                           });
+}
+
+template<class T>
+void select_flagged(benchmark::State& state, size_t size)
+{
+    run_query_benchmark<T>(state,
+                           size,
+                           [](size_t& bytes, T* d_input, T* d_output, size_t n)
+                           {
+                               unsigned char* d_flags          = nullptr;
+                               unsigned int*  d_selected_count = nullptr;
+                               return hipcub::DeviceSelect::Flagged(nullptr,
+                                                                    bytes,
+                                                                    d_input,
+                                                                    d_flags,
+                                                                    d_output,
+                                                                    d_selected_count,
+                                                                    static_cast<int>(n));
+                           });
+}
+
+template<class T>
+void radix_sort_keys(benchmark::State& state, size_t size)
+{
+    run_query_benchmark<T>(state,
+                           size,
+                           [](size_t& bytes, T* d_input, T* d_output, size_t n)
+                           {
+                               return hipcub::DeviceRadixSort::SortKeys(nullptr,
+                                                                        bytes,
+                                                                        d_input,
+                                                                        d_output,
+                                                                        n);
+                           });
+}
+
+template<class T>
+void radix_sort_keys_double_buffer(benchmark::State& state, size_t size)
+{
+    run_query_benchmark<T>(state,
+                           size,
+                           [](size_t& bytes, T* d_input, T* d_output, size_t n)
+                           {
+                               hipcub::DoubleBuffer<T> d_keys(d_input, d_output);
+                               return hipcub::DeviceRadixSort::SortKeys(nullptr,
+                                                                        bytes,
+                                                                        d_keys,
+                                                                        n);
+                           });
+}
+
+template<class T>
+void segmented_arg_min(benchmark::State& state, size_t size)
+{
+    using key_value = hipcub::KeyValuePair<int, T>;
+    run_query_benchmark<T>(state,
+                           size,
+                           [](size_t& bytes, T* d_input, T* /*d_output*/, size_t n)
+                           {
+                               key_value* d_output  = nullptr;
+                               int*       d_offsets = nullptr;
+                               return hipcub::DeviceSegmentedReduce::ArgMin(nullptr,
+                                                                            bytes,
+                                                                            d_input,
+                                                                            d_output,
+                                                                            static_cast<int>(n),
+                                                                            d_offsets,
+                                                                            d_offsets + 1);
+                           });
+}
+
+#ifdef HIPCUB_ROCPRIM_API
+template<class T>
+void double_buffer_marshalling(benchmark::State& state, size_t /*size*/)
+{
+    T current   = T(0);
+    T alternate = T(1);
+
+    hipcub::DoubleBuffer<T> d_keys(&current, &alternate);
+    for(auto _ : state)
+    {
+        ::rocprim::double_buffer<T> d_keys_db = hipcub::detail::to_double_buffer(d_keys);
+        benchmark::DoNotOptimize(d_keys_db);
+        d_keys_db.swap();
+        hipcub::detail::update_double_buffer(d_keys, d_keys_db);
+        benchmark::DoNotOptimize(d_keys.selector);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+#endif
+
+#define CREATE_BENCHMARK(FUNCTION, T)                                                    \
+    benchmark::RegisterBenchmark(("host_overhead<" #FUNCTION ",Datatype:" #T ">"),     \
+                                 &FUNCTION<T>,                                           \
+                                 size)
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t size   = parser.get<size_t>("size");
+    const int    trials = parser.get<int>("trials");
+
+    std::cout << "benchmark_host_overhead" << std::endl;
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks = {
+        CREATE_BENCHMARK(reduce_sum, int),
+        CREATE_BENCHMARK(exclusive_sum, int),
+        CREATE_BENCHMARK(select_flagged, int),
+        CREATE_BENCHMARK(radix_sort_keys, int),
+        CREATE_BENCHMARK(radix_sort_keys_double_buffer, int),
+        CREATE_BENCHMARK(segmented_arg_min, float),
+#ifdef HIPCUB_ROCPRIM_API
+        CREATE_BENCHMARK(double_buffer_marshalling, int),
+#endif
+    };
+
+    for(auto& b : benchmarks)
+    {
+        b->Unit(benchmark::kNanosecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+
+    return 0;
+}
@@ -0,0 +1,201 @@
+// MIT License
+//
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Startup cost of hipCUB in a process: initialization of the HIP runtime (which
+// registers the code objects of the binary, and loads them unless loading is deferred)
+// and the first and second call of several algorithms. The first call includes
+// loading the code object of its kernels when HIP_ENABLE_DEFERRED_LOADING is set.
+// Every measurement can only be made once per process, so the results are printed as
+// one JSON object and scripts/startup-time/measure-startup-time.py runs the binary
+// repeatedly with different loading settings.
+
+#include "common_benchmark_header.hpp"
+
+// HIP API
+#include "hipcub/device/device_radix_sort.hpp"
+#include "hipcub/device/device_reduce.hpp"
+#include "hipcub/device/device_scan.hpp"
+#include "hipcub/device/device_select.hpp"
+
+#include <chrono>
+#include <cstdlib>
+
+#ifndef DEFAULT_N
+const size_t DEFAULT_N = 1024 * 1024;
+#endif
+
+namespace
+{
+
+using clock_type = std::chrono::steady_clock;
+
+double milliseconds_since(clock_type::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(clock_type::now() - start).count();
+}
+
+// Runs the size query, allocation, call and synchronization of one algorithm
+template<class Call>
+double time_call(Call call, hipStream_t stream)
+{
+    const auto start              = clock_type::now();
+    size_t     temp_storage_bytes = 0;
+    HIP_CHECK(call(nullptr, temp_storage_bytes));
+    void* d_temp_storage = nullptr;
+    HIP_CHECK(hipMalloc(&d_temp_storage, temp_storage_bytes));
+    HIP_CHECK(call(d_temp_storage, temp_storage_bytes));
+    HIP_CHECK(hipStreamSynchronize(stream));
+    HIP_CHECK(hipFree(d_temp_storage));
+    return milliseconds_since(start);
+}
+
+template<class Call>
+void report_call(const char* name, Call call, hipStream_t stream, bool last)
+{
+    const double first  = time_call(call, stream);
+    const double second = time_call(call, stream);
+    std::cout << "    \"" << name << "\": {\"first_ms\": " << first
+              << ", \"second_ms\": " << second << "}" << (last ? "\n" : ",\n");
+}
+
+struct is_odd
+{
+    HIPCUB_HOST_DEVICE
+    bool operator()(const int& value) const
+    {
+        return (value & 1) != 0;
+    }
+};
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const auto process_start = clock_type::now();
+
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
+    benchmark_utils::add_data_generation_options(parser);
+    parser.run_and_exit_if_error();
+    benchmark_utils::apply_data_generation_options(parser);
+
+    const size_t size = parser.get<size_t>("size");
+
+    // The first HIP call initializes the runtime
+    const auto init_start = clock_type::now();
+    int        device_count;
+    HIP_CHECK(hipGetDeviceCount(&device_count));
+    HIP_CHECK(hipFree(nullptr));
+    const double init_ms = milliseconds_since(init_start);
+
+    hipStream_t stream = 0;
+    int         device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    hipDeviceProp_t devProp;
+    HIP_CHECK(hipGetDeviceProperties(&devProp, device_id));
+
+    std::vector<int> input = benchmark_utils::get_random_data<int>(size, 0, 1 << 20);
+    int*             d_input;
+    int*             d_output;
+    unsigned int*    d_selected_count;
+    HIP_CHECK(hipMalloc(&d_input, size * sizeof(int)));
+    HIP_CHECK(hipMalloc(&d_output, size * sizeof(int)));
+    HIP_CHECK(hipMalloc(&d_selected_count, sizeof(unsigned int)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(int), hipMemcpyHostToDevice));
+
+    const char* deferred_loading = std::getenv("HIP_ENABLE_DEFERRED_LOADING");
+
+    std::cout << "{\n"
+              << "  \"device\": \"" << devProp.gcnArchName << "\",\n"
+              << "  \"deferred_loading\": \""
+              << (deferred_loading != nullptr ? deferred_loading : "") << "\",\n"
+              << "  \"size\": " << size << ",\n"
+              << "  \"runtime_init_ms\": " << init_ms << ",\n"
+              << "  \"calls\": {\n";
+
+    report_call(
+        "DeviceReduce::Sum",
+        [&](void* d_temp_storage, size_t& temp_storage_bytes)
+        {
+            return hipcub::DeviceReduce::Sum(d_temp_storage,
+                                             temp_storage_bytes,
+                                             d_input,
+                                             d_output,
+                                             size,
+                                             stream);
+        },
+        stream,
+        false);
+    report_call(
+        "DeviceScan::InclusiveSum",
+        [&](void* d_temp_storage, size_t& temp_storage_bytes)
+        {
+            return hipcub::DeviceScan::InclusiveSum(d_temp_storage,
+                                                    temp_storage_bytes,
+                                                    d_input,
+                                                    d_output,
+                                                    size,
+                                                    stream);
+        },
+        stream,
+        false);
+    report_call(
+        "DeviceSelect::If",
+        [&](void* d_temp_storage, size_t& temp_storage_bytes)
+        {
+            return hipcub::DeviceSelect::If(d_temp_storage,
+                                            temp_storage_bytes,
+                                            d_input,
+                                            d_output,
+                                            d_selected_count,
+                                            size,
+                                            is_odd(),
+                                            stream);
+        },
+        stream,
+        false);
+    report_call(
+        "DeviceRadixSort::SortKeys",
+        [&](void* d_temp_storage, size_t& temp_storage_bytes)
+        {
+            return hipcub::DeviceRadixSort::SortKeys(d_temp_storage,
+                                                     temp_storage_bytes,
+                                                     d_input,
+                                                     d_output,
+                                                     size,
+                                                     0,
+                                                     sizeof(int) * 8,
+                                                     stream);
+        },
+        stream,
+        true);
+
+    std::cout << "  },\n"
+              << "  \"main_ms\": " << milliseconds_since(process_start) << "\n"
+              << "}" << std::endl;
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_selected_count));
+
+    return 0;
+}
@@ -35,6 +35,16 @@
     #include <cub/util_ptx.cuh>
 #endif
 
+#if defined(__linux__)
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+#include <cstdint>
+#include <new>
+
+#include "../test/hipcub/test_utils_random.hpp"
+
 #ifndef HIPCUB_CUB_API
 #define HIPCUB_WARP_THREADS_MACRO warpSize
 #else
@@ -44,69 +54,655 @@
 namespace benchmark_utils
 {
 const size_t default_max_random_size = 1024 * 1024;
-// get_random_data() generates only part of sequence and replicates it,
-// because benchmarks usually do not need "true" random sequence.
+
+/// Shape of the input data produced by get_random_data()
+enum class data_distribution
+{
+    uniform,
+    zipf,
+    exponential,
+    sorted,
+    reverse_sorted,
+    nearly_sorted,
+    few_unique,
+    entropy_reduced
+};
+
+inline const char* to_string(data_distribution distribution)
+{
+    switch(distribution)
+    {
+        case data_distribution::uniform: return "uniform";
+        case data_distribution::zipf: return "zipf";
+        case data_distribution::exponential: return "exponential";
+        case data_distribution::sorted: return "sorted";
+        case data_distribution::reverse_sorted: return "reverse_sorted";
+        case data_distribution::nearly_sorted: return "nearly_sorted";
+        case data_distribution::few_unique: return "few_unique";
+        case data_distribution::entropy_reduced: return "entropy_reduced";
+    }
+    return "unknown";
+}
+
+inline bool parse_data_distribution(const std::string& name, data_distribution& distribution)
+{
+    const data_distribution all[] = {data_distribution::uniform,
+                                     data_distribution::zipf,
+                                     data_distribution::exponential,
+                                     data_distribution::sorted,
+                                     data_distribution::reverse_sorted,
+                                     data_distribution::nearly_sorted,
+                                     data_distribution::few_unique,
+                                     data_distribution::entropy_reduced};
+    for(const data_distribution candidate : all)
+    {
+        if(name == to_string(candidate))
+        {
+            distribution = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+struct data_generation_config
+{
+    data_distribution distribution = data_distribution::uniform;
+    unsigned int      seed         = 0;
+    // Exponent of the Zipf distribution, larger values produce more skew.
+    double zipf_alpha = 1.0;
+    // Number of distinct ranks the Zipf distribution draws from.
+    size_t zipf_ranks = 1 << 16;
+    // Rate of the exponential distribution over the unit interval [0, 1].
+    double exponential_lambda = 10.0;
+    // Fraction of the elements that is displaced in a nearly sorted input.
+    double nearly_sorted_fraction = 0.01;
+    // Number of distinct values in a few unique input.
+    size_t few_unique_count = 16;
+    // Number of uniform words combined with bitwise AND for entropy reduced input.
+    // Each additional word halves the probability of a bit being set.
+    unsigned int entropy_reduction = 2;
+};
+
+/// Global data generation settings, set from the command line by apply_data_generation_options().
+inline data_generation_config& get_data_generation_config()
+{
+    static data_generation_config config;
+    return config;
+}
+
+/// Each call to get_random_data() draws from its own stream of the configured seed, so
+/// that e.g. the key and the value arrays of a benchmark are different but reproducible.
+inline unsigned int next_data_generation_stream()
+{
+    static std::atomic<unsigned int> stream{0};
+    return stream++;
+}
+
+inline void add_data_generation_options(cli::Parser& parser)
+{
+    const data_generation_config defaults;
+    parser.set_optional<std::string>("distribution",
+                                     "distribution",
+                                     to_string(defaults.distribution),
+                                     "input distribution: uniform, zipf, exponential, sorted, "
+                                     "reverse_sorted, nearly_sorted, few_unique, entropy_reduced");
+    parser.set_optional<unsigned int>("seed", "seed", defaults.seed, "seed of the input data");
+    parser.set_optional<double>("zipf_alpha",
+                                "zipf_alpha",
+                                defaults.zipf_alpha,
+                                "exponent of the zipf distribution");
+    parser.set_optional<double>("exponential_lambda",
+                                "exponential_lambda",
+                                defaults.exponential_lambda,
+                                "rate of the exponential distribution");
+    parser.set_optional<double>("nearly_sorted_fraction",
+                                "nearly_sorted_fraction",
+                                defaults.nearly_sorted_fraction,
+                                "fraction of displaced values in nearly sorted input");
+    parser.set_optional<size_t>("unique_count",
+                                "unique_count",
+                                defaults.few_unique_count,
+                                "number of distinct values in few unique input");
+    parser.set_optional<int>("entropy_reduction",
+                             "entropy_reduction",
+                             defaults.entropy_reduction,
+                             "number of words combined with AND in entropy reduced input");
+}
+
+inline void apply_data_generation_options(const cli::Parser& parser)
+{
+    data_generation_config& config = get_data_generation_config();
+
+    const std::string distribution = parser.get<std::string>("distribution");
+    if(!parse_data_distribution(distribution, config.distribution))
+    {
+        std::cerr << "Unknown distribution: " << distribution << std::endl;
+        exit(1);
+    }
+    config.seed                   = parser.get<unsigned int>("seed");
+    config.zipf_alpha             = parser.get<double>("zipf_alpha");
+    config.exponential_lambda     = parser.get<double>("exponential_lambda");
+    config.nearly_sorted_fraction = parser.get<double>("nearly_sorted_fraction");
+    config.few_unique_count       = std::max<size_t>(1, parser.get<size_t>("unique_count"));
+    config.entropy_reduction      = std::max(1, parser.get<int>("entropy_reduction"));
+
+    std::cout << "[Data] Distribution: " << to_string(config.distribution)
+              << ", seed: " << config.seed << std::endl;
+}
+
+namespace detail
+{
+
+// The generator and the mappings of random bits are shared with the tests.
+using test_utils::detail::counter_based_engine;
+using test_utils::detail::to_range_offset;
+using test_utils::detail::to_unit_fraction;
+
+/// Derives the key of an independent stream from a seed and a stream index.
+HIPCUB_HOST_DEVICE inline unsigned long long make_random_key(unsigned long long seed,
+                                                               unsigned long long stream)
+{
+    return counter_based_engine::mix(counter_based_engine::mix(seed) ^ (stream * counter_based_engine::gamma));
+}
+
+// Granularity of the work distributed over the host threads.
+constexpr size_t generate_chunk_size = 64 * 1024;
+
+/// Calls chunk_op(begin, end) for consecutive chunks of [0, size) on all hardware threads.
+template<class ChunkOp>
+inline void parallel_for_chunks(size_t size, ChunkOp chunk_op)
+{
+    const size_t num_chunks = (size + generate_chunk_size - 1) / generate_chunk_size;
+    const size_t num_threads
+        = std::max<size_t>(1, std::min<size_t>(std::thread::hardware_concurrency(), num_chunks));
+
+    auto worker = [&](const size_t thread_id)
+    {
+        for(size_t chunk = thread_id; chunk < num_chunks; chunk += num_threads)
+        {
+            const size_t begin = chunk * generate_chunk_size;
+            chunk_op(begin, std::min(size, begin + generate_chunk_size));
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for(size_t thread_id = 1; thread_id < num_threads; thread_id++)
+    {
+        threads.emplace_back(worker, thread_id);
+    }
+    worker(0);
+    for(auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+// Allocations of at least this size are backed by transparent huge pages where available.
+constexpr size_t huge_page_size = 2 * 1024 * 1024;
+
+inline void* allocate_host_pages(size_t bytes)
+{
+#if defined(__linux__)
+    if(bytes >= huge_page_size)
+    {
+        // Over-allocate to align the mapping to a huge page boundary, then return the excess.
+        const size_t mapped_bytes = bytes + huge_page_size;
+        void*        mapping      = mmap(nullptr,
+                             mapped_bytes,
+                             PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS,
+                             -1,
+                             0);
+        if(mapping == MAP_FAILED)
+        {
+            throw std::bad_alloc();
+        }
+        const uintptr_t begin = reinterpret_cast<uintptr_t>(mapping);
+        const uintptr_t aligned
+            = (begin + huge_page_size - 1) & ~static_cast<uintptr_t>(huge_page_size - 1);
+        const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        const size_t tail_offset
+            = (aligned - begin + bytes + page_size - 1) & ~static_cast<size_t>(page_size - 1);
+        if(aligned != begin)
+        {
+            munmap(mapping, aligned - begin);
+        }
+        if(tail_offset < mapped_bytes)
+        {
+            munmap(reinterpret_cast<void*>(begin + tail_offset), mapped_bytes - tail_offset);
+        }
+    #ifdef MADV_HUGEPAGE
+        madvise(reinterpret_cast<void*>(aligned), bytes, MADV_HUGEPAGE);
+    #endif
+        return reinterpret_cast<void*>(aligned);
+    }
+#endif
+    return ::operator new(bytes);
+}
+
+inline void deallocate_host_pages(void* ptr, size_t bytes) noexcept
+{
+#if defined(__linux__)
+    if(bytes >= huge_page_size)
+    {
+        munmap(ptr, bytes);
+        return;
+    }
+#endif
+    (void)bytes;
+    ::operator delete(ptr);
+}
+
+/// Maps random bits or a fraction of the unit interval to a value in [min, max].
+template<class T, class Enable = void>
+struct value_mapper;
+
 template<class T>
-inline auto get_random_data(size_t size, T min, T max, size_t max_random_size = default_max_random_size)
-    -> typename std::enable_if<std::is_integral<T>::value, std::vector<T>>::type
+struct value_mapper<T, typename std::enable_if<std::is_integral<T>::value>::type>
 {
-    std::random_device rd;
-    std::default_random_engine gen(rd());
-    using distribution_type = typename std::conditional<(sizeof(T)==1), short, T>::type;	
-    std::uniform_int_distribution<distribution_type> distribution(min, max);
-    std::vector<T> data(size);
-    std::generate(
-        data.begin(), data.begin() + std::min(size, max_random_size),
-        [&]() { return distribution(gen); }
-    );
-    for(size_t i = max_random_size; i < size; i += max_random_size)
+    using unsigned_type = typename std::make_unsigned<T>::type;
+
+    T             min;
+    unsigned_type range;
+
+    HIPCUB_HOST_DEVICE value_mapper(T min, T max)
+        : min(min), range(static_cast<unsigned_type>(static_cast<unsigned_type>(max) - static_cast<unsigned_type>(min)))
+    {}
+
+    HIPCUB_HOST_DEVICE T from_bits(unsigned long long bits) const
+    {
+        const unsigned_type offset = static_cast<unsigned_type>(to_range_offset(bits, range));
+        return static_cast<T>(static_cast<unsigned_type>(min) + offset);
+    }
+
+    HIPCUB_HOST_DEVICE T from_fraction(double fraction) const
+    {
+        const double  scaled = fraction * (static_cast<double>(range) + 1.0);
+        unsigned_type offset = range;
+        if(scaled < static_cast<double>(range))
+        {
+            offset = scaled > 0.0 ? static_cast<unsigned_type>(scaled) : 0;
+        }
+        return static_cast<T>(static_cast<unsigned_type>(min) + offset);
+    }
+};
+
+template<class T>
+struct value_mapper<T, typename std::enable_if<std::is_floating_point<T>::value>::type>
+{
+    T min;
+    T max;
+
+    HIPCUB_HOST_DEVICE value_mapper(T min, T max) : min(min), max(max) {}
+
+    HIPCUB_HOST_DEVICE T from_bits(unsigned long long bits) const
     {
-        std::copy_n(data.begin(), std::min(size - i, max_random_size), data.begin() + i);
+        return from_fraction(to_unit_fraction(bits));
     }
+
+    HIPCUB_HOST_DEVICE T from_fraction(double fraction) const
+    {
+        return static_cast<T>(min + (max - min) * fraction);
+    }
+};
+
+/// Cumulative distribution of the ranks [0, ranks) where rank k has weight 1 / (k + 1)^alpha.
+inline std::vector<double> make_zipf_cdf(size_t ranks, double alpha)
+{
+    std::vector<double> cdf(std::max<size_t>(1, ranks));
+    double              sum = 0.0;
+    for(size_t k = 0; k < cdf.size(); k++)
+    {
+        sum += 1.0 / std::pow(static_cast<double>(k + 1), alpha);
+        cdf[k] = sum;
+    }
+    for(double& value : cdf)
+    {
+        value /= sum;
+    }
+    return cdf;
+}
+
+/// Computes element i of a generated sequence from its index alone, so the same
+/// sequence is produced on the host and on the device. nearly_sorted is generated as
+/// sorted here, the local displacement is applied by generate_data().
+template<class T>
+struct element_generator
+{
+    value_mapper<T>    mapper;
+    data_distribution  distribution;
+    unsigned long long key;
+    size_t             size;
+    double             exponential_lambda;
+    unsigned int       entropy_reduction;
+    size_t             few_unique_count;
+    // Cumulative distribution for zipf, must be accessible where the generator runs.
+    const double* zipf_cdf;
+    size_t        zipf_ranks;
+
+    HIPCUB_HOST_DEVICE T operator()(size_t i) const
+    {
+        counter_based_engine engine(key, static_cast<unsigned long long>(i) * entropy_reduction);
+        switch(distribution)
+        {
+            case data_distribution::uniform: return mapper.from_bits(engine());
+            case data_distribution::zipf:
+            {
+                const double u = to_unit_fraction(engine());
+                // lower_bound in the cumulative distribution
+                size_t first = 0;
+                size_t count = zipf_ranks - 1;
+                while(count > 0)
+                {
+                    const size_t step = count / 2;
+                    if(zipf_cdf[first + step] < u)
+                    {
+                        first += step + 1;
+                        count -= step + 1;
+                    }
+                    else
+                    {
+                        count = step;
+                    }
+                }
+                return mapper.from_fraction(static_cast<double>(first)
+                                            / static_cast<double>(zipf_ranks));
+            }
+            case data_distribution::exponential:
+            {
+                const double x = -log1p(-to_unit_fraction(engine())) / exponential_lambda;
+                return mapper.from_fraction(x < 1.0 ? x : 1.0);
+            }
+            case data_distribution::sorted:
+            case data_distribution::nearly_sorted:
+                return mapper.from_fraction(static_cast<double>(i) / static_cast<double>(size));
+            case data_distribution::reverse_sorted:
+                return mapper.from_fraction(static_cast<double>(size - 1 - i)
+                                            / static_cast<double>(size));
+            case data_distribution::few_unique:
+            {
+                // The unique values are the first few_unique_count outputs of a second stream.
+                const unsigned long long unique_index = engine() % few_unique_count;
+                return mapper.from_bits(counter_based_engine(~key, unique_index)());
+            }
+            case data_distribution::entropy_reduced:
+            {
+                unsigned long long bits = engine();
+                for(unsigned int k = 1; k < entropy_reduction; k++)
+                {
+                    bits &= engine();
+                }
+                return mapper.from_bits(bits);
+            }
+        }
+        return mapper.min;
+    }
+};
+
+template<class T>
+inline element_generator<T> make_element_generator(size_t                        size,
+                                                   T                             min,
+                                                   T                             max,
+                                                   const data_generation_config& config,
+                                                   unsigned int                  stream,
+                                                   const double*                 zipf_cdf)
+{
+    element_generator<T> generator{value_mapper<T>(min, max),
+                                   config.distribution,
+                                   make_random_key(config.seed, stream),
+                                   size,
+                                   config.exponential_lambda,
+                                   1,
+                                   config.few_unique_count,
+                                   zipf_cdf,
+                                   config.zipf_ranks};
+    // Only entropy reduced input draws more than one word per element.
+    if(config.distribution == data_distribution::entropy_reduced)
+    {
+        generator.entropy_reduction = config.entropy_reduction;
+    }
+    return generator;
+}
+
+template<class T, class Container = std::vector<T>>
+inline Container generate_data(size_t                        size,
+                               T                             min,
+                               T                             max,
+                               const data_generation_config& config,
+                               unsigned int                  stream)
+{
+    std::vector<double> zipf_cdf;
+    if(config.distribution == data_distribution::zipf)
+    {
+        zipf_cdf = make_zipf_cdf(config.zipf_ranks, config.zipf_alpha);
+    }
+    const element_generator<T> generator
+        = make_element_generator(size, min, max, config, stream, zipf_cdf.data());
+
+    Container data(size);
+    parallel_for_chunks(size,
+                        [&](size_t begin, size_t end)
+                        {
+                            for(size_t i = begin; i < end; i++)
+                            {
+                                data[i] = generator(i);
+                            }
+                            if(config.distribution == data_distribution::nearly_sorted
+                               && end - begin > 1)
+                            {
+                                // Displace values only within the chunk to keep the disorder local.
+                                counter_based_engine engine(~generator.key, begin);
+                                const size_t         swaps = static_cast<size_t>(
+                                    config.nearly_sorted_fraction * (end - begin) / 2);
+                                for(size_t s = 0; s < swaps; s++)
+                                {
+                                    std::swap(data[begin + engine() % (end - begin)],
+                                              data[begin + engine() % (end - begin)]);
+                                }
+                            }
+                        });
     return data;
 }
 
+template<class T>
+__global__ void generate_data_kernel(T* output, size_t size, element_generator<T> generator)
+{
+    const size_t stride = static_cast<size_t>(gridDim.x) * blockDim.x;
+    for(size_t i = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x; i < size; i += stride)
+    {
+        output[i] = generator(i);
+    }
+}
+
+} // end detail namespace
+
+/// Allocator for large host staging buffers. Large allocations are backed by huge pages
+/// (Linux only). Elements are default-initialized, so the pages of a buffer of trivial types
+/// are first touched by the threads that generate its contents, which places them on the
+/// NUMA nodes of those threads.
+template<class T>
+struct host_allocator
+{
+    using value_type = T;
+
+    host_allocator() = default;
+
+    template<class U>
+    host_allocator(const host_allocator<U>&) noexcept
+    {}
+
+    T* allocate(size_t n)
+    {
+        return static_cast<T*>(detail::allocate_host_pages(n * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, size_t n) noexcept
+    {
+        detail::deallocate_host_pages(ptr, n * sizeof(T));
+    }
+
+    template<class U>
+    void construct(U* ptr) noexcept(std::is_nothrow_default_constructible<U>::value)
+    {
+        ::new(static_cast<void*>(ptr)) U;
+    }
+
+    template<class U, class... Args>
+    void construct(U* ptr, Args&&... args)
+    {
+        ::new(static_cast<void*>(ptr)) U(std::forward<Args>(args)...);
+    }
+};
+
+template<class T, class U>
+inline bool operator==(const host_allocator<T>&, const host_allocator<U>&)
+{
+    return true;
+}
+
+template<class T, class U>
+inline bool operator!=(const host_allocator<T>&, const host_allocator<U>&)
+{
+    return false;
+}
+
+template<class T>
+using host_buffer = std::vector<T, host_allocator<T>>;
+
+// get_random_data() generates values in [min, max] following the distribution selected on
+// the command line (see add_data_generation_options()). The data is generated in parallel
+// and is reproducible for a given seed. max_random_size is kept for source compatibility,
+// the sequence is no longer replicated.
 template<class T>
 inline auto get_random_data(size_t size, T min, T max, size_t max_random_size = default_max_random_size)
-    -> typename std::enable_if<std::is_floating_point<T>::value, std::vector<T>>::type
+    -> typename std::enable_if<std::is_arithmetic<T>::value, std::vector<T>>::type
 {
-    std::random_device rd;
-    std::default_random_engine gen(rd());
-    std::uniform_real_distribution<T> distribution(min, max);
-    std::vector<T> data(size);
-    std::generate(
-        data.begin(), data.begin() + std::min(size, max_random_size),
-        [&]() { return distribution(gen); }
-    );
-    for(size_t i = max_random_size; i < size; i += max_random_size)
+    (void)max_random_size;
+    return detail::generate_data(size,
+                                 min,
+                                 max,
+                                 get_data_generation_config(),
+                                 next_data_generation_stream());
+}
+
+// Same as get_random_data() but returns a host_buffer, for large inputs staged on the host.
+template<class T>
+inline auto get_random_host_buffer(size_t size, T min, T max)
+    -> typename std::enable_if<std::is_arithmetic<T>::value, host_buffer<T>>::type
+{
+    return detail::generate_data<T, host_buffer<T>>(size,
+                                                    min,
+                                                    max,
+                                                    get_data_generation_config(),
+                                                    next_data_generation_stream());
+}
+
+// Device version of get_random_data(), writes the values to d_output without staging them
+// on the host. Produces the same values as get_random_data() for the same stream, except
+// for nearly_sorted input which is generated on the host and copied.
+template<class T>
+inline auto get_random_data_device(T* d_output, size_t size, T min, T max, hipStream_t stream = 0)
+    -> typename std::enable_if<std::is_arithmetic<T>::value, hipError_t>::type
+{
+    const data_generation_config& config         = get_data_generation_config();
+    const unsigned int            random_stream = next_data_generation_stream();
+
+    if(config.distribution == data_distribution::nearly_sorted)
     {
-        std::copy_n(data.begin(), std::min(size - i, max_random_size), data.begin() + i);
+        const host_buffer<T> data
+            = detail::generate_data<T, host_buffer<T>>(size, min, max, config, random_stream);
+        return hipMemcpyAsync(d_output,
+                              data.data(),
+                              size * sizeof(T),
+                              hipMemcpyHostToDevice,
+                              stream);
     }
-    return data;
+
+    double* d_zipf_cdf = nullptr;
+    if(config.distribution == data_distribution::zipf)
+    {
+        const std::vector<double> zipf_cdf
+            = detail::make_zipf_cdf(config.zipf_ranks, config.zipf_alpha);
+        hipError_t error = hipMalloc(&d_zipf_cdf, zipf_cdf.size() * sizeof(double));
+        if(error == hipSuccess)
+        {
+            error = hipMemcpy(d_zipf_cdf,
+                              zipf_cdf.data(),
+                              zipf_cdf.size() * sizeof(double),
+                              hipMemcpyHostToDevice);
+        }
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+    }
+
+    const detail::element_generator<T> generator
+        = detail::make_element_generator(size, min, max, config, random_stream, d_zipf_cdf);
+
+    constexpr unsigned int block_size = 256;
+    const unsigned int     grid_size  = static_cast<unsigned int>(
+        std::min<size_t>((size + block_size - 1) / block_size, 64 * 1024));
+    if(grid_size > 0)
+    {
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(detail::generate_data_kernel<T>),
+                           dim3(grid_size),
+                           dim3(block_size),
+                           0,
+                           stream,
+                           d_output,
+                           size,
+                           generator);
+    }
+    hipError_t error = hipGetLastError();
+    if(d_zipf_cdf != nullptr)
+    {
+        const hipError_t sync_error = hipStreamSynchronize(stream);
+        const hipError_t free_error = hipFree(d_zipf_cdf);
+        if(error == hipSuccess)
+        {
+            error = sync_error != hipSuccess ? sync_error : free_error;
+        }
+    }
+    return error;
+}
+
+// Same as get_random_data() but always uniform, for auxiliary data such as segment lengths
+// and flags whose shape should not change with the selected input distribution.
+template<class T>
+inline auto get_uniform_random_data(size_t size, T min, T max)
+    -> typename std::enable_if<std::is_arithmetic<T>::value, std::vector<T>>::type
+{
+    data_generation_config config = get_data_generation_config();
+    config.distribution           = data_distribution::uniform;
+    return detail::generate_data(size, min, max, config, next_data_generation_stream());
 }
 
 template<class T>
 inline std::vector<T> get_random_data01(size_t size, float p, size_t max_random_size = default_max_random_size)
 {
-    std::random_device rd;
-    std::default_random_engine gen(rd());
-    std::bernoulli_distribution distribution(p);
+    (void)max_random_size;
+    const unsigned long long key = detail::make_random_key(get_data_generation_config().seed,
+                                                           next_data_generation_stream());
+    const double   threshold = static_cast<double>(p);
     std::vector<T> data(size);
-    std::generate(
-        data.begin(), data.begin() + std::min(size, max_random_size),
-        [&]() { return distribution(gen); }
-    );
-    for(size_t i = max_random_size; i < size; i += max_random_size)
-    {
-        std::copy_n(data.begin(), std::min(size - i, max_random_size), data.begin() + i);
-    }
+    detail::parallel_for_chunks(size,
+                                [&](size_t begin, size_t end)
+                                {
+                                    detail::counter_based_engine engine(key, begin);
+                                    for(size_t i = begin; i < end; i++)
+                                    {
+                                        data[i] = detail::to_unit_fraction(engine()) < threshold;
+                                    }
+                                });
     return data;
 }
 
 template<class T>
 inline T get_random_value(T min, T max)
 {
-    return get_random_data(1, min, max)[0];
+    return get_uniform_random_data(1, min, max)[0];
 }
 
 
@@ -300,7 +300,7 @@ void run_segmented_benchmark(benchmark::State& state, const benchmark_kinds benc
             std::numeric_limits<T>::max()
         );
 
-    const auto segment_sizes = benchmark_utils::get_random_data<unsigned int>(
+    const auto segment_sizes = benchmark_utils::get_uniform_random_data<unsigned int>(
         num_segments, 0, max_segment_size);
 
     T* d_input  = nullptr;
@@ -403,7 +403,9 @@ int main(int argc, char *argv[])
     cli::Parser parser(argc, argv);
     parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
     parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    benchmark_utils::add_data_generation_options(parser);
     parser.run_and_exit_if_error();
+    benchmark_utils::apply_data_generation_options(parser);
 
     // Parse argv
     benchmark::Initialize(&argc, argv);
@@ -137,7 +137,7 @@ void run_benchmark(benchmark::State& state, hipStream_t stream, size_t N)
     const auto size = BlockSize * ((N + BlockSize - 1)/BlockSize);
 
     std::vector<T> input = benchmark_utils::get_random_data<T>(size, T(0), T(10));
-    std::vector<flag_type> flags = benchmark_utils::get_random_data<flag_type>(size, 0, 1);
+    std::vector<flag_type> flags = benchmark_utils::get_uniform_random_data<flag_type>(size, 0, 1);
     T * d_input;
     flag_type * d_flags;
     T * d_output;
@@ -247,7 +247,9 @@ int main(int argc, char *argv[])
     cli::Parser parser(argc, argv);
     parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
     parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    benchmark_utils::add_data_generation_options(parser);
     parser.run_and_exit_if_error();
+    benchmark_utils::apply_data_generation_options(parser);
 
     // Parse argv
     benchmark::Initialize(&argc, argv);
@@ -21,6 +21,7 @@
 // SOFTWARE.
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <iostream>
 #include <type_traits>
@@ -32,6 +33,8 @@
 #include <cmath>
 #include <cstdlib>
 #include <numeric>
+#include <string>
+#include <thread>
 
 // Google Benchmark
 #include "benchmark/benchmark.h"
@@ -113,6 +113,28 @@ while(IT1 LESS COUNT)
 endwhile()
 string(REGEX REPLACE [[,$]] "" JSON_PAYLOAD ${JSON_PAYLOAD})
 
+# Host-only tests and the large size class shards of the tests (for their multi-threaded host
+# reference computations) each request a slot of the "host" resource. There is one slot per
+# HOST_THREADS_PER_SLOT (default 8) logical cores, unless overridden with -D HOST_SLOTS=<count>.
+if(NOT DEFINED HOST_SLOTS)
+  if(NOT DEFINED HOST_THREADS_PER_SLOT)
+    set(HOST_THREADS_PER_SLOT 8)
+  endif()
+  cmake_host_system_information(RESULT HOST_THREADS QUERY NUMBER_OF_LOGICAL_CORES)
+  math(EXPR HOST_SLOTS "${HOST_THREADS} / ${HOST_THREADS_PER_SLOT}")
+  if(HOST_SLOTS LESS 1)
+    set(HOST_SLOTS 1)
+  endif()
+endif()
+string(APPEND JSON_PAYLOAD
+         ",\n      \"host\": ["
+         "\n        {\n"
+         "           \"id\": \"0\",\n"
+         "           \"slots\": ${HOST_SLOTS}\n"
+         "        }"
+         "\n      ]"
+)
+
 set(JSON_HEAD [[{
   "version": {
     "major": 1,
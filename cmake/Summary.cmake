@@ -50,4 +50,5 @@ endif()
     message(STATUS "  BUILD_TEST                  : ${BUILD_TEST}")
     message(STATUS "  BUILD_BENCHMARK             : ${BUILD_BENCHMARK}")
     message(STATUS "  BUILD_ADDRESS_SANITIZER     : ${BUILD_ADDRESS_SANITIZER}")
+    message(STATUS "  BUILD_INSTANTIATIONS        : ${BUILD_INSTANTIATIONS}")
 endfunction()
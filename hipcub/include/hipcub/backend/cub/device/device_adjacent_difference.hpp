@@ -30,6 +30,7 @@
 #define HIPCUB_CUB_DEVICE_DEVICE_ADJACENT_DIFFERENCE_HPP_
 
 #include "../../../config.hpp"
+#include "../../../util_trace.hpp"
 
 #include <cub/device/device_adjacent_difference.cuh>
 
@@ -50,6 +51,11 @@ struct DeviceAdjacentDifference
                                                                hipStream_t     stream        = 0,
                                                                bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceAdjacentDifference::SubtractLeftCopy",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(
             ::cub::DeviceAdjacentDifference::SubtractLeftCopy(d_temp_storage,
@@ -72,6 +78,11 @@ struct DeviceAdjacentDifference
                                                            hipStream_t           stream        = 0,
                                                            bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceAdjacentDifference::SubtractLeft",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(
             ::cub::DeviceAdjacentDifference::SubtractLeft(d_temp_storage,
@@ -95,6 +106,11 @@ struct DeviceAdjacentDifference
                                                                 hipStream_t     stream        = 0,
                                                                 bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceAdjacentDifference::SubtractRightCopy",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(
             ::cub::DeviceAdjacentDifference::SubtractRightCopy(d_temp_storage,
@@ -117,6 +133,11 @@ struct DeviceAdjacentDifference
                                                             hipStream_t   stream            = 0,
                                                             bool          debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceAdjacentDifference::SubtractRight",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(
             ::cub::DeviceAdjacentDifference::SubtractRight(d_temp_storage,
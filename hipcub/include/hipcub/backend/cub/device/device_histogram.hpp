@@ -31,6 +31,7 @@
 #define HIPCUB_CUB_DEVICE_DEVICE_HISTOGRAM_HPP_
 
 #include "../../../config.hpp"
+#include "../../../util_trace.hpp"
 
 #include <cub/device/device_histogram.cuh>
 
@@ -56,6 +57,11 @@ struct DeviceHistogram
                              hipStream_t stream = 0,
                              bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceHistogram::HistogramEven",
+                                  num_samples,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceHistogram::HistogramEven(d_temp_storage,
                                                                             temp_storage_bytes,
@@ -88,6 +94,11 @@ struct DeviceHistogram
                              hipStream_t stream = 0,
                              bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceHistogram::HistogramEven",
+                                  size_t(num_row_samples) * num_rows,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceHistogram::HistogramEven(d_temp_storage,
                                                                             temp_storage_bytes,
@@ -122,6 +133,11 @@ struct DeviceHistogram
                                   hipStream_t stream = 0,
                                   bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceHistogram::MultiHistogramEven",
+                                  num_pixels,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(
             ::cub::DeviceHistogram::MultiHistogramEven<NUM_CHANNELS, NUM_ACTIVE_CHANNELS>(
@@ -158,6 +174,11 @@ struct DeviceHistogram
                                   hipStream_t stream = 0,
                                   bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceHistogram::MultiHistogramEven",
+                                  size_t(num_row_pixels) * num_rows,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(
             ::cub::DeviceHistogram::MultiHistogramEven<NUM_CHANNELS, NUM_ACTIVE_CHANNELS>(
@@ -191,6 +212,11 @@ struct DeviceHistogram
                               hipStream_t stream = 0,
                               bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceHistogram::HistogramRange",
+                                  num_samples,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceHistogram::HistogramRange(d_temp_storage,
                                                                              temp_storage_bytes,
@@ -221,6 +247,11 @@ struct DeviceHistogram
                               hipStream_t stream = 0,
                               bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceHistogram::HistogramRange",
+                                  size_t(num_row_samples) * num_rows,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceHistogram::HistogramRange(d_temp_storage,
                                                                              temp_storage_bytes,
@@ -253,6 +284,11 @@ struct DeviceHistogram
                                    hipStream_t stream = 0,
                                    bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceHistogram::MultiHistogramRange",
+                                  num_pixels,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(
             ::cub::DeviceHistogram::MultiHistogramRange<NUM_CHANNELS, NUM_ACTIVE_CHANNELS>(
@@ -287,6 +323,11 @@ struct DeviceHistogram
                                    hipStream_t stream = 0,
                                    bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceHistogram::MultiHistogramRange",
+                                  size_t(num_row_pixels) * num_rows,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(
             ::cub::DeviceHistogram::MultiHistogramRange<NUM_CHANNELS, NUM_ACTIVE_CHANNELS>(
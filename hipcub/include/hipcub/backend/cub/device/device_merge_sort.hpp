@@ -31,6 +31,7 @@
 #define HIPCUB_CUB_DEVICE_DEVICE_MERGE_SORT_HPP_
 
 #include "../../../config.hpp"
+#include "../../../util_trace.hpp"
 
 #include <cub/device/device_merge_sort.cuh>
 
@@ -48,6 +49,11 @@ struct DeviceMergeSort
                                                       hipStream_t    stream            = 0,
                                                       bool           debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceMergeSort::SortPairs",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceMergeSort::SortPairs(d_temp_storage,
                                                                         temp_storage_bytes,
@@ -75,6 +81,11 @@ struct DeviceMergeSort
                                                           hipStream_t         stream = 0,
                                                           bool debug_synchronous     = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceMergeSort::SortPairsCopy",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceMergeSort::SortPairsCopy(d_temp_storage,
                                                                             temp_storage_bytes,
@@ -96,6 +107,11 @@ struct DeviceMergeSort
                                                      hipStream_t   stream            = 0,
                                                      bool          debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceMergeSort::SortKeys",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceMergeSort::SortKeys(d_temp_storage,
                                                                        temp_storage_bytes,
@@ -119,6 +135,11 @@ struct DeviceMergeSort
                                                          bool debug_synchronous = false)
 
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceMergeSort::SortKeysCopy",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceMergeSort::SortKeysCopy(d_temp_storage,
                                                                            temp_storage_bytes,
@@ -139,6 +160,11 @@ struct DeviceMergeSort
                                                               hipStream_t    stream  = 0,
                                                               bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceMergeSort::StableSortPairs",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceMergeSort::StableSortPairs(d_temp_storage,
                                                                               temp_storage_bytes,
@@ -158,6 +184,11 @@ struct DeviceMergeSort
                                                              hipStream_t   stream   = 0,
                                                              bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceMergeSort::StableSortKeys",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceMergeSort::StableSortKeys(d_temp_storage,
                                                                              temp_storage_bytes,
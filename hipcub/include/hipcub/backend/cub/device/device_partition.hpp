@@ -31,6 +31,7 @@
 #define HIPCUB_CUB_DEVICE_DEVICE_PARTITION_HPP_
 
 #include "../../../config.hpp"
+#include "../../../util_trace.hpp"
 
 #include <cub/device/device_partition.cuh>
 
@@ -55,6 +56,11 @@ struct DevicePartition
         hipStream_t                 stream             = 0,         ///< [in] <b>[optional]</b> hip stream to launch kernels within.  Default is stream<sub>0</sub>.
         bool                        debug_synchronous  = false)     ///< [in] <b>[optional]</b> Whether or not to synchronize the stream after every kernel launch to check for errors.  May cause significant slowdown.  Default is \p false.
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DevicePartition::Flagged",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DevicePartition::Flagged(d_temp_storage,
                                                                       temp_storage_bytes,
@@ -83,6 +89,11 @@ struct DevicePartition
         hipStream_t                 stream             = 0,         ///< [in] <b>[optional]</b> hip stream to launch kernels within.  Default is stream<sub>0</sub>.
         bool                        debug_synchronous  = false)     ///< [in] <b>[optional]</b> Whether or not to synchronize the stream after every kernel launch to check for errors.  May cause significant slowdown.  Default is \p false.
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DevicePartition::If",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DevicePartition::If(d_temp_storage,
                                                                  temp_storage_bytes,
@@ -115,6 +126,11 @@ struct DevicePartition
        hipStream_t stream     = 0,
        bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DevicePartition::If",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DevicePartition::If(d_temp_storage,
                                                                  temp_storage_bytes,
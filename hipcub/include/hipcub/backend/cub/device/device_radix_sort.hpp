@@ -31,6 +31,7 @@
 #define HIPCUB_CUB_DEVICE_DEVICE_RADIX_SORT_HPP_
 
 #include "../../../config.hpp"
+#include "../../../util_trace.hpp"
 
 #include <cub/device/device_radix_sort.cuh>
 
@@ -52,6 +53,11 @@ struct DeviceRadixSort
                          hipStream_t stream = 0,
                          bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceRadixSort::SortPairs",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceRadixSort::SortPairs(d_temp_storage,
                                                                         temp_storage_bytes,
@@ -77,6 +83,11 @@ struct DeviceRadixSort
                          hipStream_t stream = 0,
                          bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceRadixSort::SortPairs",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceRadixSort::SortPairs(d_temp_storage,
                                                                         temp_storage_bytes,
@@ -102,6 +113,11 @@ struct DeviceRadixSort
                                    hipStream_t stream = 0,
                                    bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceRadixSort::SortPairsDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(
             ::cub::DeviceRadixSort::SortPairsDescending(d_temp_storage,
@@ -128,6 +144,11 @@ struct DeviceRadixSort
                                    hipStream_t stream = 0,
                                    bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceRadixSort::SortPairsDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(
             ::cub::DeviceRadixSort::SortPairsDescending(d_temp_storage,
@@ -152,6 +173,11 @@ struct DeviceRadixSort
                         hipStream_t stream = 0,
                         bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceRadixSort::SortKeys",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceRadixSort::SortKeys(d_temp_storage,
                                                                        temp_storage_bytes,
@@ -174,6 +200,11 @@ struct DeviceRadixSort
                         hipStream_t stream = 0,
                         bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceRadixSort::SortKeys",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceRadixSort::SortKeys(d_temp_storage,
                                                                        temp_storage_bytes,
@@ -196,6 +227,11 @@ struct DeviceRadixSort
                                   hipStream_t stream = 0,
                                   bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceRadixSort::SortKeysDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceRadixSort::SortKeysDescending(d_temp_storage,
                                                                                  temp_storage_bytes,
@@ -218,6 +254,11 @@ struct DeviceRadixSort
                                   hipStream_t stream = 0,
                                   bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceRadixSort::SortKeysDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceRadixSort::SortKeysDescending(d_temp_storage,
                                                                                  temp_storage_bytes,
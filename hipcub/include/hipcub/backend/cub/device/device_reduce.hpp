@@ -31,6 +31,7 @@
 #define HIPCUB_CUB_DEVICE_DEVICE_REDUCE_HPP_
 
 #include "../../../config.hpp"
+#include "../../../util_trace.hpp"
 
 #include <cub/device/device_reduce.cuh>
 
@@ -56,6 +57,11 @@ public:
                       hipStream_t stream = 0,
                       bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceReduce::Reduce",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceReduce::Reduce(d_temp_storage,
                                                                   temp_storage_bytes,
@@ -80,6 +86,11 @@ public:
                    hipStream_t stream = 0,
                    bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceReduce::Sum",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceReduce::Sum(d_temp_storage,
                                                                temp_storage_bytes,
@@ -102,6 +113,11 @@ public:
                    hipStream_t stream = 0,
                    bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceReduce::Min",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceReduce::Min(d_temp_storage,
                                                                temp_storage_bytes,
@@ -124,6 +140,11 @@ public:
                       hipStream_t stream = 0,
                       bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceReduce::ArgMin",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceReduce::ArgMin(d_temp_storage,
                                                                   temp_storage_bytes,
@@ -146,6 +167,11 @@ public:
                    hipStream_t stream = 0,
                    bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceReduce::Max",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceReduce::Max(d_temp_storage,
                                                                temp_storage_bytes,
@@ -168,6 +194,11 @@ public:
                       hipStream_t stream = 0,
                       bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceReduce::ArgMax",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceReduce::ArgMax(d_temp_storage,
                                                                   temp_storage_bytes,
@@ -198,6 +229,11 @@ public:
                            hipStream_t stream = 0,
                            bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceReduce::ReduceByKey",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceReduce::ReduceByKey(d_temp_storage,
                                                                        temp_storage_bytes,
@@ -31,6 +31,7 @@
 #define HIPCUB_CUB_DEVICE_DEVICE_RUN_LENGTH_ENCODE_HPP_
 
 #include "../../../config.hpp"
+#include "../../../util_trace.hpp"
 
 #include <cub/device/device_run_length_encode.cuh>
 
@@ -56,6 +57,11 @@ public:
                       hipStream_t stream = 0,
                       bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceRunLengthEncode::Encode",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceRunLengthEncode::Encode(d_temp_storage,
                                                                            temp_storage_bytes,
@@ -84,6 +90,11 @@ public:
                               hipStream_t stream = 0,
                               bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceRunLengthEncode::NonTrivialRuns",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(
             ::cub::DeviceRunLengthEncode::NonTrivialRuns(d_temp_storage,
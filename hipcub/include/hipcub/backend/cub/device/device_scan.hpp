@@ -31,6 +31,7 @@
 #define HIPCUB_CUB_DEVICE_DEVICE_SCAN_HPP_
 
 #include "../../../config.hpp"
+#include "../../../util_trace.hpp"
 
 #include <cub/device/device_scan.cuh>
 
@@ -52,6 +53,11 @@ public:
                             hipStream_t stream = 0,
                             bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceScan::InclusiveSum",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceScan::InclusiveSum(d_temp_storage,
                                                                       temp_storage_bytes,
@@ -76,6 +82,11 @@ public:
                              hipStream_t stream = 0,
                              bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceScan::InclusiveScan",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceScan::InclusiveScan(d_temp_storage,
                                                                        temp_storage_bytes,
@@ -99,6 +110,11 @@ public:
                             hipStream_t stream = 0,
                             bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceScan::ExclusiveSum",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceScan::ExclusiveSum(d_temp_storage,
                                                                       temp_storage_bytes,
@@ -125,6 +141,11 @@ public:
                              hipStream_t stream = 0,
                              bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceScan::ExclusiveScan",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceScan::ExclusiveScan(d_temp_storage,
                                                                        temp_storage_bytes,
@@ -154,6 +175,11 @@ public:
                              hipStream_t stream = 0,
                              bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceScan::ExclusiveScan",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceScan::ExclusiveScan(d_temp_storage,
                                                                        temp_storage_bytes,
@@ -182,6 +208,11 @@ public:
                                  hipStream_t stream = 0,
                                  bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceScan::ExclusiveSumByKey",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceScan::ExclusiveSumByKey(d_temp_storage,
                                                                            temp_storage_bytes,
@@ -214,6 +245,11 @@ public:
                                   hipStream_t stream = 0,
                                   bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceScan::ExclusiveScanByKey",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceScan::ExclusiveScanByKey(d_temp_storage,
                                                                             temp_storage_bytes,
@@ -244,6 +280,11 @@ public:
                                  hipStream_t stream = 0,
                                  bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceScan::InclusiveSumByKey",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceScan::InclusiveSumByKey(d_temp_storage,
                                                                            temp_storage_bytes,
@@ -274,6 +315,11 @@ public:
                                   hipStream_t stream = 0,
                                   bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceScan::InclusiveScanByKey",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceScan::InclusiveScanByKey(d_temp_storage,
                                                                             temp_storage_bytes,
@@ -31,6 +31,7 @@
 #define HIPCUB_CUB_DEVICE_DEVICE_SEGMENTED_RADIX_SORT_HPP_
 
 #include "../../../config.hpp"
+#include "../../../util_trace.hpp"
 
 #include <cub/device/device_segmented_radix_sort.cuh>
 
@@ -55,6 +56,11 @@ struct DeviceSegmentedRadixSort
                          hipStream_t stream = 0,
                          bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedRadixSort::SortPairs",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceSegmentedRadixSort::SortPairs(d_temp_storage,
                                                                                  temp_storage_bytes,
@@ -86,6 +92,11 @@ struct DeviceSegmentedRadixSort
                          hipStream_t stream = 0,
                          bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedRadixSort::SortPairs",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceSegmentedRadixSort::SortPairs(d_temp_storage,
                                                                                  temp_storage_bytes,
@@ -117,6 +128,11 @@ struct DeviceSegmentedRadixSort
                                    hipStream_t stream = 0,
                                    bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedRadixSort::SortPairsDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(
             ::cub::DeviceSegmentedRadixSort::SortPairsDescending(d_temp_storage,
@@ -149,6 +165,11 @@ struct DeviceSegmentedRadixSort
                                    hipStream_t stream = 0,
                                    bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedRadixSort::SortPairsDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(
             ::cub::DeviceSegmentedRadixSort::SortPairsDescending(d_temp_storage,
@@ -179,6 +200,11 @@ struct DeviceSegmentedRadixSort
                         hipStream_t stream = 0,
                         bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedRadixSort::SortKeys",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceSegmentedRadixSort::SortKeys(d_temp_storage,
                                                                                 temp_storage_bytes,
@@ -207,6 +233,11 @@ struct DeviceSegmentedRadixSort
                         hipStream_t stream = 0,
                         bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedRadixSort::SortKeys",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceSegmentedRadixSort::SortKeys(d_temp_storage,
                                                                                 temp_storage_bytes,
@@ -235,6 +266,11 @@ struct DeviceSegmentedRadixSort
                                   hipStream_t stream = 0,
                                   bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedRadixSort::SortKeysDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(
             ::cub::DeviceSegmentedRadixSort::SortKeysDescending(d_temp_storage,
@@ -264,6 +300,11 @@ struct DeviceSegmentedRadixSort
                                   hipStream_t stream = 0,
                                   bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedRadixSort::SortKeysDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(
             ::cub::DeviceSegmentedRadixSort::SortKeysDescending(d_temp_storage,
@@ -31,6 +31,7 @@
 #define HIPCUB_CUB_DEVICE_DEVICE_SEGMENTED_REDUCE_HPP_
 
 #include "../../../config.hpp"
+#include "../../../util_trace.hpp"
 
 #include <cub/device/device_segmented_reduce.cuh>
 
@@ -58,6 +59,11 @@ struct DeviceSegmentedReduce
                       hipStream_t stream = 0,
                       bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedReduce::Reduce",
+                                  num_segments,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceSegmentedReduce::Reduce(d_temp_storage,
                                                                            temp_storage_bytes,
@@ -87,6 +93,11 @@ struct DeviceSegmentedReduce
                    hipStream_t stream = 0,
                    bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedReduce::Sum",
+                                  num_segments,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceSegmentedReduce::Sum(d_temp_storage,
                                                                         temp_storage_bytes,
@@ -114,6 +125,11 @@ struct DeviceSegmentedReduce
                    hipStream_t stream = 0,
                    bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedReduce::Min",
+                                  num_segments,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceSegmentedReduce::Min(d_temp_storage,
                                                                         temp_storage_bytes,
@@ -141,6 +157,11 @@ struct DeviceSegmentedReduce
                       hipStream_t stream = 0,
                       bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedReduce::ArgMin",
+                                  num_segments,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceSegmentedReduce::ArgMin(d_temp_storage,
                                                                            temp_storage_bytes,
@@ -168,6 +189,11 @@ struct DeviceSegmentedReduce
                    hipStream_t stream = 0,
                    bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedReduce::Max",
+                                  num_segments,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceSegmentedReduce::Max(d_temp_storage,
                                                                         temp_storage_bytes,
@@ -195,6 +221,11 @@ struct DeviceSegmentedReduce
                       hipStream_t stream = 0,
                       bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedReduce::ArgMax",
+                                  num_segments,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceSegmentedReduce::ArgMax(d_temp_storage,
                                                                            temp_storage_bytes,
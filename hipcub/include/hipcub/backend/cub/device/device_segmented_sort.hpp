@@ -31,6 +31,7 @@
 #define HIPCUB_CUB_DEVICE_DEVICE_SEGMENTED_SORT_HPP_
 
 #include "../../../config.hpp"
+#include "../../../util_trace.hpp"
 
 #include <cub/device/device_segmented_sort.cuh>
 
@@ -53,6 +54,11 @@ struct DeviceSegmentedSort
                         hipStream_t stream = 0,
                         bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::SortKeys",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceSegmentedSort::SortKeys(d_temp_storage,
                                                                            temp_storage_bytes,
@@ -80,6 +86,11 @@ struct DeviceSegmentedSort
                                   hipStream_t stream = 0,
                                   bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::SortKeysDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(
             ::cub::DeviceSegmentedSort::SortKeysDescending(d_temp_storage,
@@ -107,6 +118,11 @@ struct DeviceSegmentedSort
                         hipStream_t stream = 0,
                         bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::SortKeys",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceSegmentedSort::SortKeys(d_temp_storage,
                                                                            temp_storage_bytes,
@@ -132,6 +148,11 @@ struct DeviceSegmentedSort
                                   hipStream_t stream = 0,
                                   bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::SortKeysDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(
             ::cub::DeviceSegmentedSort::SortKeysDescending(d_temp_storage,
@@ -159,6 +180,11 @@ struct DeviceSegmentedSort
                               hipStream_t stream = 0,
                               bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::StableSortKeys",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceSegmentedSort::StableSortKeys(d_temp_storage,
                                                                                  temp_storage_bytes,
@@ -186,6 +212,11 @@ struct DeviceSegmentedSort
                                         hipStream_t stream = 0,
                                         bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::StableSortKeysDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(
             ::cub::DeviceSegmentedSort::StableSortKeysDescending(d_temp_storage,
@@ -213,6 +244,11 @@ struct DeviceSegmentedSort
                               hipStream_t stream = 0,
                               bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::StableSortKeys",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceSegmentedSort::StableSortKeys(d_temp_storage,
                                                                                  temp_storage_bytes,
@@ -238,6 +274,11 @@ struct DeviceSegmentedSort
                                         hipStream_t stream = 0,
                                         bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::StableSortKeysDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(
             ::cub::DeviceSegmentedSort::StableSortKeysDescending(d_temp_storage,
@@ -268,6 +309,11 @@ struct DeviceSegmentedSort
                          hipStream_t stream = 0,
                          bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::SortPairs",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceSegmentedSort::SortPairs(d_temp_storage,
                                                                             temp_storage_bytes,
@@ -300,6 +346,11 @@ struct DeviceSegmentedSort
                                    hipStream_t stream = 0,
                                    bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::SortPairsDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(
             ::cub::DeviceSegmentedSort::SortPairsDescending(d_temp_storage,
@@ -331,6 +382,11 @@ struct DeviceSegmentedSort
                          hipStream_t stream = 0,
                          bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::SortPairs",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceSegmentedSort::SortPairs(d_temp_storage,
                                                                             temp_storage_bytes,
@@ -359,6 +415,11 @@ struct DeviceSegmentedSort
                                    hipStream_t stream = 0,
                                    bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::SortPairsDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(
             ::cub::DeviceSegmentedSort::SortPairsDescending(d_temp_storage,
@@ -390,6 +451,11 @@ struct DeviceSegmentedSort
                                hipStream_t stream = 0,
                                bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::StableSortPairs",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(
             ::cub::DeviceSegmentedSort::StableSortPairs(d_temp_storage,
@@ -423,6 +489,11 @@ struct DeviceSegmentedSort
                                          hipStream_t stream = 0,
                                          bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::StableSortPairsDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(
             ::cub::DeviceSegmentedSort::StableSortPairsDescending(d_temp_storage,
@@ -454,6 +525,11 @@ struct DeviceSegmentedSort
                                hipStream_t stream = 0,
                                bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::StableSortPairs",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(
             ::cub::DeviceSegmentedSort::StableSortPairs(d_temp_storage,
@@ -483,6 +559,11 @@ struct DeviceSegmentedSort
                                          hipStream_t stream = 0,
                                          bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::StableSortPairsDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(
             ::cub::DeviceSegmentedSort::StableSortPairsDescending(d_temp_storage,
@@ -31,6 +31,7 @@
 #define HIPCUB_CUB_DEVICE_DEVICE_SELECT_HPP_
 
 #include "../../../config.hpp"
+#include "../../../util_trace.hpp"
 
 #include <cub/device/device_select.cuh>
 
@@ -56,6 +57,11 @@ public:
                        hipStream_t stream = 0,
                        bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSelect::Flagged",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceSelect::Flagged(d_temp_storage,
                                                                    temp_storage_bytes,
@@ -84,6 +90,11 @@ public:
                   hipStream_t stream = 0,
                   bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSelect::If",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceSelect::If(d_temp_storage,
                                                               temp_storage_bytes,
@@ -110,6 +121,11 @@ public:
                       hipStream_t stream = 0,
                       bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSelect::Unique",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceSelect::Unique(d_temp_storage,
                                                                   temp_storage_bytes,
@@ -139,6 +155,11 @@ public:
                            hipStream_t stream = 0,
                            bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSelect::UniqueByKey",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         (void)debug_synchronous;
         return hipCUDAErrorTohipError(::cub::DeviceSelect::UniqueByKey(d_temp_storage,
                                                                        temp_storage_bytes,
@@ -31,6 +31,7 @@
 #define HIPCUB_CUB_DEVICE_DEVICE_SPMV_HPP_
 
 #include "../../../config.hpp"
+#include "../../../util_trace.hpp"
 
 #include <cub/device/device_spmv.cuh>
 #include <cub/iterator/tex_ref_input_iterator.cuh>
@@ -77,6 +78,11 @@ template <typename ValueT>
         hipStream_t         stream                  = 0,        ///< [in] <b>[optional]</b> hip stream to launch kernels within.  Default is stream<sub>0</sub>.
         bool                debug_synchronous       = false)    ///< [in] <b>[optional]</b> Whether or not to synchronize the stream after every kernel launch to check for errors.  May cause significant slowdown.  Default is \p false.
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSpmv::CsrMV",
+                                  num_nonzeros,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         ::cub::SpmvParams<ValueT, int> spmv_params;
         spmv_params.d_values             = d_values;
         spmv_params.d_row_end_offsets    = d_row_offsets + 1;
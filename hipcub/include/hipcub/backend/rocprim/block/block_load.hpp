@@ -36,6 +36,8 @@
 
 #include <rocprim/block/block_load.hpp>
 
+#include "../iterator/cache_modified_input_iterator.hpp"
+#include "../util_ptx.hpp"
 #include "block_load_func.hpp"
 
 BEGIN_HIPCUB_NAMESPACE
@@ -147,7 +149,49 @@ public:
         base_type::load(block_iter, items, valid_items, oob_default, temp_storage_);
     }
 
+    /// With BLOCK_LOAD_VECTORIZE, full tiles read through a CacheModifiedInputIterator are
+    /// loaded as vectors that keep the iterator's cache modifier.
+    template<
+        CacheLoadModifier MODIFIER,
+        class ValueType,
+        class OffsetT
+    >
+    HIPCUB_DEVICE inline
+    void Load(CacheModifiedInputIterator<MODIFIER, ValueType, OffsetT> block_iter,
+              T (&items)[ITEMS_PER_THREAD])
+    {
+        using vectorize = std::integral_constant<
+            bool,
+            ALGORITHM == BLOCK_LOAD_VECTORIZE
+                && std::is_same<typename std::remove_cv<ValueType>::type, T>::value>;
+        load_cache_modified(block_iter, items, vectorize());
+    }
+
 private:
+    template<
+        CacheLoadModifier MODIFIER,
+        class ValueType,
+        class OffsetT
+    >
+    HIPCUB_DEVICE inline
+    void load_cache_modified(CacheModifiedInputIterator<MODIFIER, ValueType, OffsetT> block_iter,
+                             T (&items)[ITEMS_PER_THREAD],
+                             std::true_type /* vectorize */)
+    {
+        LoadDirectBlockedVectorized<MODIFIER>(RowMajorTid(BLOCK_DIM_X, BLOCK_DIM_Y, BLOCK_DIM_Z),
+                                              const_cast<T*>(block_iter.ptr),
+                                              items);
+    }
+
+    template<class InputIteratorT>
+    HIPCUB_DEVICE inline
+    void load_cache_modified(InputIteratorT block_iter,
+                             T (&items)[ITEMS_PER_THREAD],
+                             std::false_type /* vectorize */)
+    {
+        base_type::load(block_iter, items, temp_storage_);
+    }
+
     HIPCUB_DEVICE inline
     TempStorage& private_storage()
     {
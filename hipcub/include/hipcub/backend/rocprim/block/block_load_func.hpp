@@ -30,8 +30,13 @@
 #ifndef HIPCUB_ROCPRIM_BLOCK_BLOCK_LOAD_FUNC_HPP_
 #define HIPCUB_ROCPRIM_BLOCK_BLOCK_LOAD_FUNC_HPP_
 
+#include <cstdint>
+#include <type_traits>
+
 #include "../../../config.hpp"
 
+#include "../../../thread/thread_load.hpp"
+
 #include <rocprim/block/block_load_func.hpp>
 
 BEGIN_HIPCUB_NAMESPACE
@@ -99,6 +104,91 @@ void LoadDirectBlockedVectorized(int linear_id,
     );
 }
 
+namespace detail
+{
+
+// Widest dword vector that evenly divides the bytes of a thread's items, or void if they
+// are not a whole number of dwords.
+template<typename T, int ITEMS_PER_THREAD>
+struct load_blocked_vector_word
+{
+    static constexpr size_t bytes = sizeof(T) * ITEMS_PER_THREAD;
+
+    using type = typename std::conditional<
+        bytes % sizeof(uint4) == 0,
+        uint4,
+        typename std::conditional<
+            bytes % sizeof(uint2) == 0,
+            uint2,
+            typename std::conditional<bytes % sizeof(unsigned int) == 0, unsigned int, void>::
+                type>::type>::type;
+};
+
+template<CacheLoadModifier MODIFIER, typename T, int ITEMS_PER_THREAD>
+HIPCUB_DEVICE inline
+void load_direct_blocked_vectorized(int linear_id,
+                                    T* block_ptr,
+                                    T (&items)[ITEMS_PER_THREAD],
+                                    std::false_type /* has_vector_word */)
+{
+    T* thread_ptr = block_ptr + linear_id * ITEMS_PER_THREAD;
+    #pragma unroll
+    for(int i = 0; i < ITEMS_PER_THREAD; i++)
+    {
+        items[i] = ThreadLoad<MODIFIER>(thread_ptr + i);
+    }
+}
+
+template<CacheLoadModifier MODIFIER, typename T, int ITEMS_PER_THREAD>
+HIPCUB_DEVICE inline
+void load_direct_blocked_vectorized(int linear_id,
+                                    T* block_ptr,
+                                    T (&items)[ITEMS_PER_THREAD],
+                                    std::true_type /* has_vector_word */)
+{
+    using word_type = typename load_blocked_vector_word<T, ITEMS_PER_THREAD>::type;
+    constexpr int words_per_thread = sizeof(T) * ITEMS_PER_THREAD / sizeof(word_type);
+
+    // Each thread's items start a whole number of words after block_ptr, so block_ptr decides
+    // the alignment of every thread (like CUB, fall back to item loads if it is unaligned)
+    if(reinterpret_cast<uintptr_t>(block_ptr) % sizeof(word_type) != 0)
+    {
+        load_direct_blocked_vectorized<MODIFIER>(linear_id, block_ptr, items, std::false_type());
+        return;
+    }
+
+    word_type* thread_ptr = reinterpret_cast<word_type*>(block_ptr + linear_id * ITEMS_PER_THREAD);
+    word_type  words[words_per_thread];
+    #pragma unroll
+    for(int i = 0; i < words_per_thread; i++)
+    {
+        words[i] = ThreadLoad<MODIFIER>(thread_ptr + i);
+    }
+    __builtin_memcpy(items, words, sizeof(items));
+}
+
+} // namespace detail
+
+/// Loads a blocked arrangement of items with the cache modifier \p MODIFIER, using the
+/// widest 32-, 64- or 128-bit loads that tile each thread's items. If \p block_ptr is not
+/// aligned to that load size, the items are loaded one at a time.
+template<
+    CacheLoadModifier MODIFIER,
+    typename T,
+    int ITEMS_PER_THREAD
+>
+HIPCUB_DEVICE inline
+void LoadDirectBlockedVectorized(int linear_id,
+                                 T* block_ptr,
+                                 T (&items)[ITEMS_PER_THREAD])
+{
+    using word_type = typename detail::load_blocked_vector_word<T, ITEMS_PER_THREAD>::type;
+    detail::load_direct_blocked_vectorized<MODIFIER>(
+        linear_id, block_ptr, items,
+        std::integral_constant<bool, !std::is_void<word_type>::value>()
+    );
+}
+
 template<
     int BLOCK_THREADS,
     typename T,
@@ -32,6 +32,8 @@
 
 #include <type_traits>
 
+#include "../thread/thread_reduce.hpp"
+
 #include <rocprim/block/block_reduce.hpp>
 
 BEGIN_HIPCUB_NAMESPACE
@@ -122,9 +124,7 @@ public:
     HIPCUB_DEVICE inline
     T Sum(T(&input)[ITEMS_PER_THREAD])
     {
-        T output;
-        base_type::reduce(input, output, temp_storage_);
-        return output;
+        return Reduce(input, ::hipcub::Sum());
     }
 
     template<typename ReduceOp>
@@ -146,13 +146,35 @@ public:
     template<int ITEMS_PER_THREAD, typename ReduceOp>
     HIPCUB_DEVICE inline
     T Reduce(T(&input)[ITEMS_PER_THREAD], ReduceOp reduce_op)
+    {
+        return reduce_items(
+            input,
+            reduce_op,
+            std::integral_constant<bool, detail::is_widened_thread_reduce<T, ReduceOp>::value>{});
+    }
+
+private:
+    // 16-bit floats reduced with Sum, Max or Min are reduced in float within each thread.
+    // The block-wide step stays in T, so that TempStorage does not depend on the operator.
+    template<int ITEMS_PER_THREAD, typename ReduceOp>
+    HIPCUB_DEVICE inline
+    T reduce_items(T(&input)[ITEMS_PER_THREAD], ReduceOp reduce_op, std::true_type /*widened*/)
+    {
+        T output
+            = static_cast<T>(detail::thread_reduce_widened<ITEMS_PER_THREAD>(input, reduce_op));
+        base_type::reduce(output, output, temp_storage_, reduce_op);
+        return output;
+    }
+
+    template<int ITEMS_PER_THREAD, typename ReduceOp>
+    HIPCUB_DEVICE inline
+    T reduce_items(T(&input)[ITEMS_PER_THREAD], ReduceOp reduce_op, std::false_type /*widened*/)
     {
         T output;
         base_type::reduce(input, output, temp_storage_, reduce_op);
         return output;
     }
 
-private:
     HIPCUB_DEVICE inline
     TempStorage& private_storage()
     {
@@ -83,7 +83,8 @@ struct RadixSortTwiddle
     sort. For all other sorting implementations in CUB, both are always mapped
     to +0.0f. Since bit patterns for both -0.0f and +0.0f are next to each other
     and only one of them is used, the sorting works correctly. For double, the
-    same applies, but with 64-bit patterns.
+    same applies, but with 64-bit patterns, and for fp8_e4m3 and fp8_e5m2 with
+    8-bit patterns (-0.0 is 0x80, twiddled to 0x7f).
 */
     template <typename KeyT>
     struct BaseDigitExtractor
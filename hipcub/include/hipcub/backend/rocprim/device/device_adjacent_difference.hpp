@@ -30,6 +30,8 @@
 #define HIPCUB_ROCPRIM_DEVICE_DEVICE_ADJACENT_DIFFERENCE_HPP_
 
 #include "../../../config.hpp"
+#include "../../../util_launch_recorder_fwd.hpp"
+#include "../../../util_trace.hpp"
 
 #include <hipcub/thread/thread_operators.hpp>
 #include <rocprim/device/device_adjacent_difference.hpp>
@@ -51,10 +53,18 @@ struct DeviceAdjacentDifference
                                                                hipStream_t     stream        = 0,
                                                                bool debug_synchronous = false)
     {
-        return ::rocprim::adjacent_difference(
-            d_temp_storage, temp_storage_bytes, d_input, d_output,
-            num_items, difference_op, stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceAdjacentDifference::SubtractLeftCopy",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::adjacent_difference(
+                d_temp_storage, temp_storage_bytes, d_input, d_output,
+                num_items, difference_op,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template<typename RandomAccessIteratorT,
@@ -68,10 +78,18 @@ struct DeviceAdjacentDifference
                                                            hipStream_t           stream        = 0,
                                                            bool debug_synchronous = false)
     {
-        return ::rocprim::adjacent_difference_inplace(
-            d_temp_storage, temp_storage_bytes, d_input,
-            num_items, difference_op, stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceAdjacentDifference::SubtractLeft",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::adjacent_difference_inplace(
+                d_temp_storage, temp_storage_bytes, d_input,
+                num_items, difference_op,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template<typename InputIteratorT,
@@ -87,10 +105,18 @@ struct DeviceAdjacentDifference
                                                                 hipStream_t     stream        = 0,
                                                                 bool debug_synchronous = false)
     {
-        return ::rocprim::adjacent_difference_right(
-            d_temp_storage, temp_storage_bytes, d_input, d_output,
-            num_items, difference_op, stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceAdjacentDifference::SubtractRightCopy",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::adjacent_difference_right(
+                d_temp_storage, temp_storage_bytes, d_input, d_output,
+                num_items, difference_op,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template<typename RandomAccessIteratorT,
@@ -104,10 +130,18 @@ struct DeviceAdjacentDifference
                                                             hipStream_t   stream            = 0,
                                                             bool          debug_synchronous = false)
     {
-        return ::rocprim::adjacent_difference_right_inplace(
-            d_temp_storage, temp_storage_bytes, d_input,
-            num_items, difference_op, stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceAdjacentDifference::SubtractRight",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::adjacent_difference_right_inplace(
+                d_temp_storage, temp_storage_bytes, d_input,
+                num_items, difference_op,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 };
 
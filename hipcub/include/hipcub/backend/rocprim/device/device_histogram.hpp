@@ -31,6 +31,8 @@
 #define HIPCUB_ROCPRIM_DEVICE_DEVICE_HISTOGRAM_HPP_
 
 #include "../../../config.hpp"
+#include "../../../util_launch_recorder_fwd.hpp"
+#include "../../../util_trace.hpp"
 
 #include "../util_type.hpp"
 
@@ -58,13 +60,20 @@ struct DeviceHistogram
                              hipStream_t stream = 0,
                              bool debug_synchronous = false)
     {
-        return ::rocprim::histogram_even(
-            d_temp_storage, temp_storage_bytes,
-            d_samples, num_samples,
-            d_histogram,
-            num_levels, lower_level, upper_level,
-            stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceHistogram::HistogramEven",
+                                  num_samples,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::histogram_even(
+                d_temp_storage, temp_storage_bytes,
+                d_samples, num_samples,
+                d_histogram,
+                num_levels, lower_level, upper_level,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template<
@@ -87,13 +96,20 @@ struct DeviceHistogram
                              hipStream_t stream = 0,
                              bool debug_synchronous = false)
     {
-        return ::rocprim::histogram_even(
-            d_temp_storage, temp_storage_bytes,
-            d_samples, num_row_samples, num_rows, row_stride_bytes,
-            d_histogram,
-            num_levels, lower_level, upper_level,
-            stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceHistogram::HistogramEven",
+                                  size_t(num_row_samples) * num_rows,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::histogram_even(
+                d_temp_storage, temp_storage_bytes,
+                d_samples, num_row_samples, num_rows, row_stride_bytes,
+                d_histogram,
+                num_levels, lower_level, upper_level,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template<
@@ -116,18 +132,25 @@ struct DeviceHistogram
                                   hipStream_t stream = 0,
                                   bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceHistogram::MultiHistogramEven",
+                                  num_pixels,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         unsigned int levels[NUM_ACTIVE_CHANNELS];
         for(unsigned int channel = 0; channel < NUM_ACTIVE_CHANNELS; channel++)
         {
             levels[channel] = num_levels[channel];
         }
-        return ::rocprim::multi_histogram_even<NUM_CHANNELS, NUM_ACTIVE_CHANNELS>(
-            d_temp_storage, temp_storage_bytes,
-            d_samples, num_pixels,
-            d_histogram,
-            levels, lower_level, upper_level,
-            stream, debug_synchronous
-        );
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::multi_histogram_even<NUM_CHANNELS, NUM_ACTIVE_CHANNELS>(
+                d_temp_storage, temp_storage_bytes,
+                d_samples, num_pixels,
+                d_histogram,
+                levels, lower_level, upper_level,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template<
@@ -152,18 +175,25 @@ struct DeviceHistogram
                                   hipStream_t stream = 0,
                                   bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceHistogram::MultiHistogramEven",
+                                  size_t(num_row_pixels) * num_rows,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         unsigned int levels[NUM_ACTIVE_CHANNELS];
         for(unsigned int channel = 0; channel < NUM_ACTIVE_CHANNELS; channel++)
         {
             levels[channel] = num_levels[channel];
         }
-        return ::rocprim::multi_histogram_even<NUM_CHANNELS, NUM_ACTIVE_CHANNELS>(
-            d_temp_storage, temp_storage_bytes,
-            d_samples, num_row_pixels, num_rows, row_stride_bytes,
-            d_histogram,
-            levels, lower_level, upper_level,
-            stream, debug_synchronous
-        );
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::multi_histogram_even<NUM_CHANNELS, NUM_ACTIVE_CHANNELS>(
+                d_temp_storage, temp_storage_bytes,
+                d_samples, num_row_pixels, num_rows, row_stride_bytes,
+                d_histogram,
+                levels, lower_level, upper_level,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template<
@@ -183,13 +213,20 @@ struct DeviceHistogram
                               hipStream_t stream = 0,
                               bool debug_synchronous = false)
     {
-        return ::rocprim::histogram_range(
-            d_temp_storage, temp_storage_bytes,
-            d_samples, num_samples,
-            d_histogram,
-            num_levels, d_levels,
-            stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceHistogram::HistogramRange",
+                                  num_samples,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::histogram_range(
+                d_temp_storage, temp_storage_bytes,
+                d_samples, num_samples,
+                d_histogram,
+                num_levels, d_levels,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template<
@@ -211,13 +248,20 @@ struct DeviceHistogram
                               hipStream_t stream = 0,
                               bool debug_synchronous = false)
     {
-        return ::rocprim::histogram_range(
-            d_temp_storage, temp_storage_bytes,
-            d_samples, num_row_samples, num_rows, row_stride_bytes,
-            d_histogram,
-            num_levels, d_levels,
-            stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceHistogram::HistogramRange",
+                                  size_t(num_row_samples) * num_rows,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::histogram_range(
+                d_temp_storage, temp_storage_bytes,
+                d_samples, num_row_samples, num_rows, row_stride_bytes,
+                d_histogram,
+                num_levels, d_levels,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template<
@@ -239,18 +283,25 @@ struct DeviceHistogram
                                    hipStream_t stream = 0,
                                    bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceHistogram::MultiHistogramRange",
+                                  num_pixels,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         unsigned int levels[NUM_ACTIVE_CHANNELS];
         for(unsigned int channel = 0; channel < NUM_ACTIVE_CHANNELS; channel++)
         {
             levels[channel] = num_levels[channel];
         }
-        return ::rocprim::multi_histogram_range<NUM_CHANNELS, NUM_ACTIVE_CHANNELS>(
-            d_temp_storage, temp_storage_bytes,
-            d_samples, num_pixels,
-            d_histogram,
-            levels, d_levels,
-            stream, debug_synchronous
-        );
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::multi_histogram_range<NUM_CHANNELS, NUM_ACTIVE_CHANNELS>(
+                d_temp_storage, temp_storage_bytes,
+                d_samples, num_pixels,
+                d_histogram,
+                levels, d_levels,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template<
@@ -274,18 +325,25 @@ struct DeviceHistogram
                                    hipStream_t stream = 0,
                                    bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceHistogram::MultiHistogramRange",
+                                  size_t(num_row_pixels) * num_rows,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         unsigned int levels[NUM_ACTIVE_CHANNELS];
         for(unsigned int channel = 0; channel < NUM_ACTIVE_CHANNELS; channel++)
         {
             levels[channel] = num_levels[channel];
         }
-        return ::rocprim::multi_histogram_range<NUM_CHANNELS, NUM_ACTIVE_CHANNELS>(
-            d_temp_storage, temp_storage_bytes,
-            d_samples, num_row_pixels, num_rows, row_stride_bytes,
-            d_histogram,
-            levels, d_levels,
-            stream, debug_synchronous
-        );
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::multi_histogram_range<NUM_CHANNELS, NUM_ACTIVE_CHANNELS>(
+                d_temp_storage, temp_storage_bytes,
+                d_samples, num_row_pixels, num_rows, row_stride_bytes,
+                d_histogram,
+                levels, d_levels,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 };
 
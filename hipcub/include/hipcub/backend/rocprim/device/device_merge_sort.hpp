@@ -31,6 +31,8 @@
 #define HIPCUB_ROCPRIM_DEVICE_DEVICE_MERGE_SORT_HPP_
 
 #include "../../../config.hpp"
+#include "../../../util_launch_recorder_fwd.hpp"
+#include "../../../util_trace.hpp"
 
 #include "../util_type.hpp"
 
@@ -50,16 +52,23 @@ struct DeviceMergeSort
                                                         hipStream_t    stream            = 0,
                                                         bool           debug_synchronous = false)
     {
-        return ::rocprim::merge_sort(d_temp_storage,
-                                     temp_storage_bytes,
-                                     d_keys,
-                                     d_keys,
-                                     d_items,
-                                     d_items,
-                                     num_items,
-                                     compare_op,
-                                     stream,
-                                     debug_synchronous);
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceMergeSort::SortPairs",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::merge_sort(d_temp_storage,
+                                  temp_storage_bytes,
+                                  d_keys,
+                                  d_keys,
+                                  d_items,
+                                  d_items,
+                                  num_items,
+                                  compare_op,
+                                  stream,
+                                  detail::rocprim_debug_synchronous(debug_synchronous)),
+            stream, debug_synchronous);
     }
 
     template<typename KeyInputIteratorT,
@@ -79,16 +88,23 @@ struct DeviceMergeSort
                                                             hipStream_t         stream = 0,
                                                             bool debug_synchronous     = false)
     {
-        return ::rocprim::merge_sort(d_temp_storage,
-                                     temp_storage_bytes,
-                                     d_input_keys,
-                                     d_output_keys,
-                                     d_input_items,
-                                     d_output_items,
-                                     num_items,
-                                     compare_op,
-                                     stream,
-                                     debug_synchronous);
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceMergeSort::SortPairsCopy",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::merge_sort(d_temp_storage,
+                                  temp_storage_bytes,
+                                  d_input_keys,
+                                  d_output_keys,
+                                  d_input_items,
+                                  d_output_items,
+                                  num_items,
+                                  compare_op,
+                                  stream,
+                                  detail::rocprim_debug_synchronous(debug_synchronous)),
+            stream, debug_synchronous);
     }
 
     template<typename KeyIteratorT, typename OffsetT, typename CompareOpT>
@@ -100,11 +116,18 @@ struct DeviceMergeSort
                                                        hipStream_t   stream            = 0,
                                                        bool          debug_synchronous = false)
     {
-        return ::rocprim::merge_sort(
-            d_temp_storage, temp_storage_bytes,
-            d_keys, d_keys, num_items,
-            compare_op, stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceMergeSort::SortKeys",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::merge_sort(
+                d_temp_storage, temp_storage_bytes,
+                d_keys, d_keys, num_items,
+                compare_op, stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template<typename KeyInputIteratorT,
@@ -121,11 +144,18 @@ struct DeviceMergeSort
                                                            bool debug_synchronous = false)
 
     {
-        return ::rocprim::merge_sort(
-            d_temp_storage, temp_storage_bytes,
-            d_input_keys, d_output_keys, num_items,
-            compare_op, stream, debug_synchronous
-            );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceMergeSort::SortKeysCopy",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::merge_sort(
+                d_temp_storage, temp_storage_bytes,
+                d_input_keys, d_output_keys, num_items,
+                compare_op, stream, detail::rocprim_debug_synchronous(debug_synchronous)
+                ),
+            stream, debug_synchronous);
     }
 
     template <typename KeyIteratorT,
@@ -142,16 +172,23 @@ struct DeviceMergeSort
                     hipStream_t stream = 0,
                     bool debug_synchronous = false)
     {
-        return ::rocprim::merge_sort(d_temp_storage,
-                                     temp_storage_bytes,
-                                     d_keys,
-                                     d_keys,
-                                     d_items,
-                                     d_items,
-                                     num_items,
-                                     compare_op,
-                                     stream,
-                                     debug_synchronous);
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceMergeSort::StableSortPairs",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::merge_sort(d_temp_storage,
+                                  temp_storage_bytes,
+                                  d_keys,
+                                  d_keys,
+                                  d_items,
+                                  d_items,
+                                  num_items,
+                                  compare_op,
+                                  stream,
+                                  detail::rocprim_debug_synchronous(debug_synchronous)),
+            stream, debug_synchronous);
     }
 
     template<typename KeyIteratorT, typename OffsetT, typename CompareOpT>
@@ -163,11 +200,18 @@ struct DeviceMergeSort
                                                              hipStream_t   stream   = 0,
                                                              bool debug_synchronous = false)
     {
-        return ::rocprim::merge_sort(
-            d_temp_storage, temp_storage_bytes,
-            d_keys, d_keys, num_items,
-            compare_op, stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceMergeSort::StableSortKeys",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::merge_sort(
+                d_temp_storage, temp_storage_bytes,
+                d_keys, d_keys, num_items,
+                compare_op, stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template<typename KeyInputIteratorT,
@@ -183,14 +227,21 @@ struct DeviceMergeSort
                                                                  hipStream_t       stream = 0,
                                                                  bool debug_synchronous   = false)
     {
-        return ::rocprim::merge_sort(d_temp_storage,
-                                     temp_storage_bytes,
-                                     d_input_keys,
-                                     d_output_keys,
-                                     num_items,
-                                     compare_op,
-                                     stream,
-                                     debug_synchronous);
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceMergeSort::StableSortKeysCopy",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::merge_sort(d_temp_storage,
+                                  temp_storage_bytes,
+                                  d_input_keys,
+                                  d_output_keys,
+                                  num_items,
+                                  compare_op,
+                                  stream,
+                                  detail::rocprim_debug_synchronous(debug_synchronous)),
+            stream, debug_synchronous);
     }
 };
 END_HIPCUB_NAMESPACE
@@ -31,6 +31,8 @@
 #define HIPCUB_ROCPRIM_DEVICE_PARTITION_HPP_
 
 #include "../../../config.hpp"
+#include "../../../util_launch_recorder_fwd.hpp"
+#include "../../../util_trace.hpp"
 
 #include <rocprim/device/device_partition.hpp>
 
@@ -55,16 +57,23 @@ struct DevicePartition
         hipStream_t                 stream             = 0,         ///< [in] <b>[optional]</b> hip stream to launch kernels within.  Default is stream<sub>0</sub>.
         bool                        debug_synchronous  = false)     ///< [in] <b>[optional]</b> Whether or not to synchronize the stream after every kernel launch to check for errors.  May cause significant slowdown.  Default is \p false.
     {
-        return rocprim::partition(
-            d_temp_storage,
-            temp_storage_bytes,
-            d_in,
-            d_flags,
-            d_out,
-            d_num_selected_out,
-            num_items,
-            stream,
-            debug_synchronous);
+        HIPCUB_DETAIL_TRACE_SCOPE("DevicePartition::Flagged",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            rocprim::partition(
+                d_temp_storage,
+                temp_storage_bytes,
+                d_in,
+                d_flags,
+                d_out,
+                d_num_selected_out,
+                num_items,
+                stream,
+                detail::rocprim_debug_synchronous(debug_synchronous)),
+            stream, debug_synchronous);
     }
 
     template <
@@ -84,16 +93,23 @@ struct DevicePartition
         hipStream_t                 stream             = 0,         ///< [in] <b>[optional]</b> hip stream to launch kernels within.  Default is stream<sub>0</sub>.
         bool                        debug_synchronous  = false)     ///< [in] <b>[optional]</b> Whether or not to synchronize the stream after every kernel launch to check for errors.  May cause significant slowdown.  Default is \p false.
     {
-        return rocprim::partition(
-            d_temp_storage,
-            temp_storage_bytes,
-            d_in,
-            d_out,
-            d_num_selected_out,
-            num_items,
-            select_op,
-            stream,
-            debug_synchronous);
+        HIPCUB_DETAIL_TRACE_SCOPE("DevicePartition::If",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            rocprim::partition(
+                d_temp_storage,
+                temp_storage_bytes,
+                d_in,
+                d_out,
+                d_num_selected_out,
+                num_items,
+                select_op,
+                stream,
+                detail::rocprim_debug_synchronous(debug_synchronous)),
+            stream, debug_synchronous);
     }
     
     template <typename InputIteratorT,
@@ -117,20 +133,27 @@ struct DevicePartition
        hipStream_t stream     = 0,
        bool debug_synchronous = false)
     {
-        return rocprim::partition_three_way(
-            d_temp_storage,
-            temp_storage_bytes,
-            d_in,
-            d_first_part_out,
-            d_second_part_out,
-            d_unselected_out,
-            d_num_selected_out,
-            num_items,
-            select_first_part_op,
-            select_second_part_op,
-            stream,
-            debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DevicePartition::If",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            rocprim::partition_three_way(
+                d_temp_storage,
+                temp_storage_bytes,
+                d_in,
+                d_first_part_out,
+                d_second_part_out,
+                d_unselected_out,
+                d_num_selected_out,
+                num_items,
+                select_first_part_op,
+                select_second_part_op,
+                stream,
+                detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 };
 
@@ -31,14 +31,285 @@
 #define HIPCUB_ROCPRIM_DEVICE_DEVICE_RADIX_SORT_HPP_
 
 #include "../../../config.hpp"
+#include "../../../util_launch_recorder_fwd.hpp"
+#include "../../../util_trace.hpp"
 
 #include "../util_type.hpp"
+#include "device_tuned_config.hpp"
 
 #include <rocprim/device/device_radix_sort.hpp>
 
+#include <cstdint>
+
 BEGIN_HIPCUB_NAMESPACE
 
-struct DeviceRadixSort
+namespace detail
+{
+
+// The dispatch functions below are deliberately not inline, so that the explicit
+// instantiation declarations of HIPCUB_USE_INSTANTIATIONS suppress their
+// instantiation (and the instantiation of all rocPRIM kernels) in user code.
+
+template<class Config, class KeyT, class ValueT, class NumItemsT>
+HIPCUB_RUNTIME_FUNCTION
+hipError_t radix_sort_pairs(void*         d_temp_storage,
+                            size_t&       temp_storage_bytes,
+                            const KeyT*   d_keys_in,
+                            KeyT*         d_keys_out,
+                            const ValueT* d_values_in,
+                            ValueT*       d_values_out,
+                            NumItemsT     num_items,
+                            int           begin_bit,
+                            int           end_bit,
+                            hipStream_t   stream,
+                            bool          debug_synchronous)
+{
+    const bool debug_rocprim = rocprim_debug_synchronous(debug_synchronous);
+    return dispatch_tuned_config<Config,
+                                 tuned_algorithm::radix_sort,
+                                 sizeof(KeyT),
+                                 sizeof(ValueT)>(
+        num_items,
+        stream,
+        [&](auto config_tag)
+        {
+            using config = typename decltype(config_tag)::type;
+            return rocprim_debug_synchronize(
+                ::rocprim::radix_sort_pairs<config>(d_temp_storage, temp_storage_bytes,
+                                                    d_keys_in, d_keys_out,
+                                                    d_values_in, d_values_out, num_items,
+                                                    begin_bit, end_bit,
+                                                    stream, debug_rocprim),
+                stream, debug_synchronous);
+        });
+}
+
+template<class Config, class KeyT, class ValueT, class NumItemsT>
+HIPCUB_RUNTIME_FUNCTION
+hipError_t radix_sort_pairs(void*                             d_temp_storage,
+                            size_t&                           temp_storage_bytes,
+                            ::rocprim::double_buffer<KeyT>&   d_keys,
+                            ::rocprim::double_buffer<ValueT>& d_values,
+                            NumItemsT                         num_items,
+                            int                               begin_bit,
+                            int                               end_bit,
+                            hipStream_t                       stream,
+                            bool                              debug_synchronous)
+{
+    const bool debug_rocprim = rocprim_debug_synchronous(debug_synchronous);
+    return dispatch_tuned_config<Config,
+                                 tuned_algorithm::radix_sort,
+                                 sizeof(KeyT),
+                                 sizeof(ValueT)>(
+        num_items,
+        stream,
+        [&](auto config_tag)
+        {
+            using config = typename decltype(config_tag)::type;
+            return rocprim_debug_synchronize(
+                ::rocprim::radix_sort_pairs<config>(d_temp_storage, temp_storage_bytes,
+                                                    d_keys, d_values, num_items,
+                                                    begin_bit, end_bit,
+                                                    stream, debug_rocprim),
+                stream, debug_synchronous);
+        });
+}
+
+template<class Config, class KeyT, class ValueT, class NumItemsT>
+HIPCUB_RUNTIME_FUNCTION
+hipError_t radix_sort_pairs_desc(void*         d_temp_storage,
+                                 size_t&       temp_storage_bytes,
+                                 const KeyT*   d_keys_in,
+                                 KeyT*         d_keys_out,
+                                 const ValueT* d_values_in,
+                                 ValueT*       d_values_out,
+                                 NumItemsT     num_items,
+                                 int           begin_bit,
+                                 int           end_bit,
+                                 hipStream_t   stream,
+                                 bool          debug_synchronous)
+{
+    const bool debug_rocprim = rocprim_debug_synchronous(debug_synchronous);
+    return dispatch_tuned_config<Config,
+                                 tuned_algorithm::radix_sort,
+                                 sizeof(KeyT),
+                                 sizeof(ValueT)>(
+        num_items,
+        stream,
+        [&](auto config_tag)
+        {
+            using config = typename decltype(config_tag)::type;
+            return rocprim_debug_synchronize(
+                ::rocprim::radix_sort_pairs_desc<config>(d_temp_storage, temp_storage_bytes,
+                                                         d_keys_in, d_keys_out,
+                                                         d_values_in, d_values_out, num_items,
+                                                         begin_bit, end_bit,
+                                                         stream, debug_rocprim),
+                stream, debug_synchronous);
+        });
+}
+
+template<class Config, class KeyT, class ValueT, class NumItemsT>
+HIPCUB_RUNTIME_FUNCTION
+hipError_t radix_sort_pairs_desc(void*                             d_temp_storage,
+                                 size_t&                           temp_storage_bytes,
+                                 ::rocprim::double_buffer<KeyT>&   d_keys,
+                                 ::rocprim::double_buffer<ValueT>& d_values,
+                                 NumItemsT                         num_items,
+                                 int                               begin_bit,
+                                 int                               end_bit,
+                                 hipStream_t                       stream,
+                                 bool                              debug_synchronous)
+{
+    const bool debug_rocprim = rocprim_debug_synchronous(debug_synchronous);
+    return dispatch_tuned_config<Config,
+                                 tuned_algorithm::radix_sort,
+                                 sizeof(KeyT),
+                                 sizeof(ValueT)>(
+        num_items,
+        stream,
+        [&](auto config_tag)
+        {
+            using config = typename decltype(config_tag)::type;
+            return rocprim_debug_synchronize(
+                ::rocprim::radix_sort_pairs_desc<config>(d_temp_storage, temp_storage_bytes,
+                                                         d_keys, d_values, num_items,
+                                                         begin_bit, end_bit,
+                                                         stream, debug_rocprim),
+                stream, debug_synchronous);
+        });
+}
+
+template<class Config, class KeyT, class NumItemsT>
+HIPCUB_RUNTIME_FUNCTION
+hipError_t radix_sort_keys(void*       d_temp_storage,
+                           size_t&     temp_storage_bytes,
+                           const KeyT* d_keys_in,
+                           KeyT*       d_keys_out,
+                           NumItemsT   num_items,
+                           int         begin_bit,
+                           int         end_bit,
+                           hipStream_t stream,
+                           bool        debug_synchronous)
+{
+    const bool debug_rocprim = rocprim_debug_synchronous(debug_synchronous);
+    return dispatch_tuned_config<Config,
+                                 tuned_algorithm::radix_sort,
+                                 sizeof(KeyT),
+                                 0>(
+        num_items,
+        stream,
+        [&](auto config_tag)
+        {
+            using config = typename decltype(config_tag)::type;
+            return rocprim_debug_synchronize(
+                ::rocprim::radix_sort_keys<config>(d_temp_storage, temp_storage_bytes,
+                                                   d_keys_in, d_keys_out, num_items,
+                                                   begin_bit, end_bit,
+                                                   stream, debug_rocprim),
+                stream, debug_synchronous);
+        });
+}
+
+template<class Config, class KeyT, class NumItemsT>
+HIPCUB_RUNTIME_FUNCTION
+hipError_t radix_sort_keys(void*                           d_temp_storage,
+                           size_t&                         temp_storage_bytes,
+                           ::rocprim::double_buffer<KeyT>& d_keys,
+                           NumItemsT                       num_items,
+                           int                             begin_bit,
+                           int                             end_bit,
+                           hipStream_t                     stream,
+                           bool                            debug_synchronous)
+{
+    const bool debug_rocprim = rocprim_debug_synchronous(debug_synchronous);
+    return dispatch_tuned_config<Config,
+                                 tuned_algorithm::radix_sort,
+                                 sizeof(KeyT),
+                                 0>(
+        num_items,
+        stream,
+        [&](auto config_tag)
+        {
+            using config = typename decltype(config_tag)::type;
+            return rocprim_debug_synchronize(
+                ::rocprim::radix_sort_keys<config>(d_temp_storage, temp_storage_bytes,
+                                                   d_keys, num_items,
+                                                   begin_bit, end_bit,
+                                                   stream, debug_rocprim),
+                stream, debug_synchronous);
+        });
+}
+
+template<class Config, class KeyT, class NumItemsT>
+HIPCUB_RUNTIME_FUNCTION
+hipError_t radix_sort_keys_desc(void*       d_temp_storage,
+                                size_t&     temp_storage_bytes,
+                                const KeyT* d_keys_in,
+                                KeyT*       d_keys_out,
+                                NumItemsT   num_items,
+                                int         begin_bit,
+                                int         end_bit,
+                                hipStream_t stream,
+                                bool        debug_synchronous)
+{
+    const bool debug_rocprim = rocprim_debug_synchronous(debug_synchronous);
+    return dispatch_tuned_config<Config,
+                                 tuned_algorithm::radix_sort,
+                                 sizeof(KeyT),
+                                 0>(
+        num_items,
+        stream,
+        [&](auto config_tag)
+        {
+            using config = typename decltype(config_tag)::type;
+            return rocprim_debug_synchronize(
+                ::rocprim::radix_sort_keys_desc<config>(d_temp_storage, temp_storage_bytes,
+                                                        d_keys_in, d_keys_out, num_items,
+                                                        begin_bit, end_bit,
+                                                        stream, debug_rocprim),
+                stream, debug_synchronous);
+        });
+}
+
+template<class Config, class KeyT, class NumItemsT>
+HIPCUB_RUNTIME_FUNCTION
+hipError_t radix_sort_keys_desc(void*                           d_temp_storage,
+                                size_t&                         temp_storage_bytes,
+                                ::rocprim::double_buffer<KeyT>& d_keys,
+                                NumItemsT                       num_items,
+                                int                             begin_bit,
+                                int                             end_bit,
+                                hipStream_t                     stream,
+                                bool                            debug_synchronous)
+{
+    const bool debug_rocprim = rocprim_debug_synchronous(debug_synchronous);
+    return dispatch_tuned_config<Config,
+                                 tuned_algorithm::radix_sort,
+                                 sizeof(KeyT),
+                                 0>(
+        num_items,
+        stream,
+        [&](auto config_tag)
+        {
+            using config = typename decltype(config_tag)::type;
+            return rocprim_debug_synchronize(
+                ::rocprim::radix_sort_keys_desc<config>(d_temp_storage, temp_storage_bytes,
+                                                        d_keys, num_items,
+                                                        begin_bit, end_bit,
+                                                        stream, debug_rocprim),
+                stream, debug_synchronous);
+        });
+}
+
+} // namespace detail
+
+/// \brief DeviceRadixSort with a user provided rocPRIM configuration.
+///
+/// \tparam Config - ::rocprim::radix_sort_config used by all sorting functions.
+/// This is an extension of the rocPRIM backend and is not available with CUB.
+template<class Config = ::rocprim::default_config>
+struct DeviceRadixSortWithConfig
 {
     template<typename KeyT, typename ValueT, typename NumItemsT>
     HIPCUB_RUNTIME_FUNCTION static
@@ -54,7 +325,12 @@ struct DeviceRadixSort
                          hipStream_t stream = 0,
                          bool debug_synchronous = false)
     {
-        return ::rocprim::radix_sort_pairs(
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceRadixSort::SortPairs",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::radix_sort_pairs<Config, KeyT, ValueT, NumItemsT>(
             d_temp_storage, temp_storage_bytes,
             d_keys_in, d_keys_out, d_values_in, d_values_out, num_items,
             begin_bit, end_bit,
@@ -74,9 +350,14 @@ struct DeviceRadixSort
                          hipStream_t stream = 0,
                          bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceRadixSort::SortPairs",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         ::rocprim::double_buffer<KeyT> d_keys_db = detail::to_double_buffer(d_keys);
         ::rocprim::double_buffer<ValueT> d_values_db = detail::to_double_buffer(d_values);
-        hipError_t error = ::rocprim::radix_sort_pairs(
+        hipError_t error = detail::radix_sort_pairs<Config, KeyT, ValueT, NumItemsT>(
             d_temp_storage, temp_storage_bytes,
             d_keys_db, d_values_db, num_items,
             begin_bit, end_bit,
@@ -101,7 +382,12 @@ struct DeviceRadixSort
                                    hipStream_t stream = 0,
                                    bool debug_synchronous = false)
     {
-        return ::rocprim::radix_sort_pairs_desc(
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceRadixSort::SortPairsDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::radix_sort_pairs_desc<Config, KeyT, ValueT, NumItemsT>(
             d_temp_storage, temp_storage_bytes,
             d_keys_in, d_keys_out, d_values_in, d_values_out, num_items,
             begin_bit, end_bit,
@@ -121,9 +407,14 @@ struct DeviceRadixSort
                                    hipStream_t stream = 0,
                                    bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceRadixSort::SortPairsDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         ::rocprim::double_buffer<KeyT> d_keys_db = detail::to_double_buffer(d_keys);
         ::rocprim::double_buffer<ValueT> d_values_db = detail::to_double_buffer(d_values);
-        hipError_t error = ::rocprim::radix_sort_pairs_desc(
+        hipError_t error = detail::radix_sort_pairs_desc<Config, KeyT, ValueT, NumItemsT>(
             d_temp_storage, temp_storage_bytes,
             d_keys_db, d_values_db, num_items,
             begin_bit, end_bit,
@@ -146,7 +437,12 @@ struct DeviceRadixSort
                         hipStream_t stream = 0,
                         bool debug_synchronous = false)
     {
-        return ::rocprim::radix_sort_keys(
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceRadixSort::SortKeys",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::radix_sort_keys<Config, KeyT, NumItemsT>(
             d_temp_storage, temp_storage_bytes,
             d_keys_in, d_keys_out, num_items,
             begin_bit, end_bit,
@@ -165,8 +461,13 @@ struct DeviceRadixSort
                         hipStream_t stream = 0,
                         bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceRadixSort::SortKeys",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         ::rocprim::double_buffer<KeyT> d_keys_db = detail::to_double_buffer(d_keys);
-        hipError_t error = ::rocprim::radix_sort_keys(
+        hipError_t error = detail::radix_sort_keys<Config, KeyT, NumItemsT>(
             d_temp_storage, temp_storage_bytes,
             d_keys_db, num_items,
             begin_bit, end_bit,
@@ -188,7 +489,12 @@ struct DeviceRadixSort
                                   hipStream_t stream = 0,
                                   bool debug_synchronous = false)
     {
-        return ::rocprim::radix_sort_keys_desc(
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceRadixSort::SortKeysDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::radix_sort_keys_desc<Config, KeyT, NumItemsT>(
             d_temp_storage, temp_storage_bytes,
             d_keys_in, d_keys_out, num_items,
             begin_bit, end_bit,
@@ -207,8 +513,13 @@ struct DeviceRadixSort
                                   hipStream_t stream = 0,
                                   bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceRadixSort::SortKeysDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         ::rocprim::double_buffer<KeyT> d_keys_db = detail::to_double_buffer(d_keys);
-        hipError_t error = ::rocprim::radix_sort_keys_desc(
+        hipError_t error = detail::radix_sort_keys_desc<Config, KeyT, NumItemsT>(
             d_temp_storage, temp_storage_bytes,
             d_keys_db, num_items,
             begin_bit, end_bit,
@@ -219,6 +530,68 @@ struct DeviceRadixSort
     }
 };
 
+struct DeviceRadixSort : DeviceRadixSortWithConfig<>
+{};
+
+// Explicit instantiations of the DeviceRadixSort dispatch for common key, value and
+// size types. With HIPCUB_USE_INSTANTIATIONS (set by linking hipcub_instantiations)
+// they are declared extern here and defined once in the library.
+#define HIPCUB_DETAIL_RADIX_SORT_KEYS_INSTANTIATION(EXTERN, KeyT, NumItemsT)                   \
+    EXTERN template hipError_t                                                                 \
+        detail::radix_sort_keys<::rocprim::default_config, KeyT, NumItemsT>(                   \
+            void*, size_t&, const KeyT*, KeyT*, NumItemsT, int, int, hipStream_t, bool);       \
+    EXTERN template hipError_t                                                                 \
+        detail::radix_sort_keys<::rocprim::default_config, KeyT, NumItemsT>(                   \
+            void*, size_t&, ::rocprim::double_buffer<KeyT>&, NumItemsT, int, int, hipStream_t, \
+            bool);                                                                             \
+    EXTERN template hipError_t                                                                 \
+        detail::radix_sort_keys_desc<::rocprim::default_config, KeyT, NumItemsT>(              \
+            void*, size_t&, const KeyT*, KeyT*, NumItemsT, int, int, hipStream_t, bool);       \
+    EXTERN template hipError_t                                                                 \
+        detail::radix_sort_keys_desc<::rocprim::default_config, KeyT, NumItemsT>(              \
+            void*, size_t&, ::rocprim::double_buffer<KeyT>&, NumItemsT, int, int, hipStream_t, \
+            bool);
+
+#define HIPCUB_DETAIL_RADIX_SORT_PAIRS_INSTANTIATION(EXTERN, KeyT, ValueT, NumItemsT)          \
+    EXTERN template hipError_t                                                                 \
+        detail::radix_sort_pairs<::rocprim::default_config, KeyT, ValueT, NumItemsT>(          \
+            void*, size_t&, const KeyT*, KeyT*, const ValueT*, ValueT*, NumItemsT, int, int,   \
+            hipStream_t, bool);                                                                \
+    EXTERN template hipError_t                                                                 \
+        detail::radix_sort_pairs<::rocprim::default_config, KeyT, ValueT, NumItemsT>(          \
+            void*, size_t&, ::rocprim::double_buffer<KeyT>&, ::rocprim::double_buffer<ValueT>&, \
+            NumItemsT, int, int, hipStream_t, bool);                                           \
+    EXTERN template hipError_t                                                                 \
+        detail::radix_sort_pairs_desc<::rocprim::default_config, KeyT, ValueT, NumItemsT>(     \
+            void*, size_t&, const KeyT*, KeyT*, const ValueT*, ValueT*, NumItemsT, int, int,   \
+            hipStream_t, bool);                                                                \
+    EXTERN template hipError_t                                                                 \
+        detail::radix_sort_pairs_desc<::rocprim::default_config, KeyT, ValueT, NumItemsT>(     \
+            void*, size_t&, ::rocprim::double_buffer<KeyT>&, ::rocprim::double_buffer<ValueT>&, \
+            NumItemsT, int, int, hipStream_t, bool);
+
+#define HIPCUB_DETAIL_RADIX_SORT_KEY_INSTANTIATIONS(EXTERN, KeyT, NumItemsT)        \
+    HIPCUB_DETAIL_RADIX_SORT_KEYS_INSTANTIATION(EXTERN, KeyT, NumItemsT)            \
+    HIPCUB_DETAIL_RADIX_SORT_PAIRS_INSTANTIATION(EXTERN, KeyT, int32_t, NumItemsT)  \
+    HIPCUB_DETAIL_RADIX_SORT_PAIRS_INSTANTIATION(EXTERN, KeyT, uint32_t, NumItemsT)
+
+#define HIPCUB_DETAIL_RADIX_SORT_SIZE_INSTANTIATIONS(EXTERN, NumItemsT)      \
+    HIPCUB_DETAIL_RADIX_SORT_KEY_INSTANTIATIONS(EXTERN, int32_t, NumItemsT)  \
+    HIPCUB_DETAIL_RADIX_SORT_KEY_INSTANTIATIONS(EXTERN, uint32_t, NumItemsT) \
+    HIPCUB_DETAIL_RADIX_SORT_KEY_INSTANTIATIONS(EXTERN, int64_t, NumItemsT)  \
+    HIPCUB_DETAIL_RADIX_SORT_KEY_INSTANTIATIONS(EXTERN, uint64_t, NumItemsT) \
+    HIPCUB_DETAIL_RADIX_SORT_KEY_INSTANTIATIONS(EXTERN, float, NumItemsT)    \
+    HIPCUB_DETAIL_RADIX_SORT_KEY_INSTANTIATIONS(EXTERN, double, NumItemsT)
+
+#define HIPCUB_DETAIL_RADIX_SORT_INSTANTIATIONS(EXTERN)              \
+    HIPCUB_DETAIL_RADIX_SORT_SIZE_INSTANTIATIONS(EXTERN, int)          \
+    HIPCUB_DETAIL_RADIX_SORT_SIZE_INSTANTIATIONS(EXTERN, unsigned int) \
+    HIPCUB_DETAIL_RADIX_SORT_SIZE_INSTANTIATIONS(EXTERN, size_t)
+
+#ifdef HIPCUB_USE_INSTANTIATIONS
+HIPCUB_DETAIL_RADIX_SORT_INSTANTIATIONS(extern)
+#endif
+
 END_HIPCUB_NAMESPACE
 
 #endif // HIPCUB_ROCPRIM_DEVICE_DEVICE_RADIX_SORT_HPP_
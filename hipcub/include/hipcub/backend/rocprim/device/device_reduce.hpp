@@ -37,11 +37,17 @@
 #include <hip/hip_bfloat16.h> // hip_bfloat16
 
 #include "../../../config.hpp"
+#include "../../../util_launch_recorder_fwd.hpp"
+#include "../../../util_trace.hpp"
 #include "../iterator/arg_index_input_iterator.hpp"
 #include "../thread/thread_operators.hpp"
+#include "../util_type.hpp"
+#include "device_tuned_config.hpp"
 
 #include <rocprim/device/device_reduce.hpp>
 #include <rocprim/device/device_reduce_by_key.hpp>
+#include <rocprim/iterator/constant_iterator.hpp>
+#include <rocprim/iterator/transform_iterator.hpp>
 
 BEGIN_HIPCUB_NAMESPACE
 namespace detail
@@ -57,12 +63,26 @@ HIPCUB_HOST_DEVICE T set_half_bits(uint16_t value)
     return half_value;
 }
 
+// 8-bit floats are only declared when util_fp8.hpp is included, so they are selected with
+// is_fp8 instead of explicit specializations.
 template<class T>
-HIPCUB_HOST_DEVICE inline T get_lowest_value()
+HIPCUB_HOST_DEVICE inline T get_lowest_value(std::false_type /*is_fp8*/)
 {
     return std::numeric_limits<T>::lowest();
 }
 
+template<class T>
+HIPCUB_HOST_DEVICE inline T get_lowest_value(std::true_type /*is_fp8*/)
+{
+    return FpLimits<T>::Lowest();
+}
+
+template<class T>
+HIPCUB_HOST_DEVICE inline T get_lowest_value()
+{
+    return get_lowest_value<T>(is_fp8<T>{});
+}
+
 template<>
 HIPCUB_HOST_DEVICE inline __half get_lowest_value<__half>()
 {
@@ -77,12 +97,39 @@ HIPCUB_HOST_DEVICE inline hip_bfloat16 get_lowest_value<hip_bfloat16>()
     return set_half_bits<hip_bfloat16>(0xff7f);
 }
 
+#ifdef HIPCUB_IS_INT128_ENABLED
+// std::numeric_limits is not specialized for 128-bit integers in strict ISO mode.
+template<>
+HIPCUB_HOST_DEVICE inline __int128_t get_lowest_value<__int128_t>()
+{
+    return static_cast<__int128_t>(__uint128_t(1) << 127);
+}
+
+template<>
+HIPCUB_HOST_DEVICE inline __uint128_t get_lowest_value<__uint128_t>()
+{
+    return 0;
+}
+#endif
+
 template<class T>
-HIPCUB_HOST_DEVICE inline T get_max_value()
+HIPCUB_HOST_DEVICE inline T get_max_value(std::false_type /*is_fp8*/)
 {
     return std::numeric_limits<T>::max();
 }
 
+template<class T>
+HIPCUB_HOST_DEVICE inline T get_max_value(std::true_type /*is_fp8*/)
+{
+    return FpLimits<T>::Max();
+}
+
+template<class T>
+HIPCUB_HOST_DEVICE inline T get_max_value()
+{
+    return get_max_value<T>(is_fp8<T>{});
+}
+
 template<>
 HIPCUB_HOST_DEVICE inline __half get_max_value<__half>()
 {
@@ -97,10 +144,24 @@ HIPCUB_HOST_DEVICE inline hip_bfloat16 get_max_value<hip_bfloat16>()
     return set_half_bits<hip_bfloat16>(0x7f7f);
 }
 
+#ifdef HIPCUB_IS_INT128_ENABLED
+template<>
+HIPCUB_HOST_DEVICE inline __int128_t get_max_value<__int128_t>()
+{
+    return static_cast<__int128_t>(~__uint128_t(0) >> 1);
+}
+
+template<>
+HIPCUB_HOST_DEVICE inline __uint128_t get_max_value<__uint128_t>()
+{
+    return ~__uint128_t(0);
+}
+#endif
+
 /// Same as \p get_lowest_value, but includes negative infinity for floating-point types.
 template<class T>
 inline auto get_lowest_special_value() ->
-    typename std::enable_if_t<!rocprim::is_floating_point<T>::value, T>
+    typename std::enable_if_t<!rocprim::is_floating_point<T>::value && !is_fp8<T>::value, T>
 {
     return get_lowest_value<T>();
 }
@@ -113,6 +174,13 @@ inline auto get_lowest_special_value() ->
     return -std::numeric_limits<T>::infinity();
 }
 
+/// Negative infinity for E5M2. E4M3 has no infinity and saturates it to -448.
+template<class T>
+inline auto get_lowest_special_value() -> typename std::enable_if_t<is_fp8<T>::value, T>
+{
+    return T(-std::numeric_limits<float>::infinity());
+}
+
 template<>
 inline __half get_lowest_special_value<__half>()
 {
@@ -130,7 +198,7 @@ inline hip_bfloat16 get_lowest_special_value<hip_bfloat16>()
 /// Same as \p get_max_value, but includes positive infinity for floating-point types.
 template<typename T>
 inline auto get_max_special_value() ->
-    typename std::enable_if_t<!rocprim::is_floating_point<T>::value, T>
+    typename std::enable_if_t<!rocprim::is_floating_point<T>::value && !is_fp8<T>::value, T>
 {
     return get_max_value<T>();
 }
@@ -143,6 +211,13 @@ inline auto get_max_special_value() ->
     return std::numeric_limits<T>::infinity();
 }
 
+/// Positive infinity for E5M2. E4M3 has no infinity and saturates it to 448.
+template<typename T>
+inline auto get_max_special_value() -> typename std::enable_if_t<is_fp8<T>::value, T>
+{
+    return T(std::numeric_limits<float>::infinity());
+}
+
 template<>
 inline __half get_max_special_value<__half>()
 {
@@ -157,9 +232,165 @@ inline hip_bfloat16 get_max_special_value<hip_bfloat16>()
     return set_half_bits<hip_bfloat16>(0x7f80);
 }
 
+/// Values of at most 32 bits can be packed with their index into one 64-bit word for
+/// \p ArgMinPacked and \p ArgMaxPacked.
+template<class T>
+struct is_arg_minmax_packable
+    : std::integral_constant<bool,
+                             sizeof(T) <= sizeof(unsigned int)
+                                 && NumericTraits<T>::CATEGORY != NOT_A_NUMBER>
+{};
+
+/// Initial value of the packed reduction. Its index field decodes to <tt>0xFFFFFFFF</tt>, which
+/// no item of an \p int indexed input has, so it is only ever written for empty inputs.
+template<bool Max>
+HIPCUB_HOST_DEVICE inline constexpr unsigned long long arg_minmax_packed_identity()
+{
+    return Max ? 0ull : ~0ull;
+}
+
+/// Encodes a (index, value) pair as <tt>ordered value bits << 32 | index</tt>, so that the
+/// arg-min is the minimum word. For the arg-max the index is complemented, so that the maximum
+/// word still has the lowest index among equal values.
+template<bool Max, class OffsetT, class T>
+struct arg_minmax_packed_encode
+{
+    HIPCUB_HOST_DEVICE inline
+    unsigned long long operator()(const KeyValuePair<OffsetT, T>& pair) const
+    {
+        using traits        = NumericTraits<T>;
+        using unsigned_bits = typename traits::UnsignedBits;
+
+        unsigned_bits bits;
+        __builtin_memcpy(&bits, &pair.value, sizeof(bits));
+        // -0.0 and +0.0 compare equal, so they must tie and be resolved by the index
+        const unsigned_bits sign_bit = unsigned_bits(1) << (sizeof(unsigned_bits) * 8 - 1);
+        if(traits::CATEGORY == FLOATING_POINT && (bits & ~sign_bit) == 0)
+        {
+            bits = 0;
+        }
+
+        const unsigned long long ordered = traits::TwiddleIn(bits);
+        const unsigned int       index   = static_cast<unsigned int>(pair.key);
+        return (ordered << 32) | (Max ? ~index : index);
+    }
+};
+
+/// Assigning a packed word writes the (index, value) pair it encodes, with the value read back
+/// from the input so that it is bit-exact, and the index relative to \p begin_offset. The
+/// identity word is only written for empty inputs and segments, which get \p empty_value.
+template<bool Max, class OutputIteratorT, class InputIteratorT, class OutputTupleT>
+class arg_minmax_packed_reference
+{
+    using key_type = typename OutputTupleT::Key;
+
+public:
+    HIPCUB_HOST_DEVICE inline
+    arg_minmax_packed_reference(OutputIteratorT    output,
+                                InputIteratorT     input,
+                                key_type           begin_offset,
+                                const OutputTupleT empty_value)
+        : output_(output), input_(input), begin_offset_(begin_offset), empty_value_(empty_value)
+    {
+    }
+
+    HIPCUB_HOST_DEVICE inline
+    arg_minmax_packed_reference& operator=(const unsigned long long word)
+    {
+        if(word == arg_minmax_packed_identity<Max>())
+        {
+            *output_ = empty_value_;
+            return *this;
+        }
+        const unsigned int field = static_cast<unsigned int>(word);
+        const key_type     index = static_cast<key_type>(Max ? ~field : field);
+        *output_ = OutputTupleT(static_cast<key_type>(index - begin_offset_), input_[index]);
+        return *this;
+    }
+
+private:
+    OutputIteratorT output_;
+    InputIteratorT  input_;
+    key_type        begin_offset_;
+    OutputTupleT    empty_value_;
+};
+
+/// Output iterator of \p ArgMinPacked and \p ArgMaxPacked, decoding the packed words.
+template<bool Max,
+         class OutputIteratorT,
+         class InputIteratorT,
+         class OffsetIteratorT,
+         class OutputTupleT>
+class arg_minmax_packed_output_iterator
+{
+public:
+    using value_type        = unsigned long long;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = void;
+    using reference
+        = arg_minmax_packed_reference<Max, OutputIteratorT, InputIteratorT, OutputTupleT>;
+    using iterator_category = std::random_access_iterator_tag;
+
+    HIPCUB_HOST_DEVICE inline
+    arg_minmax_packed_output_iterator(OutputIteratorT    output,
+                                      InputIteratorT     input,
+                                      OffsetIteratorT    begin_offsets,
+                                      const OutputTupleT empty_value)
+        : output_(output), input_(input), begin_offsets_(begin_offsets), empty_value_(empty_value)
+    {
+    }
+
+    HIPCUB_HOST_DEVICE inline
+    reference operator[](difference_type n) const
+    {
+        return reference(output_ + n,
+                         input_,
+                         static_cast<typename OutputTupleT::Key>(begin_offsets_[n]),
+                         empty_value_);
+    }
+
+    HIPCUB_HOST_DEVICE inline
+    reference operator*() const
+    {
+        return (*this)[0];
+    }
+
+    HIPCUB_HOST_DEVICE inline
+    arg_minmax_packed_output_iterator operator+(difference_type n) const
+    {
+        return arg_minmax_packed_output_iterator(output_ + n,
+                                                 input_,
+                                                 begin_offsets_ + n,
+                                                 empty_value_);
+    }
+
+private:
+    OutputIteratorT output_;
+    InputIteratorT  input_;
+    OffsetIteratorT begin_offsets_;
+    OutputTupleT    empty_value_;
+};
+
+// ArgMin and ArgMax reduce (index, value) pairs, but their cost is that of comparing the
+// values, so they share the tuned configurations of their value type.
+template<class T>
+struct tuned_reduce_key_size : std::integral_constant<size_t, sizeof(T)>
+{};
+
+template<class Key, class Value>
+struct tuned_reduce_key_size<KeyValuePair<Key, Value>>
+    : std::integral_constant<size_t, sizeof(Value)>
+{};
+
 } // end detail namespace
 
-class DeviceReduce
+/// \brief DeviceReduce with a user provided rocPRIM configuration.
+///
+/// \tparam Config - ::rocprim::reduce_config used by Reduce, Sum, Min, Max, ArgMin and ArgMax.
+/// ReduceByKey always uses the default configuration.
+/// This is an extension of the rocPRIM backend and is not available with CUB.
+template<class Config = ::rocprim::default_config>
+class DeviceReduceWithConfig
 {
 public:
     template <
@@ -179,12 +410,31 @@ public:
                       hipStream_t stream = 0,
                       bool debug_synchronous = false)
     {
-        return ::rocprim::reduce(
-            d_temp_storage, temp_storage_bytes,
-            d_in, d_out, init, num_items,
-            ::hipcub::detail::convert_result_type<InputIteratorT, OutputIteratorT>(reduction_op),
-            stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceReduce::Reduce",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        using input_type = typename std::iterator_traits<InputIteratorT>::value_type;
+        return detail::dispatch_tuned_config<Config,
+                                             detail::tuned_algorithm::reduce,
+                                             detail::tuned_reduce_key_size<input_type>::value,
+                                             0>(
+            num_items,
+            stream,
+            [&](auto config_tag)
+            {
+                using config = typename decltype(config_tag)::type;
+                return detail::rocprim_debug_synchronize(
+                    ::rocprim::reduce<config>(
+                        d_temp_storage, temp_storage_bytes,
+                        d_in, d_out, init, num_items,
+                        ::hipcub::detail::convert_result_type<InputIteratorT, OutputIteratorT>(
+                            reduction_op),
+                        stream, detail::rocprim_debug_synchronous(debug_synchronous)
+                    ),
+                    stream, debug_synchronous);
+            });
     }
 
     template <
@@ -200,6 +450,11 @@ public:
                    hipStream_t stream = 0,
                    bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceReduce::Sum",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         using T = typename std::iterator_traits<InputIteratorT>::value_type;
         return Reduce(
             d_temp_storage, temp_storage_bytes,
@@ -221,6 +476,11 @@ public:
                    hipStream_t stream = 0,
                    bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceReduce::Min",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         using T = typename std::iterator_traits<InputIteratorT>::value_type;
         return Reduce(
             d_temp_storage, temp_storage_bytes,
@@ -242,6 +502,11 @@ public:
                       hipStream_t stream = 0,
                       bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceReduce::ArgMin",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         using OffsetT = int;
         using T = typename std::iterator_traits<InputIteratorT>::value_type;
         using O = typename std::iterator_traits<OutputIteratorT>::value_type;
@@ -282,6 +547,11 @@ public:
                    hipStream_t stream = 0,
                    bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceReduce::Max",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         using T = typename std::iterator_traits<InputIteratorT>::value_type;
         return Reduce(
             d_temp_storage, temp_storage_bytes,
@@ -303,6 +573,11 @@ public:
                       hipStream_t stream = 0,
                       bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceReduce::ArgMax",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         using OffsetT = int;
         using T = typename std::iterator_traits<InputIteratorT>::value_type;
         using O = typename std::iterator_traits<OutputIteratorT>::value_type;
@@ -330,6 +605,67 @@ public:
         );
     }
 
+    /// \brief Same as \p ArgMin, but reduces the (index, value) pairs as single 64-bit words.
+    ///
+    /// Each item is encoded as its order-preserving value bits in the upper and its index in the
+    /// lower 32 bits, so the arg-min is a plain 64-bit minimum instead of a reduction over
+    /// 8 or more byte \p KeyValuePair items. Ties resolve to the lowest index, like \p ArgMin,
+    /// and <tt>-0.0</tt> ties with <tt>+0.0</tt>. NaNs are ordered by their bits rather than
+    /// skipped: positive NaNs above <tt>+inf</tt> and negative NaNs below <tt>-inf</tt>.
+    ///
+    /// Only value types of at most 32 bits are supported.
+    /// This is an extension of the rocPRIM backend and is not available with CUB.
+    template <
+        typename InputIteratorT,
+        typename OutputIteratorT
+    >
+    HIPCUB_RUNTIME_FUNCTION static
+    hipError_t ArgMinPacked(void *d_temp_storage,
+                            size_t &temp_storage_bytes,
+                            InputIteratorT d_in,
+                            OutputIteratorT d_out,
+                            int num_items,
+                            hipStream_t stream = 0,
+                            bool debug_synchronous = false)
+    {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceReduce::ArgMinPacked",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return arg_minmax_packed<false>(d_temp_storage, temp_storage_bytes,
+                                        d_in, d_out, num_items,
+                                        stream, debug_synchronous);
+    }
+
+    /// \brief Same as \p ArgMax, but reduces the (index, value) pairs as single 64-bit words.
+    ///
+    /// See \p ArgMinPacked for the encoding and the ordering of special values. Ties resolve to
+    /// the lowest index, like \p ArgMax.
+    /// This is an extension of the rocPRIM backend and is not available with CUB.
+    template <
+        typename InputIteratorT,
+        typename OutputIteratorT
+    >
+    HIPCUB_RUNTIME_FUNCTION static
+    hipError_t ArgMaxPacked(void *d_temp_storage,
+                            size_t &temp_storage_bytes,
+                            InputIteratorT d_in,
+                            OutputIteratorT d_out,
+                            int num_items,
+                            hipStream_t stream = 0,
+                            bool debug_synchronous = false)
+    {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceReduce::ArgMaxPacked",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return arg_minmax_packed<true>(d_temp_storage, temp_storage_bytes,
+                                       d_in, d_out, num_items,
+                                       stream, debug_synchronous);
+    }
+
     template<
         typename KeysInputIteratorT,
         typename UniqueOutputIteratorT,
@@ -351,19 +687,78 @@ public:
                            hipStream_t stream = 0,
                            bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceReduce::ReduceByKey",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         using key_compare_op =
             ::rocprim::equal_to<typename std::iterator_traits<KeysInputIteratorT>::value_type>;
-        return ::rocprim::reduce_by_key(
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::reduce_by_key(
+                d_temp_storage, temp_storage_bytes,
+                d_keys_in, d_values_in, num_items,
+                d_unique_out, d_aggregates_out, d_num_runs_out,
+                ::hipcub::detail::convert_result_type<ValuesInputIteratorT, AggregatesOutputIteratorT>(reduction_op),
+                key_compare_op(),
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
+    }
+
+private:
+    template<bool Max, typename InputIteratorT, typename OutputIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static
+    hipError_t arg_minmax_packed(void *d_temp_storage,
+                                 size_t &temp_storage_bytes,
+                                 InputIteratorT d_in,
+                                 OutputIteratorT d_out,
+                                 int num_items,
+                                 hipStream_t stream,
+                                 bool debug_synchronous)
+    {
+        using OffsetT = int;
+        using T = typename std::iterator_traits<InputIteratorT>::value_type;
+        using O = typename std::iterator_traits<OutputIteratorT>::value_type;
+        using OutputTupleT =
+            typename std::conditional<
+                std::is_same<O, void>::value,
+                KeyValuePair<OffsetT, T>,
+                O
+            >::type;
+
+        using OutputValueT = typename OutputTupleT::Value;
+        static_assert(detail::is_arg_minmax_packable<OutputValueT>::value,
+                      "ArgMinPacked and ArgMaxPacked only support values of at most 32 bits");
+
+        using IndexedIteratorT = ArgIndexInputIterator<InputIteratorT, OffsetT, OutputValueT>;
+        using EncodeOpT = detail::arg_minmax_packed_encode<Max, OffsetT, OutputValueT>;
+        using PackedIteratorT
+            = ::rocprim::transform_iterator<IndexedIteratorT, EncodeOpT, unsigned long long>;
+        using OffsetIteratorT = ::rocprim::constant_iterator<OffsetT>;
+        using PackedOutputIteratorT = detail::
+            arg_minmax_packed_output_iterator<Max, OutputIteratorT, InputIteratorT, OffsetIteratorT, OutputTupleT>;
+        using ReduceOpT = typename std::conditional<Max, ::hipcub::Max, ::hipcub::Min>::type;
+
+        PackedIteratorT d_packed_in(IndexedIteratorT(d_in), EncodeOpT());
+        // Same empty-input value as ArgMin and ArgMax
+        const OutputTupleT empty_value(1,
+                                       Max ? detail::get_lowest_value<T>()
+                                           : detail::get_max_value<T>());
+        PackedOutputIteratorT d_packed_out(d_out, d_in, OffsetIteratorT(0), empty_value);
+
+        return Reduce(
             d_temp_storage, temp_storage_bytes,
-            d_keys_in, d_values_in, num_items,
-            d_unique_out, d_aggregates_out, d_num_runs_out,
-            ::hipcub::detail::convert_result_type<ValuesInputIteratorT, AggregatesOutputIteratorT>(reduction_op),
-            key_compare_op(),
+            d_packed_in, d_packed_out, num_items, ReduceOpT(),
+            detail::arg_minmax_packed_identity<Max>(),
             stream, debug_synchronous
         );
     }
 };
 
+class DeviceReduce : public DeviceReduceWithConfig<>
+{};
+
 END_HIPCUB_NAMESPACE
 
 #endif // HIPCUB_ROCPRIM_DEVICE_DEVICE_REDUCE_HPP_
@@ -31,6 +31,8 @@
 #define HIPCUB_ROCPRIM_DEVICE_DEVICE_RUN_LENGTH_ENCODE_HPP_
 
 #include "../../../config.hpp"
+#include "../../../util_launch_recorder_fwd.hpp"
+#include "../../../util_trace.hpp"
 
 #include <rocprim/device/device_run_length_encode.hpp>
 
@@ -56,12 +58,19 @@ public:
                       hipStream_t stream = 0,
                       bool debug_synchronous = false)
     {
-        return ::rocprim::run_length_encode(
-            d_temp_storage, temp_storage_bytes,
-            d_in, num_items,
-            d_unique_out, d_counts_out, d_num_runs_out,
-            stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceRunLengthEncode::Encode",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::run_length_encode(
+                d_temp_storage, temp_storage_bytes,
+                d_in, num_items,
+                d_unique_out, d_counts_out, d_num_runs_out,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template<
@@ -81,12 +90,19 @@ public:
                               hipStream_t stream = 0,
                               bool debug_synchronous = false)
     {
-        return ::rocprim::run_length_encode_non_trivial_runs(
-            d_temp_storage, temp_storage_bytes,
-            d_in, num_items,
-            d_offsets_out, d_lengths_out, d_num_runs_out,
-            stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceRunLengthEncode::NonTrivialRuns",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::run_length_encode_non_trivial_runs(
+                d_temp_storage, temp_storage_bytes,
+                d_in, num_items,
+                d_offsets_out, d_lengths_out, d_num_runs_out,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 };
 
@@ -30,17 +30,27 @@
 #ifndef HIPCUB_ROCPRIM_DEVICE_DEVICE_SCAN_HPP_
 #define HIPCUB_ROCPRIM_DEVICE_DEVICE_SCAN_HPP_
 
-#include <iostream>
+#include <iterator>
+
 #include "../../../config.hpp"
+#include "../../../util_launch_recorder_fwd.hpp"
+#include "../../../util_trace.hpp"
 
 #include "../thread/thread_operators.hpp"
+#include "device_tuned_config.hpp"
 
 #include <rocprim/device/device_scan.hpp>
 #include <rocprim/device/device_scan_by_key.hpp>
 
 BEGIN_HIPCUB_NAMESPACE
 
-class DeviceScan
+/// \brief DeviceScan with a user provided rocPRIM configuration.
+///
+/// \tparam Config - ::rocprim::scan_config used by the scans which are not by key.
+/// The by key scans always use the default configuration.
+/// This is an extension of the rocPRIM backend and is not available with CUB.
+template<class Config = ::rocprim::default_config>
+class DeviceScanWithConfig
 {
 public:
     template <
@@ -56,6 +66,11 @@ public:
                             hipStream_t stream = 0,
                             bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceScan::InclusiveSum",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         return InclusiveScan(
             d_temp_storage, temp_storage_bytes,
             d_in, d_out, ::hipcub::Sum(), num_items,
@@ -78,12 +93,30 @@ public:
                              hipStream_t stream = 0,
                              bool debug_synchronous = false)
     {
-        return ::rocprim::inclusive_scan(
-            d_temp_storage, temp_storage_bytes,
-            d_in, d_out, num_items,
-            scan_op,
-            stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceScan::InclusiveScan",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        using input_type = typename std::iterator_traits<InputIteratorT>::value_type;
+        return detail::dispatch_tuned_config<Config,
+                                             detail::tuned_algorithm::scan,
+                                             sizeof(input_type),
+                                             0>(
+            num_items,
+            stream,
+            [&](auto config_tag)
+            {
+                using config = typename decltype(config_tag)::type;
+                return detail::rocprim_debug_synchronize(
+                    ::rocprim::inclusive_scan<config>(
+                        d_temp_storage, temp_storage_bytes,
+                        d_in, d_out, num_items,
+                        scan_op,
+                        stream, detail::rocprim_debug_synchronous(debug_synchronous)
+                    ),
+                    stream, debug_synchronous);
+            });
     }
 
     template <
@@ -99,6 +132,11 @@ public:
                             hipStream_t stream = 0,
                             bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceScan::ExclusiveSum",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         using T = typename std::iterator_traits<InputIteratorT>::value_type;
         return ExclusiveScan(
             d_temp_storage, temp_storage_bytes,
@@ -124,12 +162,30 @@ public:
                              hipStream_t stream = 0,
                              bool debug_synchronous = false)
     {
-        return ::rocprim::exclusive_scan(
-            d_temp_storage, temp_storage_bytes,
-            d_in, d_out, init_value, num_items,
-            scan_op,
-            stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceScan::ExclusiveScan",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        using input_type = typename std::iterator_traits<InputIteratorT>::value_type;
+        return detail::dispatch_tuned_config<Config,
+                                             detail::tuned_algorithm::scan,
+                                             sizeof(input_type),
+                                             0>(
+            num_items,
+            stream,
+            [&](auto config_tag)
+            {
+                using config = typename decltype(config_tag)::type;
+                return detail::rocprim_debug_synchronize(
+                    ::rocprim::exclusive_scan<config>(
+                        d_temp_storage, temp_storage_bytes,
+                        d_in, d_out, init_value, num_items,
+                        scan_op,
+                        stream, detail::rocprim_debug_synchronous(debug_synchronous)
+                    ),
+                    stream, debug_synchronous);
+            });
     }
 
     template <
@@ -150,12 +206,30 @@ public:
                              hipStream_t stream = 0,
                              bool debug_synchronous = false)
     {
-        return ::rocprim::exclusive_scan(
-            d_temp_storage, temp_storage_bytes,
-            d_in, d_out, init_value, num_items,
-            scan_op,
-            stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceScan::ExclusiveScan",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        using input_type = typename std::iterator_traits<InputIteratorT>::value_type;
+        return detail::dispatch_tuned_config<Config,
+                                             detail::tuned_algorithm::scan,
+                                             sizeof(input_type),
+                                             0>(
+            num_items,
+            stream,
+            [&](auto config_tag)
+            {
+                using config = typename decltype(config_tag)::type;
+                return detail::rocprim_debug_synchronize(
+                    ::rocprim::exclusive_scan<config>(
+                        d_temp_storage, temp_storage_bytes,
+                        d_in, d_out, init_value, num_items,
+                        scan_op,
+                        stream, detail::rocprim_debug_synchronous(debug_synchronous)
+                    ),
+                    stream, debug_synchronous);
+            });
     }
 
     template <
@@ -175,14 +249,22 @@ public:
                                  hipStream_t stream = 0,
                                  bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceScan::ExclusiveSumByKey",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         using in_value_type = typename std::iterator_traits<ValuesInputIteratorT>::value_type;
 
-        return ::rocprim::exclusive_scan_by_key(
-            d_temp_storage, temp_storage_bytes,
-            d_keys_in, d_values_in, d_values_out,
-            static_cast<in_value_type>(0), static_cast<size_t>(num_items),
-            ::hipcub::Sum(), equality_op, stream, debug_synchronous
-        );
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::exclusive_scan_by_key(
+                d_temp_storage, temp_storage_bytes,
+                d_keys_in, d_values_in, d_values_out,
+                static_cast<in_value_type>(0), static_cast<size_t>(num_items),
+                ::hipcub::Sum(), equality_op, stream,
+                detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template <
@@ -206,12 +288,19 @@ public:
                                   hipStream_t stream = 0,
                                   bool debug_synchronous = false)
     {
-        return ::rocprim::exclusive_scan_by_key(
-            d_temp_storage, temp_storage_bytes,
-            d_keys_in, d_values_in, d_values_out,
-            init_value, static_cast<size_t>(num_items),
-            scan_op, equality_op, stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceScan::ExclusiveScanByKey",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::exclusive_scan_by_key(
+                d_temp_storage, temp_storage_bytes,
+                d_keys_in, d_values_in, d_values_out,
+                init_value, static_cast<size_t>(num_items),
+                scan_op, equality_op, stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template <
@@ -231,12 +320,19 @@ public:
                                  hipStream_t stream = 0,
                                  bool debug_synchronous = false)
     {
-        return ::rocprim::inclusive_scan_by_key(
-            d_temp_storage, temp_storage_bytes,
-            d_keys_in, d_values_in, d_values_out,
-            static_cast<size_t>(num_items), ::hipcub::Sum(),
-            equality_op, stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceScan::InclusiveSumByKey",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::inclusive_scan_by_key(
+                d_temp_storage, temp_storage_bytes,
+                d_keys_in, d_values_in, d_values_out,
+                static_cast<size_t>(num_items), ::hipcub::Sum(),
+                equality_op, stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template <
@@ -258,15 +354,25 @@ public:
                                   hipStream_t stream = 0,
                                   bool debug_synchronous = false)
     {
-        return ::rocprim::inclusive_scan_by_key(
-            d_temp_storage, temp_storage_bytes,
-            d_keys_in, d_values_in, d_values_out,
-            static_cast<size_t>(num_items), scan_op,
-            equality_op, stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceScan::InclusiveScanByKey",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::inclusive_scan_by_key(
+                d_temp_storage, temp_storage_bytes,
+                d_keys_in, d_values_in, d_values_out,
+                static_cast<size_t>(num_items), scan_op,
+                equality_op, stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 };
 
+class DeviceScan : public DeviceScanWithConfig<>
+{};
+
 END_HIPCUB_NAMESPACE
 
 #endif // HIPCUB_ROCPRIM_DEVICE_DEVICE_SCAN_HPP_
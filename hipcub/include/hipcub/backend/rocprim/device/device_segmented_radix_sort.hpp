@@ -31,6 +31,8 @@
 #define HIPCUB_ROCPRIM_DEVICE_DEVICE_SEGMENTED_RADIX_SORT_HPP_
 
 #include "../../../config.hpp"
+#include "../../../util_launch_recorder_fwd.hpp"
+#include "../../../util_trace.hpp"
 
 #include "../util_type.hpp"
 
@@ -57,13 +59,20 @@ struct DeviceSegmentedRadixSort
                          hipStream_t stream = 0,
                          bool debug_synchronous = false)
     {
-        return ::rocprim::segmented_radix_sort_pairs(
-            d_temp_storage, temp_storage_bytes,
-            d_keys_in, d_keys_out, d_values_in, d_values_out, num_items,
-            num_segments, d_begin_offsets, d_end_offsets,
-            begin_bit, end_bit,
-            stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedRadixSort::SortPairs",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::segmented_radix_sort_pairs(
+                d_temp_storage, temp_storage_bytes,
+                d_keys_in, d_keys_out, d_values_in, d_values_out, num_items,
+                num_segments, d_begin_offsets, d_end_offsets,
+                begin_bit, end_bit,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template<typename KeyT, typename ValueT, typename OffsetIteratorT>
@@ -81,15 +90,22 @@ struct DeviceSegmentedRadixSort
                          hipStream_t stream = 0,
                          bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedRadixSort::SortPairs",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         ::rocprim::double_buffer<KeyT> d_keys_db = detail::to_double_buffer(d_keys);
         ::rocprim::double_buffer<ValueT> d_values_db = detail::to_double_buffer(d_values);
-        hipError_t error = ::rocprim::segmented_radix_sort_pairs(
-            d_temp_storage, temp_storage_bytes,
-            d_keys_db, d_values_db, num_items,
-            num_segments, d_begin_offsets, d_end_offsets,
-            begin_bit, end_bit,
-            stream, debug_synchronous
-        );
+        hipError_t error = detail::rocprim_debug_synchronize(
+            ::rocprim::segmented_radix_sort_pairs(
+                d_temp_storage, temp_storage_bytes,
+                d_keys_db, d_values_db, num_items,
+                num_segments, d_begin_offsets, d_end_offsets,
+                begin_bit, end_bit,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
         detail::update_double_buffer(d_keys, d_keys_db);
         detail::update_double_buffer(d_values, d_values_db);
         return error;
@@ -112,13 +128,20 @@ struct DeviceSegmentedRadixSort
                                    hipStream_t stream = 0,
                                    bool debug_synchronous = false)
     {
-        return ::rocprim::segmented_radix_sort_pairs_desc(
-            d_temp_storage, temp_storage_bytes,
-            d_keys_in, d_keys_out, d_values_in, d_values_out, num_items,
-            num_segments, d_begin_offsets, d_end_offsets,
-            begin_bit, end_bit,
-            stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedRadixSort::SortPairsDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::segmented_radix_sort_pairs_desc(
+                d_temp_storage, temp_storage_bytes,
+                d_keys_in, d_keys_out, d_values_in, d_values_out, num_items,
+                num_segments, d_begin_offsets, d_end_offsets,
+                begin_bit, end_bit,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template<typename KeyT, typename ValueT, typename OffsetIteratorT>
@@ -136,15 +159,22 @@ struct DeviceSegmentedRadixSort
                                    hipStream_t stream = 0,
                                    bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedRadixSort::SortPairsDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         ::rocprim::double_buffer<KeyT> d_keys_db = detail::to_double_buffer(d_keys);
         ::rocprim::double_buffer<ValueT> d_values_db = detail::to_double_buffer(d_values);
-        hipError_t error = ::rocprim::segmented_radix_sort_pairs_desc(
-            d_temp_storage, temp_storage_bytes,
-            d_keys_db, d_values_db, num_items,
-            num_segments, d_begin_offsets, d_end_offsets,
-            begin_bit, end_bit,
-            stream, debug_synchronous
-        );
+        hipError_t error = detail::rocprim_debug_synchronize(
+            ::rocprim::segmented_radix_sort_pairs_desc(
+                d_temp_storage, temp_storage_bytes,
+                d_keys_db, d_values_db, num_items,
+                num_segments, d_begin_offsets, d_end_offsets,
+                begin_bit, end_bit,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
         detail::update_double_buffer(d_keys, d_keys_db);
         detail::update_double_buffer(d_values, d_values_db);
         return error;
@@ -165,13 +195,20 @@ struct DeviceSegmentedRadixSort
                         hipStream_t stream = 0,
                         bool debug_synchronous = false)
     {
-        return ::rocprim::segmented_radix_sort_keys(
-            d_temp_storage, temp_storage_bytes,
-            d_keys_in, d_keys_out, num_items,
-            num_segments, d_begin_offsets, d_end_offsets,
-            begin_bit, end_bit,
-            stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedRadixSort::SortKeys",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::segmented_radix_sort_keys(
+                d_temp_storage, temp_storage_bytes,
+                d_keys_in, d_keys_out, num_items,
+                num_segments, d_begin_offsets, d_end_offsets,
+                begin_bit, end_bit,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template<typename KeyT, typename OffsetIteratorT>
@@ -188,14 +225,21 @@ struct DeviceSegmentedRadixSort
                         hipStream_t stream = 0,
                         bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedRadixSort::SortKeys",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         ::rocprim::double_buffer<KeyT> d_keys_db = detail::to_double_buffer(d_keys);
-        hipError_t error = ::rocprim::segmented_radix_sort_keys(
-            d_temp_storage, temp_storage_bytes,
-            d_keys_db, num_items,
-            num_segments, d_begin_offsets, d_end_offsets,
-            begin_bit, end_bit,
-            stream, debug_synchronous
-        );
+        hipError_t error = detail::rocprim_debug_synchronize(
+            ::rocprim::segmented_radix_sort_keys(
+                d_temp_storage, temp_storage_bytes,
+                d_keys_db, num_items,
+                num_segments, d_begin_offsets, d_end_offsets,
+                begin_bit, end_bit,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
         detail::update_double_buffer(d_keys, d_keys_db);
         return error;
     }
@@ -215,13 +259,20 @@ struct DeviceSegmentedRadixSort
                                   hipStream_t stream = 0,
                                   bool debug_synchronous = false)
     {
-        return ::rocprim::segmented_radix_sort_keys_desc(
-            d_temp_storage, temp_storage_bytes,
-            d_keys_in, d_keys_out, num_items,
-            num_segments, d_begin_offsets, d_end_offsets,
-            begin_bit, end_bit,
-            stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedRadixSort::SortKeysDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::segmented_radix_sort_keys_desc(
+                d_temp_storage, temp_storage_bytes,
+                d_keys_in, d_keys_out, num_items,
+                num_segments, d_begin_offsets, d_end_offsets,
+                begin_bit, end_bit,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template<typename KeyT, typename OffsetIteratorT>
@@ -238,14 +289,21 @@ struct DeviceSegmentedRadixSort
                                   hipStream_t stream = 0,
                                   bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedRadixSort::SortKeysDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         ::rocprim::double_buffer<KeyT> d_keys_db = detail::to_double_buffer(d_keys);
-        hipError_t error = ::rocprim::segmented_radix_sort_keys_desc(
-            d_temp_storage, temp_storage_bytes,
-            d_keys_db, num_items,
-            num_segments, d_begin_offsets, d_end_offsets,
-            begin_bit, end_bit,
-            stream, debug_synchronous
-        );
+        hipError_t error = detail::rocprim_debug_synchronize(
+            ::rocprim::segmented_radix_sort_keys_desc(
+                d_temp_storage, temp_storage_bytes,
+                d_keys_db, num_items,
+                num_segments, d_begin_offsets, d_end_offsets,
+                begin_bit, end_bit,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
         detail::update_double_buffer(d_keys, d_keys_db);
         return error;
     }
@@ -34,8 +34,11 @@
 #include <iterator>
 
 #include "../../../config.hpp"
+#include "../../../util_launch_recorder.hpp"
+#include "../../../util_trace.hpp"
 
 #include "../iterator/arg_index_input_iterator.hpp"
+#include "../iterator/transform_input_iterator.hpp"
 #include "../thread/thread_operators.hpp"
 #include "device_reduce.hpp"
 
@@ -91,23 +94,6 @@ __global__ __launch_bounds__(
     }
 }
 
-#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start)                           \
-    {                                                                                            \
-        auto _error = hipGetLastError();                                                         \
-        if(_error != hipSuccess)                                                                 \
-            return _error;                                                                       \
-        if(debug_synchronous)                                                                    \
-        {                                                                                        \
-            std::cout << name << "(" << size << ")";                                             \
-            auto __error = hipStreamSynchronize(stream);                                         \
-            if(__error != hipSuccess)                                                            \
-                return __error;                                                                  \
-            auto _end = std::chrono::high_resolution_clock::now();                               \
-            auto _d   = std::chrono::duration_cast<std::chrono::duration<double>>(_end - start); \
-            std::cout << " " << _d.count() * 1000 << " ms" << '\n';                              \
-        }                                                                                        \
-    }
-
 /// Dispatch function similar to \p rocprim::segmented_reduce but writes \p empty_value for empty
 /// segments and writes a segment-relative index instead of an absolute one.
 template<class Config = rocprim::default_config,
@@ -157,25 +143,28 @@ inline hipError_t segmented_arg_minmax(void*          temporary_storage,
     if(segments == 0u)
         return hipSuccess;
 
-    std::chrono::high_resolution_clock::time_point start;
-
-    if(debug_synchronous)
-        start = std::chrono::high_resolution_clock::now();
-    hipLaunchKernelGGL(HIP_KERNEL_NAME(segmented_arg_minmax_kernel<config>),
-                       dim3(segments),
-                       dim3(block_size),
-                       0,
-                       stream,
-                       input,
-                       output,
-                       begin_offsets,
-                       end_offsets,
-                       reduce_op,
-                       static_cast<result_type>(initial_value),
-                       static_cast<result_type>(empty_value));
-    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_arg_minmax", segments, start);
-
-    return hipSuccess;
+    return record_launch("segmented_arg_minmax",
+                         dim3(segments),
+                         dim3(block_size),
+                         0,
+                         stream,
+                         debug_synchronous,
+                         [&]
+                         {
+                             hipLaunchKernelGGL(
+                                 HIP_KERNEL_NAME(segmented_arg_minmax_kernel<config>),
+                                 dim3(segments),
+                                 dim3(block_size),
+                                 0,
+                                 stream,
+                                 input,
+                                 output,
+                                 begin_offsets,
+                                 end_offsets,
+                                 reduce_op,
+                                 static_cast<result_type>(initial_value),
+                                 static_cast<result_type>(empty_value));
+                         });
 }
 
 } // namespace detail
@@ -202,14 +191,22 @@ struct DeviceSegmentedReduce
                       hipStream_t stream = 0,
                       bool debug_synchronous = false)
     {
-        return ::rocprim::segmented_reduce(
-            d_temp_storage, temp_storage_bytes,
-            d_in, d_out,
-            num_segments, d_begin_offsets, d_end_offsets,
-            ::hipcub::detail::convert_result_type<InputIteratorT, OutputIteratorT>(reduction_op),
-            initial_value,
-            stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedReduce::Reduce",
+                                  num_segments,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::segmented_reduce(
+                d_temp_storage, temp_storage_bytes,
+                d_in, d_out,
+                num_segments, d_begin_offsets, d_end_offsets,
+                ::hipcub::detail::convert_result_type<InputIteratorT, OutputIteratorT>(
+                    reduction_op),
+                initial_value,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template<
@@ -228,6 +225,11 @@ struct DeviceSegmentedReduce
                    hipStream_t stream = 0,
                    bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedReduce::Sum",
+                                  num_segments,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         using input_type = typename std::iterator_traits<InputIteratorT>::value_type;
 
         return Reduce(
@@ -255,13 +257,18 @@ struct DeviceSegmentedReduce
                    hipStream_t stream = 0,
                    bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedReduce::Min",
+                                  num_segments,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         using input_type = typename std::iterator_traits<InputIteratorT>::value_type;
 
         return Reduce(
             d_temp_storage, temp_storage_bytes,
             d_in, d_out,
             num_segments, d_begin_offsets, d_end_offsets,
-            ::hipcub::Min(), std::numeric_limits<input_type>::max(),
+            ::hipcub::Min(), detail::get_max_value<input_type>(),
             stream, debug_synchronous
         );
     }
@@ -282,6 +289,11 @@ struct DeviceSegmentedReduce
                       hipStream_t stream = 0,
                       bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedReduce::ArgMin",
+                                  num_segments,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         using OffsetT = int;
         using T = typename std::iterator_traits<InputIteratorT>::value_type;
         using O = typename std::iterator_traits<OutputIteratorT>::value_type;
@@ -332,13 +344,18 @@ struct DeviceSegmentedReduce
                    hipStream_t stream = 0,
                    bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedReduce::Max",
+                                  num_segments,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         using input_type = typename std::iterator_traits<InputIteratorT>::value_type;
 
         return Reduce(
             d_temp_storage, temp_storage_bytes,
             d_in, d_out,
             num_segments, d_begin_offsets, d_end_offsets,
-            ::hipcub::Max(), std::numeric_limits<input_type>::lowest(),
+            ::hipcub::Max(), detail::get_lowest_value<input_type>(),
             stream, debug_synchronous
         );
     }
@@ -359,6 +376,11 @@ struct DeviceSegmentedReduce
                       hipStream_t stream = 0,
                       bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedReduce::ArgMax",
+                                  num_segments,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         using OffsetT = int;
         using T = typename std::iterator_traits<InputIteratorT>::value_type;
         using O = typename std::iterator_traits<OutputIteratorT>::value_type;
@@ -392,6 +414,133 @@ struct DeviceSegmentedReduce
                                             stream,
                                             debug_synchronous);
     }
+
+    /// \brief Same as \p ArgMin, but reduces the (index, value) pairs as single 64-bit words.
+    ///
+    /// See \p DeviceReduce::ArgMinPacked for the encoding and the ordering of special values.
+    /// This is an extension of the rocPRIM backend and is not available with CUB.
+    template<
+        typename InputIteratorT,
+        typename OutputIteratorT,
+        typename OffsetIteratorT
+    >
+    HIPCUB_RUNTIME_FUNCTION static
+    hipError_t ArgMinPacked(void * d_temp_storage,
+                            size_t& temp_storage_bytes,
+                            InputIteratorT d_in,
+                            OutputIteratorT d_out,
+                            int num_segments,
+                            OffsetIteratorT d_begin_offsets,
+                            OffsetIteratorT d_end_offsets,
+                            hipStream_t stream = 0,
+                            bool debug_synchronous = false)
+    {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedReduce::ArgMinPacked",
+                                  num_segments,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return arg_minmax_packed<false>(d_temp_storage,
+                                        temp_storage_bytes,
+                                        d_in,
+                                        d_out,
+                                        num_segments,
+                                        d_begin_offsets,
+                                        d_end_offsets,
+                                        stream,
+                                        debug_synchronous);
+    }
+
+    /// \brief Same as \p ArgMax, but reduces the (index, value) pairs as single 64-bit words.
+    ///
+    /// See \p DeviceReduce::ArgMinPacked for the encoding and the ordering of special values.
+    /// This is an extension of the rocPRIM backend and is not available with CUB.
+    template<
+        typename InputIteratorT,
+        typename OutputIteratorT,
+        typename OffsetIteratorT
+    >
+    HIPCUB_RUNTIME_FUNCTION static
+    hipError_t ArgMaxPacked(void * d_temp_storage,
+                            size_t& temp_storage_bytes,
+                            InputIteratorT d_in,
+                            OutputIteratorT d_out,
+                            int num_segments,
+                            OffsetIteratorT d_begin_offsets,
+                            OffsetIteratorT d_end_offsets,
+                            hipStream_t stream = 0,
+                            bool debug_synchronous = false)
+    {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedReduce::ArgMaxPacked",
+                                  num_segments,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return arg_minmax_packed<true>(d_temp_storage,
+                                       temp_storage_bytes,
+                                       d_in,
+                                       d_out,
+                                       num_segments,
+                                       d_begin_offsets,
+                                       d_end_offsets,
+                                       stream,
+                                       debug_synchronous);
+    }
+
+private:
+    template<bool Max, typename InputIteratorT, typename OutputIteratorT, typename OffsetIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static
+    hipError_t arg_minmax_packed(void * d_temp_storage,
+                                 size_t& temp_storage_bytes,
+                                 InputIteratorT d_in,
+                                 OutputIteratorT d_out,
+                                 int num_segments,
+                                 OffsetIteratorT d_begin_offsets,
+                                 OffsetIteratorT d_end_offsets,
+                                 hipStream_t stream,
+                                 bool debug_synchronous)
+    {
+        using OffsetT = int;
+        using T = typename std::iterator_traits<InputIteratorT>::value_type;
+        using O = typename std::iterator_traits<OutputIteratorT>::value_type;
+        using OutputTupleT = typename std::conditional<
+                                 std::is_same<O, void>::value,
+                                 KeyValuePair<OffsetT, T>,
+                                 O
+                             >::type;
+
+        using OutputValueT = typename OutputTupleT::Value;
+        static_assert(detail::is_arg_minmax_packable<OutputValueT>::value,
+                      "ArgMinPacked and ArgMaxPacked only support values of at most 32 bits");
+
+        using IndexedIteratorT = ArgIndexInputIterator<InputIteratorT, OffsetT, OutputValueT>;
+        using EncodeOpT = detail::arg_minmax_packed_encode<Max, OffsetT, OutputValueT>;
+        using PackedIteratorT
+            = TransformInputIterator<unsigned long long, EncodeOpT, IndexedIteratorT>;
+        // decoding subtracts the segment begin, so the written indices are segment-relative
+        using PackedOutputIteratorT = detail::
+            arg_minmax_packed_output_iterator<Max, OutputIteratorT, InputIteratorT, OffsetIteratorT, OutputTupleT>;
+        using ReduceOpT = typename std::conditional<Max, ::hipcub::Max, ::hipcub::Min>::type;
+
+        PackedIteratorT d_packed_in(IndexedIteratorT(d_in), EncodeOpT());
+        // special value for empty segments
+        const OutputTupleT empty_value(1,
+                                       Max ? detail::get_lowest_value<T>()
+                                           : detail::get_max_value<T>());
+        PackedOutputIteratorT d_packed_out(d_out, d_in, d_begin_offsets, empty_value);
+
+        return Reduce(d_temp_storage,
+                      temp_storage_bytes,
+                      d_packed_in,
+                      d_packed_out,
+                      num_segments,
+                      d_begin_offsets,
+                      d_end_offsets,
+                      ReduceOpT(),
+                      detail::arg_minmax_packed_identity<Max>(),
+                      stream,
+                      debug_synchronous);
+    }
 };
 
 END_HIPCUB_NAMESPACE
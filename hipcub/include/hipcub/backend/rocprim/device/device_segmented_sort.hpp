@@ -31,6 +31,8 @@
 #define HIPCUB_ROCPRIM_DEVICE_DEVICE_SEGMENTED_SORT_HPP_
 
 #include "../../../config.hpp"
+#include "../../../util_launch_recorder_fwd.hpp"
+#include "../../../util_trace.hpp"
 
 #include "../util_type.hpp"
 
@@ -55,13 +57,20 @@ struct DeviceSegmentedSort
                          hipStream_t stream = 0,
                          bool debug_synchronous = false)
     {
-        return ::rocprim::segmented_radix_sort_pairs(
-            d_temp_storage, temp_storage_bytes,
-            d_keys_in, d_keys_out, d_values_in, d_values_out, num_items,
-            num_segments, d_begin_offsets, d_end_offsets,
-            0, sizeof(KeyT) * 8,
-            stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::SortPairs",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::segmented_radix_sort_pairs(
+                d_temp_storage, temp_storage_bytes,
+                d_keys_in, d_keys_out, d_values_in, d_values_out, num_items,
+                num_segments, d_begin_offsets, d_end_offsets,
+                0, sizeof(KeyT) * 8,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template<typename KeyT, typename ValueT, typename OffsetIteratorT>
@@ -77,15 +86,22 @@ struct DeviceSegmentedSort
                          hipStream_t stream = 0,
                          bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::SortPairs",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         ::rocprim::double_buffer<KeyT> d_keys_db = detail::to_double_buffer(d_keys);
         ::rocprim::double_buffer<ValueT> d_values_db = detail::to_double_buffer(d_values);
-        hipError_t error = ::rocprim::segmented_radix_sort_pairs(
-            d_temp_storage, temp_storage_bytes,
-            d_keys_db, d_values_db, num_items,
-            num_segments, d_begin_offsets, d_end_offsets,
-            0, sizeof(KeyT) * 8,
-            stream, debug_synchronous
-        );
+        hipError_t error = detail::rocprim_debug_synchronize(
+            ::rocprim::segmented_radix_sort_pairs(
+                d_temp_storage, temp_storage_bytes,
+                d_keys_db, d_values_db, num_items,
+                num_segments, d_begin_offsets, d_end_offsets,
+                0, sizeof(KeyT) * 8,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
         detail::update_double_buffer(d_keys, d_keys_db);
         detail::update_double_buffer(d_values, d_values_db);
         return error;
@@ -106,13 +122,20 @@ struct DeviceSegmentedSort
                                    hipStream_t stream = 0,
                                    bool debug_synchronous = false)
     {
-        return ::rocprim::segmented_radix_sort_pairs_desc(
-            d_temp_storage, temp_storage_bytes,
-            d_keys_in, d_keys_out, d_values_in, d_values_out, num_items,
-            num_segments, d_begin_offsets, d_end_offsets,
-            0, sizeof(KeyT) * 8,
-            stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::SortPairsDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::segmented_radix_sort_pairs_desc(
+                d_temp_storage, temp_storage_bytes,
+                d_keys_in, d_keys_out, d_values_in, d_values_out, num_items,
+                num_segments, d_begin_offsets, d_end_offsets,
+                0, sizeof(KeyT) * 8,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template<typename KeyT, typename ValueT, typename OffsetIteratorT>
@@ -128,15 +151,22 @@ struct DeviceSegmentedSort
                                    hipStream_t stream = 0,
                                    bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::SortPairsDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         ::rocprim::double_buffer<KeyT> d_keys_db = detail::to_double_buffer(d_keys);
         ::rocprim::double_buffer<ValueT> d_values_db = detail::to_double_buffer(d_values);
-        hipError_t error = ::rocprim::segmented_radix_sort_pairs_desc(
-            d_temp_storage, temp_storage_bytes,
-            d_keys_db, d_values_db, num_items,
-            num_segments, d_begin_offsets, d_end_offsets,
-            0, sizeof(KeyT) * 8,
-            stream, debug_synchronous
-        );
+        hipError_t error = detail::rocprim_debug_synchronize(
+            ::rocprim::segmented_radix_sort_pairs_desc(
+                d_temp_storage, temp_storage_bytes,
+                d_keys_db, d_values_db, num_items,
+                num_segments, d_begin_offsets, d_end_offsets,
+                0, sizeof(KeyT) * 8,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
         detail::update_double_buffer(d_keys, d_keys_db);
         detail::update_double_buffer(d_values, d_values_db);
         return error;
@@ -155,13 +185,20 @@ struct DeviceSegmentedSort
                         hipStream_t stream = 0,
                         bool debug_synchronous = false)
     {
-        return ::rocprim::segmented_radix_sort_keys(
-            d_temp_storage, temp_storage_bytes,
-            d_keys_in, d_keys_out, num_items,
-            num_segments, d_begin_offsets, d_end_offsets,
-            0, sizeof(KeyT) * 8,
-            stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::SortKeys",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::segmented_radix_sort_keys(
+                d_temp_storage, temp_storage_bytes,
+                d_keys_in, d_keys_out, num_items,
+                num_segments, d_begin_offsets, d_end_offsets,
+                0, sizeof(KeyT) * 8,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template<typename KeyT, typename OffsetIteratorT>
@@ -176,14 +213,21 @@ struct DeviceSegmentedSort
                         hipStream_t stream = 0,
                         bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::SortKeys",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         ::rocprim::double_buffer<KeyT> d_keys_db = detail::to_double_buffer(d_keys);
-        hipError_t error = ::rocprim::segmented_radix_sort_keys(
-            d_temp_storage, temp_storage_bytes,
-            d_keys_db, num_items,
-            num_segments, d_begin_offsets, d_end_offsets,
-            0, sizeof(KeyT) * 8,
-            stream, debug_synchronous
-        );
+        hipError_t error = detail::rocprim_debug_synchronize(
+            ::rocprim::segmented_radix_sort_keys(
+                d_temp_storage, temp_storage_bytes,
+                d_keys_db, num_items,
+                num_segments, d_begin_offsets, d_end_offsets,
+                0, sizeof(KeyT) * 8,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
         detail::update_double_buffer(d_keys, d_keys_db);
         return error;
     }
@@ -201,13 +245,20 @@ struct DeviceSegmentedSort
                                   hipStream_t stream = 0,
                                   bool debug_synchronous = false)
     {
-        return ::rocprim::segmented_radix_sort_keys_desc(
-            d_temp_storage, temp_storage_bytes,
-            d_keys_in, d_keys_out, num_items,
-            num_segments, d_begin_offsets, d_end_offsets,
-            0, sizeof(KeyT) * 8,
-            stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::SortKeysDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::segmented_radix_sort_keys_desc(
+                d_temp_storage, temp_storage_bytes,
+                d_keys_in, d_keys_out, num_items,
+                num_segments, d_begin_offsets, d_end_offsets,
+                0, sizeof(KeyT) * 8,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template<typename KeyT, typename OffsetIteratorT>
@@ -222,14 +273,21 @@ struct DeviceSegmentedSort
                                   hipStream_t stream = 0,
                                   bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::SortKeysDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         ::rocprim::double_buffer<KeyT> d_keys_db = detail::to_double_buffer(d_keys);
-        hipError_t error = ::rocprim::segmented_radix_sort_keys_desc(
-            d_temp_storage, temp_storage_bytes,
-            d_keys_db, num_items,
-            num_segments, d_begin_offsets, d_end_offsets,
-            0, sizeof(KeyT) * 8,
-            stream, debug_synchronous
-        );
+        hipError_t error = detail::rocprim_debug_synchronize(
+            ::rocprim::segmented_radix_sort_keys_desc(
+                d_temp_storage, temp_storage_bytes,
+                d_keys_db, num_items,
+                num_segments, d_begin_offsets, d_end_offsets,
+                0, sizeof(KeyT) * 8,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
         detail::update_double_buffer(d_keys, d_keys_db);
         return error;
     }
@@ -249,6 +307,11 @@ struct DeviceSegmentedSort
                                hipStream_t stream = 0,
                                bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::StableSortPairs",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         return SortPairs(
             d_temp_storage, temp_storage_bytes,
             d_keys_in, d_keys_out, d_values_in, d_values_out, num_items,
@@ -270,6 +333,11 @@ struct DeviceSegmentedSort
                                hipStream_t stream = 0,
                                bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::StableSortPairs",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         return SortPairs(
             d_temp_storage, temp_storage_bytes,
             d_keys, d_values, num_items,
@@ -293,6 +361,11 @@ struct DeviceSegmentedSort
                                          hipStream_t stream = 0,
                                          bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::StableSortPairsDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         return SortPairsDescending(
             d_temp_storage, temp_storage_bytes,
             d_keys_in, d_keys_out, d_values_in, d_values_out, num_items,
@@ -314,6 +387,11 @@ struct DeviceSegmentedSort
                                          hipStream_t stream = 0,
                                          bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::StableSortPairsDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         return SortPairsDescending(
             d_temp_storage, temp_storage_bytes,
             d_keys, d_values, num_items,
@@ -335,6 +413,11 @@ struct DeviceSegmentedSort
                               hipStream_t stream = 0,
                               bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::StableSortKeys",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         return SortKeys(
             d_temp_storage, temp_storage_bytes,
             d_keys_in, d_keys_out, num_items,
@@ -355,6 +438,11 @@ struct DeviceSegmentedSort
                               hipStream_t stream = 0,
                               bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::StableSortKeys",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         return SortKeys(
             d_temp_storage, temp_storage_bytes,
             d_keys, num_items,
@@ -376,6 +464,11 @@ struct DeviceSegmentedSort
                                         hipStream_t stream = 0,
                                         bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::StableSortKeysDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         return SortKeysDescending(
             d_temp_storage, temp_storage_bytes,
             d_keys_in, d_keys_out, num_items,
@@ -396,6 +489,11 @@ struct DeviceSegmentedSort
                                         hipStream_t stream = 0,
                                         bool debug_synchronous = false)
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSegmentedSort::StableSortKeysDescending",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         return SortKeysDescending(
             d_temp_storage, temp_storage_bytes,
             d_keys, num_items,
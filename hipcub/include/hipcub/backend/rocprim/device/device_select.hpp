@@ -31,6 +31,8 @@
 #define HIPCUB_ROCPRIM_DEVICE_DEVICE_SELECT_HPP_
 
 #include "../../../config.hpp"
+#include "../../../util_launch_recorder_fwd.hpp"
+#include "../../../util_trace.hpp"
 
 #include "../thread/thread_operators.hpp"
 
@@ -38,7 +40,13 @@
 
 BEGIN_HIPCUB_NAMESPACE
 
-class DeviceSelect
+/// \brief DeviceSelect with a user provided rocPRIM configuration.
+///
+/// \tparam Config - ::rocprim::select_config used by Flagged, If and Unique.
+/// UniqueByKey always uses the default configuration.
+/// This is an extension of the rocPRIM backend and is not available with CUB.
+template<class Config = ::rocprim::default_config>
+class DeviceSelectWithConfig
 {
 public:
     template <
@@ -58,11 +66,18 @@ public:
                        hipStream_t stream = 0,
                        bool debug_synchronous = false)
     {
-        return ::rocprim::select(
-            d_temp_storage, temp_storage_bytes,
-            d_in, d_flags, d_out, d_num_selected_out, num_items,
-            stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSelect::Flagged",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::select<Config>(
+                d_temp_storage, temp_storage_bytes,
+                d_in, d_flags, d_out, d_num_selected_out, num_items,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template <
@@ -82,11 +97,18 @@ public:
                   hipStream_t stream = 0,
                   bool debug_synchronous = false)
     {
-        return ::rocprim::select(
-            d_temp_storage, temp_storage_bytes,
-            d_in, d_out, d_num_selected_out, num_items, select_op,
-            stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSelect::If",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::select<Config>(
+                d_temp_storage, temp_storage_bytes,
+                d_in, d_out, d_num_selected_out, num_items, select_op,
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template <
@@ -104,11 +126,18 @@ public:
                       hipStream_t stream = 0,
                       bool debug_synchronous = false)
     {
-        return ::rocprim::unique(
-            d_temp_storage, temp_storage_bytes,
-            d_in, d_out, d_num_selected_out, num_items, hipcub::Equality(),
-            stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSelect::Unique",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::unique<Config>(
+                d_temp_storage, temp_storage_bytes,
+                d_in, d_out, d_num_selected_out, num_items, hipcub::Equality(),
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 
     template <
@@ -130,16 +159,26 @@ public:
                            hipStream_t stream = 0,
                            bool debug_synchronous = false)
     {
-        return ::rocprim::unique_by_key(
-            d_temp_storage, temp_storage_bytes,
-            d_keys_input, d_values_input, 
-            d_keys_output, d_values_output,
-            d_num_selected_out, num_items, hipcub::Equality(),
-            stream, debug_synchronous
-        );
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSelect::UniqueByKey",
+                                  num_items,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
+        return detail::rocprim_debug_synchronize(
+            ::rocprim::unique_by_key(
+                d_temp_storage, temp_storage_bytes,
+                d_keys_input, d_values_input, 
+                d_keys_output, d_values_output,
+                d_num_selected_out, num_items, hipcub::Equality(),
+                stream, detail::rocprim_debug_synchronous(debug_synchronous)
+            ),
+            stream, debug_synchronous);
     }
 };
 
+class DeviceSelect : public DeviceSelectWithConfig<>
+{};
+
 END_HIPCUB_NAMESPACE
 
 #endif // HIPCUB_ROCPRIM_DEVICE_DEVICE_SELECT_HPP_
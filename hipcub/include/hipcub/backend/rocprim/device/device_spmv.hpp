@@ -31,6 +31,8 @@
 #define HIPCUB_ROCPRIM_DEVICE_DEVICE_SPMV_HPP_
 
 #include "../../../config.hpp"
+#include "../../../util_launch_recorder.hpp"
+#include "../../../util_trace.hpp"
 
 #include "../iterator/tex_ref_input_iterator.hpp"
 
@@ -116,6 +118,11 @@ template <typename ValueT>
         hipStream_t         stream                  = 0,        ///< [in] <b>[optional]</b> hip stream to launch kernels within.  Default is stream<sub>0</sub>.
         bool                debug_synchronous       = false)    ///< [in] <b>[optional]</b> Whether or not to synchronize the stream after every kernel launch to check for errors.  May cause significant slowdown.  Default is \p false.
     {
+        HIPCUB_DETAIL_TRACE_SCOPE("DeviceSpmv::CsrMV",
+                                  num_nonzeros,
+                                  d_temp_storage,
+                                  temp_storage_bytes,
+                                  stream);
         SpmvParams<ValueT, int> spmv_params;
         spmv_params.d_values             = d_values;
         spmv_params.d_row_end_offsets    = d_row_offsets + 1;
@@ -140,8 +147,16 @@ template <typename ValueT>
         {
             size_t block_size = min(num_cols, DeviceSpmv::CsrMVKernel_MaxThreads);
             size_t grid_size = num_rows;
-            CsrMVKernel<<<grid_size, block_size, 0, stream>>>(spmv_params);
-            status = hipGetLastError();
+            status = detail::record_launch("CsrMVKernel",
+                                           dim3(grid_size),
+                                           dim3(block_size),
+                                           0,
+                                           stream,
+                                           debug_synchronous,
+                                           [&] {
+                                               CsrMVKernel<<<grid_size, block_size, 0, stream>>>(
+                                                   spmv_params);
+                                           });
         }
         return status;
     }
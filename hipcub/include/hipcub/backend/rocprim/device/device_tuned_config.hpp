@@ -0,0 +1,248 @@
+// MIT License
+//
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef HIPCUB_ROCPRIM_DEVICE_DEVICE_TUNED_CONFIG_HPP_
+#define HIPCUB_ROCPRIM_DEVICE_DEVICE_TUNED_CONFIG_HPP_
+
+#include "../../../config.hpp"
+
+#include <rocprim/device/config_types.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+BEGIN_HIPCUB_NAMESPACE
+
+namespace detail
+{
+
+// Database of tuned rocPRIM configurations used by the Device* structs when no
+// configuration is given explicitly and HIPCUB_ENABLE_TUNED_CONFIG is defined. An entry is
+// keyed by algorithm, target architecture, key size, value size (0 for keys only) and size
+// class of the input. Missing entries fall back to the defaults of rocPRIM. Entries are
+// defined with HIPCUB_DETAIL_TUNED_CONFIG in the header of the algorithm, so that including
+// one algorithm does not include the configurations of the others.
+//
+// The database ships empty, so HIPCUB_ENABLE_TUNED_CONFIG does not change any configuration
+// yet. An entry only belongs here together with the benchmark_device_tuning results it was
+// taken from: every entry changes the default dispatch of its target and adds kernel
+// instantiations for all targets.
+
+// Targets that can have entries: the default GPU_TARGETS of CMakeLists.txt. Each target has
+// the value rocPRIM uses for it in rocprim::detail::target_arch (gfx90a is 910). Targets
+// that the installed rocPRIM does not know are reported by it as unknown and use the
+// entries of tuned_arch::unknown.
+#define HIPCUB_DETAIL_TUNED_ARCHS(X) \
+    X(gfx803, 803)                   \
+    X(gfx900, 900)                   \
+    X(gfx906, 906)                   \
+    X(gfx908, 908)                   \
+    X(gfx90a, 910)                   \
+    X(gfx940, 940)                   \
+    X(gfx941, 941)                   \
+    X(gfx942, 942)                   \
+    X(gfx1030, 1030)                 \
+    X(gfx1100, 1100)                 \
+    X(gfx1101, 1101)                 \
+    X(gfx1102, 1102)
+
+using target_arch_value = std::underlying_type<::rocprim::detail::target_arch>::type;
+
+enum class tuned_arch : target_arch_value
+{
+    unknown = 0,
+#define HIPCUB_DETAIL_TUNED_ARCH_ENUMERATOR(name, value) name = value,
+    HIPCUB_DETAIL_TUNED_ARCHS(HIPCUB_DETAIL_TUNED_ARCH_ENUMERATOR)
+#undef HIPCUB_DETAIL_TUNED_ARCH_ENUMERATOR
+};
+
+#define HIPCUB_DETAIL_TUNED_ARCH_MATCHES(name)                                                 \
+    static_assert(static_cast<target_arch_value>(tuned_arch::name)                             \
+                      == static_cast<target_arch_value>(::rocprim::detail::target_arch::name), \
+                  "tuned_arch::" #name " does not match rocprim::detail::target_arch");
+HIPCUB_DETAIL_TUNED_ARCH_MATCHES(gfx803)
+HIPCUB_DETAIL_TUNED_ARCH_MATCHES(gfx900)
+HIPCUB_DETAIL_TUNED_ARCH_MATCHES(gfx906)
+HIPCUB_DETAIL_TUNED_ARCH_MATCHES(gfx908)
+HIPCUB_DETAIL_TUNED_ARCH_MATCHES(gfx90a)
+HIPCUB_DETAIL_TUNED_ARCH_MATCHES(gfx1030)
+#undef HIPCUB_DETAIL_TUNED_ARCH_MATCHES
+
+enum class tuned_algorithm
+{
+    reduce,
+    scan,
+    radix_sort
+};
+
+enum class tuned_size_class
+{
+    small, // at most 2^16 items
+    medium, // at most 2^22 items
+    large
+};
+
+constexpr tuned_size_class get_tuned_size_class(size_t num_items)
+{
+    return num_items <= (size_t(1) << 16)   ? tuned_size_class::small
+           : num_items <= (size_t(1) << 22) ? tuned_size_class::medium
+                                            : tuned_size_class::large;
+}
+
+template<tuned_algorithm  Algorithm,
+         tuned_arch       Arch,
+         size_t           KeySize,
+         size_t           ValueSize,
+         tuned_size_class SizeClass>
+struct tuned_config
+{
+    using type = ::rocprim::default_config;
+};
+
+#define HIPCUB_DETAIL_TUNED_CONFIG(algorithm, arch, key_size, value_size, size_class, ...) \
+    template<>                                                                            \
+    struct tuned_config<tuned_algorithm::algorithm,                                       \
+                        tuned_arch::arch,                                                 \
+                        key_size,                                                         \
+                        value_size,                                                       \
+                        tuned_size_class::size_class>                                     \
+    {                                                                                     \
+        using type = __VA_ARGS__;                                                         \
+    };
+
+template<class Config>
+struct tuned_config_tag
+{
+    using type = Config;
+};
+
+template<tuned_algorithm  Algorithm,
+         tuned_arch       Arch,
+         size_t           KeySize,
+         size_t           ValueSize,
+         tuned_size_class SizeClass>
+using tuned_config_tag_t
+    = tuned_config_tag<typename tuned_config<Algorithm, Arch, KeySize, ValueSize, SizeClass>::type>;
+
+template<tuned_algorithm Algorithm,
+         tuned_arch      Arch,
+         size_t          KeySize,
+         size_t          ValueSize,
+         class Function>
+inline hipError_t dispatch_tuned_size_class(size_t num_items, Function&& function)
+{
+    using size_class = tuned_size_class;
+    switch(get_tuned_size_class(num_items))
+    {
+        case size_class::small:
+            return function(
+                tuned_config_tag_t<Algorithm, Arch, KeySize, ValueSize, size_class::small>{});
+        case size_class::medium:
+            return function(
+                tuned_config_tag_t<Algorithm, Arch, KeySize, ValueSize, size_class::medium>{});
+        default:
+            return function(
+                tuned_config_tag_t<Algorithm, Arch, KeySize, ValueSize, size_class::large>{});
+    }
+}
+
+/// Calls \p function with a \p tuned_config_tag of the database entry for \p arch and the
+/// size class of \p num_items.
+template<tuned_algorithm Algorithm, size_t KeySize, size_t ValueSize, class Function>
+inline hipError_t dispatch_tuned_config_for_arch(::rocprim::detail::target_arch arch,
+                                                 size_t                         num_items,
+                                                 Function&&                     function)
+{
+    switch(static_cast<target_arch_value>(arch))
+    {
+#define HIPCUB_DETAIL_TUNED_CONFIG_CASE(name, value)                                       \
+    case value:                                                                            \
+        return dispatch_tuned_size_class<Algorithm, tuned_arch::name, KeySize, ValueSize>( \
+            num_items,                                                                     \
+            function);
+        HIPCUB_DETAIL_TUNED_ARCHS(HIPCUB_DETAIL_TUNED_CONFIG_CASE)
+#undef HIPCUB_DETAIL_TUNED_CONFIG_CASE
+        default:
+            return dispatch_tuned_size_class<Algorithm,
+                                             tuned_arch::unknown,
+                                             KeySize,
+                                             ValueSize>(num_items, function);
+    }
+}
+
+template<class Config, tuned_algorithm, size_t, size_t, class Function>
+inline hipError_t dispatch_tuned_config(std::false_type /*default_config*/,
+                                        size_t /*num_items*/,
+                                        hipStream_t /*stream*/,
+                                        Function&& function)
+{
+    return function(tuned_config_tag<Config>{});
+}
+
+template<class Config,
+         tuned_algorithm Algorithm,
+         size_t          KeySize,
+         size_t          ValueSize,
+         class Function>
+inline hipError_t dispatch_tuned_config(std::true_type /*default_config*/,
+                                        size_t      num_items,
+                                        hipStream_t stream,
+                                        Function&&  function)
+{
+    ::rocprim::detail::target_arch arch;
+    hipError_t result = ::rocprim::detail::host_target_arch(stream, arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    return dispatch_tuned_config_for_arch<Algorithm, KeySize, ValueSize>(arch,
+                                                                         num_items,
+                                                                         function);
+}
+
+/// Calls \p function with a \p tuned_config_tag of \p Config. If \p HIPCUB_ENABLE_TUNED_CONFIG
+/// is defined and \p Config is \p rocprim::default_config, the database entry for the device
+/// of \p stream and the size class of \p num_items is used instead. Without the macro no
+/// target lookup is done.
+template<class Config,
+         tuned_algorithm Algorithm,
+         size_t          KeySize,
+         size_t          ValueSize,
+         class Function>
+inline hipError_t dispatch_tuned_config(size_t num_items, hipStream_t stream, Function&& function)
+{
+#ifdef HIPCUB_ENABLE_TUNED_CONFIG
+    using use_database = std::is_same<Config, ::rocprim::default_config>;
+#else
+    using use_database = std::false_type;
+#endif
+    return dispatch_tuned_config<Config, Algorithm, KeySize, ValueSize>(use_database{},
+                                                                        num_items,
+                                                                        stream,
+                                                                        function);
+}
+
+} // namespace detail
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_ROCPRIM_DEVICE_DEVICE_TUNED_CONFIG_HPP_
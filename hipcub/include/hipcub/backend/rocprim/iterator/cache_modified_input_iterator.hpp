@@ -31,9 +31,9 @@
 #define HIPCUB_ROCPRIM_ITERATOR_CACHE_MODIFIED_INPUT_ITERATOR_HPP_
 
 #include <iterator>
-#include <iostream>
+#include <ostream>
 
-#include "../thread/thread_load.hpp"
+#include "../../../thread/thread_load.hpp"
 #include "../util_type.hpp"
 
 #if (THRUST_VERSION >= 100700)
@@ -31,10 +31,10 @@
 #define HIPCUB_ROCPRIM_ITERATOR_CACHE_MODIFIED_OUTPUT_ITERATOR_HPP_
 
 #include <iterator>
-#include <iostream>
+#include <ostream>
 
-#include "../thread/thread_load.hpp"
-#include "../thread/thread_store.hpp"
+#include "../../../thread/thread_load.hpp"
+#include "../../../thread/thread_store.hpp"
 #include "../util_type.hpp"
 
 #if (THRUST_VERSION >= 100700)
@@ -31,7 +31,6 @@
 #define HIPCUB_ROCPRIM_ITERATOR_CONSTANT_INPUT_ITERATOR_HPP_
 
 #include <iterator>
-#include <iostream>
 
 #include "../../../config.hpp"
 
@@ -31,7 +31,7 @@
 #define HIPCUB_ROCPRIM_ITERATOR_DISCARD_OUTPUT_ITERATOR_HPP_
 
 #include <iterator>
-#include <iostream>
+#include <ostream>
 
 #include "../../../config.hpp"
 
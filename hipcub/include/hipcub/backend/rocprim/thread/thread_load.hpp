@@ -29,6 +29,12 @@
 
 #ifndef HIPCUB_ROCPRIM_THREAD_THREAD_LOAD_HPP_
 #define HIPCUB_ROCPRIM_THREAD_THREAD_LOAD_HPP_
+
+#include <hip/hip_bfloat16.h>
+#include <hip/hip_fp16.h>
+
+#include "../../../config.hpp"
+
 BEGIN_HIPCUB_NAMESPACE
 
 enum CacheLoadModifier : int32_t
@@ -42,10 +48,21 @@ enum CacheLoadModifier : int32_t
     LOAD_VOLATILE,  ///< Volatile (any memory space)
 };
 
+namespace detail
+{
+
+// Register types of the 64-, 96- and 128-bit memory instructions. They are only dword
+// aligned, so they can stand in for HIP vector types such as float3 and float4.
+typedef uint32_t uint32x2_t __attribute__((ext_vector_type(2), aligned(4)));
+typedef uint32_t uint32x3_t __attribute__((ext_vector_type(3), aligned(4)));
+typedef uint32_t uint32x4_t __attribute__((ext_vector_type(4), aligned(4)));
+
+} // namespace detail
+
 template<CacheLoadModifier MODIFIER = LOAD_DEFAULT, typename T>
 HIPCUB_DEVICE __forceinline__ T AsmThreadLoad(void * ptr)
 {
-    T retval = 0;
+    T retval;
     __builtin_memcpy(&retval, ptr, sizeof(T));
     return retval;
 }
@@ -54,6 +71,8 @@ HIPCUB_DEVICE __forceinline__ T AsmThreadLoad(void * ptr)
 
 // Important for syncing. Check section 9.2.2 or 7.3 in the following document
 // https://developer.amd.com/wordpress/media/2013/12/AMD_GCN3_Instruction_Set_Architecture_rev1.1.pdf
+// The loaded bits are copied (not converted) from interim_type, so float and vector
+// types can share the integer register types.
 #define HIPCUB_ASM_THREAD_LOAD(cache_modifier,                                                                \
                                llvm_cache_modifier,                                                           \
                                type,                                                                          \
@@ -69,35 +88,96 @@ HIPCUB_DEVICE __forceinline__ T AsmThreadLoad(void * ptr)
             #asm_operator " %0, %1 " llvm_cache_modifier "\n"                                                 \
             "\ts_waitcnt " wait_cmd "(0)" : "=" #output_modifier(retval) : "v"(ptr)                            \
         );                                                                                                    \
-        return retval;                                                                                        \
+        type result;                                                                                          \
+        __builtin_memcpy(&result, &retval, sizeof(type));                                                     \
+        return result;                                                                                        \
     }
 
-// TODO Add specialization for custom larger data types
-#define HIPCUB_ASM_THREAD_LOAD_GROUP(cache_modifier, llvm_cache_modifier, wait_cmd)                                  \
-    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, int8_t, int16_t, flat_load_sbyte, v, wait_cmd);      \
-    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, int16_t, int16_t, flat_load_sshort, v, wait_cmd);    \
-    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, uint8_t, uint16_t, flat_load_ubyte, v, wait_cmd);    \
-    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, uint16_t, uint16_t, flat_load_ushort, v, wait_cmd);  \
-    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, uint32_t, uint32_t, flat_load_dword, v, wait_cmd);   \
-    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, float, uint32_t, flat_load_dword, v, wait_cmd);      \
-    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, uint64_t, uint64_t, flat_load_dwordx2, v, wait_cmd); \
-    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, double, uint64_t, flat_load_dwordx2, v, wait_cmd);
+#define HIPCUB_ASM_THREAD_LOAD_GROUP(cache_modifier, llvm_cache_modifier, wait_cmd)                                             \
+    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, int8_t, int16_t, flat_load_sbyte, v, wait_cmd);                 \
+    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, char, int16_t, flat_load_sbyte, v, wait_cmd);                   \
+    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, int16_t, int16_t, flat_load_sshort, v, wait_cmd);               \
+    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, uint8_t, uint16_t, flat_load_ubyte, v, wait_cmd);               \
+    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, uint16_t, uint16_t, flat_load_ushort, v, wait_cmd);             \
+    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, __half, uint16_t, flat_load_ushort, v, wait_cmd);               \
+    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, hip_bfloat16, uint16_t, flat_load_ushort, v, wait_cmd);         \
+    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, int32_t, uint32_t, flat_load_dword, v, wait_cmd);               \
+    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, uint32_t, uint32_t, flat_load_dword, v, wait_cmd);              \
+    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, float, uint32_t, flat_load_dword, v, wait_cmd);                 \
+    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, int64_t, uint64_t, flat_load_dwordx2, v, wait_cmd);             \
+    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, uint64_t, uint64_t, flat_load_dwordx2, v, wait_cmd);            \
+    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, double, uint64_t, flat_load_dwordx2, v, wait_cmd);              \
+    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, int2, uint64_t, flat_load_dwordx2, v, wait_cmd);                \
+    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, uint2, uint64_t, flat_load_dwordx2, v, wait_cmd);               \
+    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, float2, uint64_t, flat_load_dwordx2, v, wait_cmd);              \
+    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, int3, detail::uint32x3_t, flat_load_dwordx3, v, wait_cmd);      \
+    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, uint3, detail::uint32x3_t, flat_load_dwordx3, v, wait_cmd);     \
+    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, float3, detail::uint32x3_t, flat_load_dwordx3, v, wait_cmd);    \
+    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, int4, detail::uint32x4_t, flat_load_dwordx4, v, wait_cmd);      \
+    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, uint4, detail::uint32x4_t, flat_load_dwordx4, v, wait_cmd);     \
+    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, float4, detail::uint32x4_t, flat_load_dwordx4, v, wait_cmd);    \
+    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, double2, detail::uint32x4_t, flat_load_dwordx4, v, wait_cmd);   \
+    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, longlong2, detail::uint32x4_t, flat_load_dwordx4, v, wait_cmd); \
+    HIPCUB_ASM_THREAD_LOAD(cache_modifier, llvm_cache_modifier, ulonglong2, detail::uint32x4_t, flat_load_dwordx4, v, wait_cmd);
 
+// Streaming loads go through the compiler's non-temporal load, which picks the target's
+// streaming cache policy (glc slc, or nt on gfx94x) and leaves the wait to the scheduler.
+#define HIPCUB_NONTEMPORAL_THREAD_LOAD(type, interim_type)                                                    \
+    template<>                                                                                                \
+    HIPCUB_DEVICE __forceinline__ type AsmThreadLoad<LOAD_CS, type>(void * ptr)                               \
+    {                                                                                                         \
+        const interim_type retval = __builtin_nontemporal_load(static_cast<interim_type *>(ptr));             \
+        type result;                                                                                          \
+        __builtin_memcpy(&result, &retval, sizeof(type));                                                     \
+        return result;                                                                                        \
+    }
+
+#define HIPCUB_NONTEMPORAL_THREAD_LOAD_GROUP()                     \
+    HIPCUB_NONTEMPORAL_THREAD_LOAD(int8_t, int8_t);                \
+    HIPCUB_NONTEMPORAL_THREAD_LOAD(char, int8_t);                  \
+    HIPCUB_NONTEMPORAL_THREAD_LOAD(int16_t, int16_t);              \
+    HIPCUB_NONTEMPORAL_THREAD_LOAD(uint8_t, uint8_t);              \
+    HIPCUB_NONTEMPORAL_THREAD_LOAD(uint16_t, uint16_t);            \
+    HIPCUB_NONTEMPORAL_THREAD_LOAD(__half, uint16_t);              \
+    HIPCUB_NONTEMPORAL_THREAD_LOAD(hip_bfloat16, uint16_t);        \
+    HIPCUB_NONTEMPORAL_THREAD_LOAD(int32_t, uint32_t);             \
+    HIPCUB_NONTEMPORAL_THREAD_LOAD(uint32_t, uint32_t);            \
+    HIPCUB_NONTEMPORAL_THREAD_LOAD(float, uint32_t);               \
+    HIPCUB_NONTEMPORAL_THREAD_LOAD(int64_t, detail::uint32x2_t);   \
+    HIPCUB_NONTEMPORAL_THREAD_LOAD(uint64_t, detail::uint32x2_t);  \
+    HIPCUB_NONTEMPORAL_THREAD_LOAD(double, detail::uint32x2_t);    \
+    HIPCUB_NONTEMPORAL_THREAD_LOAD(int2, detail::uint32x2_t);      \
+    HIPCUB_NONTEMPORAL_THREAD_LOAD(uint2, detail::uint32x2_t);     \
+    HIPCUB_NONTEMPORAL_THREAD_LOAD(float2, detail::uint32x2_t);    \
+    HIPCUB_NONTEMPORAL_THREAD_LOAD(int3, detail::uint32x3_t);      \
+    HIPCUB_NONTEMPORAL_THREAD_LOAD(uint3, detail::uint32x3_t);     \
+    HIPCUB_NONTEMPORAL_THREAD_LOAD(float3, detail::uint32x3_t);    \
+    HIPCUB_NONTEMPORAL_THREAD_LOAD(int4, detail::uint32x4_t);      \
+    HIPCUB_NONTEMPORAL_THREAD_LOAD(uint4, detail::uint32x4_t);     \
+    HIPCUB_NONTEMPORAL_THREAD_LOAD(float4, detail::uint32x4_t);    \
+    HIPCUB_NONTEMPORAL_THREAD_LOAD(double2, detail::uint32x4_t);   \
+    HIPCUB_NONTEMPORAL_THREAD_LOAD(longlong2, detail::uint32x4_t); \
+    HIPCUB_NONTEMPORAL_THREAD_LOAD(ulonglong2, detail::uint32x4_t);
+
+// gfx94x replaced glc/slc with sc0/sc1, the rest of the modifier mapping is shared
 #if defined(__gfx940__) || defined(__gfx941__) || defined(__gfx942__)
-HIPCUB_ASM_THREAD_LOAD_GROUP(LOAD_CA, "sc0", "");
-HIPCUB_ASM_THREAD_LOAD_GROUP(LOAD_CG, "sc1", "");
-HIPCUB_ASM_THREAD_LOAD_GROUP(LOAD_CV, "sc0 sc1", "vmcnt");
-HIPCUB_ASM_THREAD_LOAD_GROUP(LOAD_VOLATILE, "sc0 sc1", "vmcnt");
+    #define HIPCUB_ASM_THREAD_LOAD_CA_MODIFIER "sc0"
+    #define HIPCUB_ASM_THREAD_LOAD_CG_MODIFIER "sc1"
+    #define HIPCUB_ASM_THREAD_LOAD_CV_MODIFIER "sc0 sc1"
 #else
-HIPCUB_ASM_THREAD_LOAD_GROUP(LOAD_CA, "glc", "");
-HIPCUB_ASM_THREAD_LOAD_GROUP(LOAD_CG, "glc slc", "");
-HIPCUB_ASM_THREAD_LOAD_GROUP(LOAD_CV, "glc", "vmcnt");
-HIPCUB_ASM_THREAD_LOAD_GROUP(LOAD_VOLATILE, "glc", "vmcnt");
+    #define HIPCUB_ASM_THREAD_LOAD_CA_MODIFIER "glc"
+    #define HIPCUB_ASM_THREAD_LOAD_CG_MODIFIER "glc slc"
+    #define HIPCUB_ASM_THREAD_LOAD_CV_MODIFIER "glc"
 #endif
 
+HIPCUB_ASM_THREAD_LOAD_GROUP(LOAD_CA, HIPCUB_ASM_THREAD_LOAD_CA_MODIFIER, "");
+HIPCUB_ASM_THREAD_LOAD_GROUP(LOAD_CG, HIPCUB_ASM_THREAD_LOAD_CG_MODIFIER, "");
+HIPCUB_ASM_THREAD_LOAD_GROUP(LOAD_CV, HIPCUB_ASM_THREAD_LOAD_CV_MODIFIER, "vmcnt");
+HIPCUB_ASM_THREAD_LOAD_GROUP(LOAD_VOLATILE, HIPCUB_ASM_THREAD_LOAD_CV_MODIFIER, "vmcnt");
+HIPCUB_NONTEMPORAL_THREAD_LOAD_GROUP();
+
 // TODO find correct modifiers to match these
 HIPCUB_ASM_THREAD_LOAD_GROUP(LOAD_LDG, "", "");
-HIPCUB_ASM_THREAD_LOAD_GROUP(LOAD_CS, "", "");
 
 #endif
 
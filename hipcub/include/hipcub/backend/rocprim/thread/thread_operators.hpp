@@ -152,6 +152,77 @@ struct ArgMin
     }
 };
 
+namespace detail
+{
+
+/// Exact rounding error of <tt>sum = a + b</tt> (Knuth's TwoSum). This relies on IEEE
+/// arithmetic: it must not be compiled with reassociation (e.g. <tt>-ffast-math</tt>).
+/// The error of an infinite or NaN \p sum is 0, TwoSum itself would turn it into NaN.
+template<class T>
+HIPCUB_HOST_DEVICE inline
+T two_sum_error(const T a, const T b, const T sum)
+{
+    // sum - sum is NaN exactly when sum is infinite or NaN
+    if(!(sum - sum == T(0)))
+    {
+        return T(0);
+    }
+    const T b_virtual = sum - a;
+    const T a_virtual = sum - b_virtual;
+    return (a - a_virtual) + (b - b_virtual);
+}
+
+} // end detail namespace
+
+/// \brief Compensated summation. The exact rounding error of every addition is carried in
+/// the \p compensation of a \p KahanPair instead of being lost, so floats are summed with
+/// close to twice their precision.
+///
+/// Adding two \p T values or a \p T to a \p KahanPair<T> returns a \p KahanPair<T>, so the
+/// device reductions accumulate pairs while reading and writing \p T. \p ThreadReduce over
+/// \p T also accumulates a pair; \p BlockReduce needs \p KahanPair<T> as its value type.
+///
+/// Once the sum overflows or becomes NaN, it is propagated like a plain sum with a zero
+/// compensation.
+struct KahanSum
+{
+    template<class T>
+    HIPCUB_HOST_DEVICE inline
+    KahanPair<T> operator()(const KahanPair<T>& a, const KahanPair<T>& b) const
+    {
+        const T sum          = a.sum + b.sum;
+        const T compensation = (a.compensation + b.compensation)
+                               + detail::two_sum_error(a.sum, b.sum, sum);
+        // Fold the compensation back into the sum, so that it stays below an ulp of the sum
+        // instead of growing like a second naive sum.
+        const T renormalized = sum + compensation;
+        return KahanPair<T>(renormalized,
+                            detail::two_sum_error(sum, compensation, renormalized));
+    }
+
+    template<class T>
+    HIPCUB_HOST_DEVICE inline
+    KahanPair<T> operator()(const KahanPair<T>& a, const T& b) const
+    {
+        return (*this)(a, KahanPair<T>(b));
+    }
+
+    template<class T>
+    HIPCUB_HOST_DEVICE inline
+    KahanPair<T> operator()(const T& a, const KahanPair<T>& b) const
+    {
+        return (*this)(KahanPair<T>(a), b);
+    }
+
+    template<class T>
+    HIPCUB_HOST_DEVICE inline
+    typename std::enable_if<std::is_floating_point<T>::value, KahanPair<T>>::type
+    operator()(const T& a, const T& b) const
+    {
+        return (*this)(KahanPair<T>(a), KahanPair<T>(b));
+    }
+};
+
 template <typename B>
 struct CastOp
 {
@@ -276,6 +347,28 @@ BinaryFlip<BinaryOpT> MakeBinaryFlip(BinaryOpT binary_op)
 namespace detail
 {
 
+/// Type in which a reduction with \p BinaryFunction accumulates values of \p T.
+template<class BinaryFunction, class T>
+struct reduce_accumulator
+{
+    using type = T;
+};
+
+template<class T>
+struct reduce_accumulator<KahanSum, T>
+{
+    using type = KahanPair<T>;
+};
+
+template<class T>
+struct reduce_accumulator<KahanSum, KahanPair<T>>
+{
+    using type = KahanPair<T>;
+};
+
+template<class BinaryFunction, class T>
+using reduce_accumulator_t = typename reduce_accumulator<BinaryFunction, T>::type;
+
 // CUB uses value_type of OutputIteratorT (if not void) as a type of intermediate results in reduce,
 // for example:
 //
@@ -305,16 +398,20 @@ struct convert_result_type_wrapper
 {
     using input_type = typename std::iterator_traits<InputIteratorT>::value_type;
     using output_type = typename std::iterator_traits<OutputIteratorT>::value_type;
-    using result_type =
-        typename std::conditional<
-            std::is_void<output_type>::value, input_type, output_type
-        >::type;
+    // 8-bit floats are accumulated in float and only rounded when stored.
+    // KahanSum accumulates (sum, compensation) pairs and only rounds when stored.
+    using result_type = reduce_accumulator_t<
+        BinaryFunction,
+        accumulator_t<
+            typename std::conditional<
+                std::is_void<output_type>::value, input_type, output_type
+            >::type>>;
 
     convert_result_type_wrapper(BinaryFunction op) : op(op) {}
 
-    template<class T>
+    template<class T, class U>
     HIPCUB_HOST_DEVICE inline
-    constexpr result_type operator()(const T &a, const T &b) const
+    constexpr result_type operator()(const T &a, const U &b) const
     {
         return static_cast<result_type>(op(a, b));
     }
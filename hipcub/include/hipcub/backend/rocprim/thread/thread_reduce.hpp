@@ -30,20 +30,161 @@
 #ifndef HIPCUB_ROCPRIM_THREAD_THREAD_REDUCE_HPP_
 #define HIPCUB_ROCPRIM_THREAD_THREAD_REDUCE_HPP_
 
+#include <type_traits>
+
+#include <hip/hip_bfloat16.h>
+#include <hip/hip_fp16.h>
+
+#include "../../../config.hpp"
+
+#include "thread_operators.hpp"
+
 BEGIN_HIPCUB_NAMESPACE
 
+namespace detail
+{
+
+/// \p Sum, \p Max and \p Min over \p __half and \p hip_bfloat16 are reduced in float, so
+/// that only the result is rounded to the 16-bit type.
+template<class T, class ReductionOp>
+struct is_widened_thread_reduce
+    : std::integral_constant<bool,
+                             (std::is_same<T, __half>::value
+                              || std::is_same<T, hip_bfloat16>::value)
+                                 && (std::is_same<ReductionOp, ::hipcub::Sum>::value
+                                     || std::is_same<ReductionOp, ::hipcub::Max>::value
+                                     || std::is_same<ReductionOp, ::hipcub::Min>::value)>
+{};
+
+/// Widens a 32-bit word holding two consecutive 16-bit floats to a pair of floats.
+template<class T>
+struct widened_pair;
+
+template<>
+struct widened_pair<__half>
+{
+    HIPCUB_DEVICE static inline void unpack(unsigned int word, float& lo, float& hi)
+    {
+        __half2 pair;
+        __builtin_memcpy(&pair, &word, sizeof(pair));
+        const float2 widened = __half22float2(pair);
+        lo                   = widened.x;
+        hi                   = widened.y;
+    }
+};
+
+template<>
+struct widened_pair<hip_bfloat16>
+{
+    HIPCUB_DEVICE static inline void unpack(unsigned int word, float& lo, float& hi)
+    {
+        // bfloat16 is the upper half of a float, so widening is a shift
+        const unsigned int lo_bits = word << 16;
+        const unsigned int hi_bits = word & 0xFFFF0000u;
+        __builtin_memcpy(&lo, &lo_bits, sizeof(lo));
+        __builtin_memcpy(&hi, &hi_bits, sizeof(hi));
+    }
+};
+
+/// Reduces \p LENGTH 16-bit floats into a float. The items are read one pair at a time and
+/// the even and odd items go to two independent accumulators, which start from the first
+/// pair rather than from an identity. The accumulators are combined as (even, odd) and the
+/// odd last item, if any, comes last. A sum of -0.0 items is -0.0, and \p Max and \p Min
+/// return NaN for the same inputs as the serial reduction (a NaN first item for \p Max, a
+/// NaN last item for \p Min).
+template<int LENGTH, typename T, typename ReductionOp>
+HIPCUB_DEVICE inline float thread_reduce_widened(const T* input, ReductionOp reduction_op)
+{
+    static_assert(is_widened_thread_reduce<T, ReductionOp>::value,
+                  "thread_reduce_widened requires a 16-bit float type and Sum, Max or Min");
+
+    constexpr int items_per_word = sizeof(unsigned int) / sizeof(T);
+    constexpr int words          = LENGTH / items_per_word;
+    constexpr int tail           = words * items_per_word;
+
+    float result;
+    if HIPCUB_IF_CONSTEXPR(words == 0)
+    {
+        result = static_cast<float>(input[0]);
+    }
+    else
+    {
+        unsigned int word;
+        __builtin_memcpy(&word, input, sizeof(word));
+
+        float lo_acc, hi_acc;
+        widened_pair<T>::unpack(word, lo_acc, hi_acc);
+
+        #pragma unroll
+        for(int i = 1; i < words; ++i)
+        {
+            __builtin_memcpy(&word, input + i * items_per_word, sizeof(word));
+
+            float lo, hi;
+            widened_pair<T>::unpack(word, lo, hi);
+            lo_acc = reduction_op(lo_acc, lo);
+            hi_acc = reduction_op(hi_acc, hi);
+        }
+
+        result = reduction_op(lo_acc, hi_acc);
+        if HIPCUB_IF_CONSTEXPR(tail < LENGTH)
+        {
+            result = reduction_op(result, static_cast<float>(input[tail]));
+        }
+    }
+    return result;
+}
+
+struct thread_reduce_serial_tag
+{};
+
+struct thread_reduce_widened_tag
+{};
+
+struct thread_reduce_compensated_tag
+{};
+
+template<class T, class ReductionOp>
+using thread_reduce_tag_t = typename std::conditional<
+    is_widened_thread_reduce<T, ReductionOp>::value,
+    thread_reduce_widened_tag,
+    typename std::conditional<std::is_same<ReductionOp, ::hipcub::KahanSum>::value
+                                  && std::is_floating_point<T>::value,
+                              thread_reduce_compensated_tag,
+                              thread_reduce_serial_tag>::type>::type;
+
+} // namespace detail
+
 /// Internal namespace (to prevent ADL mishaps between static functions when mixing different CUB installations)
 namespace internal {
 
-template <
-    int         LENGTH,
-    typename    T,
-    typename    ReductionOp,
-    bool        NoPrefix = false>
-__device__ __forceinline__ T ThreadReduce(
-    T*           input,
-    ReductionOp reduction_op,
-    T           prefix = T(0))
+template<int LENGTH, typename T, typename ReductionOp, bool NoPrefix>
+__device__ __forceinline__ T
+    ThreadReduce(T* input, ReductionOp reduction_op, T prefix, detail::thread_reduce_widened_tag)
+{
+    float result = detail::thread_reduce_widened<LENGTH>(input, reduction_op);
+    if(!NoPrefix)
+        result = reduction_op(static_cast<float>(prefix), result);
+
+    return T(result);
+}
+
+template<int LENGTH, typename T, typename ReductionOp, bool NoPrefix>
+__device__ __forceinline__ T
+    ThreadReduce(T* input, ReductionOp reduction_op, T prefix, detail::thread_reduce_compensated_tag)
+{
+    KahanPair<T> retval = NoPrefix ? KahanPair<T>(input[0]) : KahanPair<T>(prefix);
+
+    #pragma unroll
+    for (int i = 0 + NoPrefix; i < LENGTH; ++i)
+        retval = reduction_op(retval, input[i]);
+
+    return static_cast<T>(retval);
+}
+
+template<int LENGTH, typename T, typename ReductionOp, bool NoPrefix>
+__device__ __forceinline__ T
+    ThreadReduce(T* input, ReductionOp reduction_op, T prefix, detail::thread_reduce_serial_tag)
 {
     T retval;
     if(NoPrefix)
@@ -58,6 +199,23 @@ __device__ __forceinline__ T ThreadReduce(
     return retval;
 }
 
+template <
+    int         LENGTH,
+    typename    T,
+    typename    ReductionOp,
+    bool        NoPrefix = false>
+__device__ __forceinline__ T ThreadReduce(
+    T*           input,
+    ReductionOp reduction_op,
+    T           prefix = T(0))
+{
+    return ThreadReduce<LENGTH, T, ReductionOp, NoPrefix>(
+        input,
+        reduction_op,
+        prefix,
+        detail::thread_reduce_tag_t<T, ReductionOp>{});
+}
+
 template <
     int         LENGTH,
     typename    T,
@@ -67,7 +225,7 @@ __device__ __forceinline__ T ThreadReduce(
     ReductionOp reduction_op,
     T           prefix)
 {
-    return ThreadReduce<LENGTH, false>((T*)input, reduction_op, prefix);
+    return ThreadReduce<LENGTH, T, ReductionOp, false>((T*)input, reduction_op, prefix);
 }
 
 template <
@@ -78,7 +236,7 @@ __device__ __forceinline__ T ThreadReduce(
     T           (&input)[LENGTH],
     ReductionOp reduction_op)
 {
-    return ThreadReduce<LENGTH, true>((T*)input, reduction_op);
+    return ThreadReduce<LENGTH, T, ReductionOp, true>((T*)input, reduction_op);
 }
 
 }
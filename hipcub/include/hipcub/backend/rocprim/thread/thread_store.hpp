@@ -29,6 +29,14 @@
 
 #ifndef HIPCUB_ROCPRIM_THREAD_THREAD_STORE_HPP_
 #define HIPCUB_ROCPRIM_THREAD_THREAD_STORE_HPP_
+
+#include <hip/hip_bfloat16.h>
+#include <hip/hip_fp16.h>
+
+#include "../../../config.hpp"
+
+#include "../../../thread/thread_load.hpp"
+
 BEGIN_HIPCUB_NAMESPACE
 
 enum CacheStoreModifier
@@ -56,6 +64,8 @@ HIPCUB_DEVICE __forceinline__ void AsmThreadStore(void * ptr, T val)
 
 // Important for syncing. Check section 9.2.2 or 7.3 in the following document
 // https://developer.amd.com/wordpress/media/2013/12/AMD_GCN3_Instruction_Set_Architecture_rev1.1.pdf
+// The bits of val are copied (not converted) into interim_type, so float and vector
+// types can share the integer register types.
 #define HIPCUB_ASM_THREAD_STORE(cache_modifier,                                                              \
                                 llvm_cache_modifier,                                                         \
                                 type,                                                                        \
@@ -66,37 +76,94 @@ HIPCUB_DEVICE __forceinline__ void AsmThreadStore(void * ptr, T val)
     template<>                                                                                               \
     HIPCUB_DEVICE __forceinline__ void AsmThreadStore<cache_modifier, type>(void * ptr, type val)            \
     {                                                                                                        \
-        interim_type temp_val = val;                                                          \
+        interim_type temp_val{};                                                                             \
+        __builtin_memcpy(&temp_val, &val, sizeof(type));                                                     \
         asm volatile(#asm_operator " %0, %1 " llvm_cache_modifier : : "v"(ptr), #output_modifier(temp_val)); \
         asm volatile("s_waitcnt " wait_cmd "(%0)" : : "I"(0x00));                                            \
     }
 
 // TODO fix flat_store_ubyte and flat_store_sbyte issues
-// TODO Add specialization for custom larger data types
-#define HIPCUB_ASM_THREAD_STORE_GROUP(cache_modifier, llvm_cache_modifier, wait_cmd)                                   \
-    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, int8_t, int16_t, flat_store_byte, v, wait_cmd);       \
-    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, int16_t, int16_t, flat_store_short, v, wait_cmd);     \
-    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, uint8_t, uint16_t, flat_store_byte, v, wait_cmd);     \
-    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, uint16_t, uint16_t, flat_store_short, v, wait_cmd);   \
-    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, uint32_t, uint32_t, flat_store_dword, v, wait_cmd);   \
-    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, float, uint32_t, flat_store_dword, v, wait_cmd);      \
-    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, uint64_t, uint64_t, flat_store_dwordx2, v, wait_cmd); \
-    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, double, uint64_t, flat_store_dwordx2, v, wait_cmd);
+#define HIPCUB_ASM_THREAD_STORE_GROUP(cache_modifier, llvm_cache_modifier, wait_cmd)                                              \
+    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, int8_t, int16_t, flat_store_byte, v, wait_cmd);                  \
+    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, char, int16_t, flat_store_byte, v, wait_cmd);                    \
+    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, int16_t, int16_t, flat_store_short, v, wait_cmd);                \
+    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, uint8_t, uint16_t, flat_store_byte, v, wait_cmd);                \
+    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, uint16_t, uint16_t, flat_store_short, v, wait_cmd);              \
+    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, __half, uint16_t, flat_store_short, v, wait_cmd);                \
+    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, hip_bfloat16, uint16_t, flat_store_short, v, wait_cmd);          \
+    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, int32_t, uint32_t, flat_store_dword, v, wait_cmd);               \
+    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, uint32_t, uint32_t, flat_store_dword, v, wait_cmd);              \
+    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, float, uint32_t, flat_store_dword, v, wait_cmd);                 \
+    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, int64_t, uint64_t, flat_store_dwordx2, v, wait_cmd);             \
+    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, uint64_t, uint64_t, flat_store_dwordx2, v, wait_cmd);            \
+    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, double, uint64_t, flat_store_dwordx2, v, wait_cmd);              \
+    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, int2, uint64_t, flat_store_dwordx2, v, wait_cmd);                \
+    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, uint2, uint64_t, flat_store_dwordx2, v, wait_cmd);               \
+    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, float2, uint64_t, flat_store_dwordx2, v, wait_cmd);              \
+    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, int3, detail::uint32x3_t, flat_store_dwordx3, v, wait_cmd);      \
+    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, uint3, detail::uint32x3_t, flat_store_dwordx3, v, wait_cmd);     \
+    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, float3, detail::uint32x3_t, flat_store_dwordx3, v, wait_cmd);    \
+    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, int4, detail::uint32x4_t, flat_store_dwordx4, v, wait_cmd);      \
+    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, uint4, detail::uint32x4_t, flat_store_dwordx4, v, wait_cmd);     \
+    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, float4, detail::uint32x4_t, flat_store_dwordx4, v, wait_cmd);    \
+    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, double2, detail::uint32x4_t, flat_store_dwordx4, v, wait_cmd);   \
+    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, longlong2, detail::uint32x4_t, flat_store_dwordx4, v, wait_cmd); \
+    HIPCUB_ASM_THREAD_STORE(cache_modifier, llvm_cache_modifier, ulonglong2, detail::uint32x4_t, flat_store_dwordx4, v, wait_cmd);
+
+// Streaming stores go through the compiler's non-temporal store, which picks the target's
+// streaming cache policy (glc slc, or nt on gfx94x) without waiting for completion.
+#define HIPCUB_NONTEMPORAL_THREAD_STORE(type, interim_type)                                                  \
+    template<>                                                                                               \
+    HIPCUB_DEVICE __forceinline__ void AsmThreadStore<STORE_CS, type>(void * ptr, type val)                  \
+    {                                                                                                        \
+        interim_type temp_val;                                                                               \
+        __builtin_memcpy(&temp_val, &val, sizeof(type));                                                     \
+        __builtin_nontemporal_store(temp_val, static_cast<interim_type *>(ptr));                             \
+    }
+
+#define HIPCUB_NONTEMPORAL_THREAD_STORE_GROUP()                     \
+    HIPCUB_NONTEMPORAL_THREAD_STORE(int8_t, int8_t);                \
+    HIPCUB_NONTEMPORAL_THREAD_STORE(char, int8_t);                  \
+    HIPCUB_NONTEMPORAL_THREAD_STORE(int16_t, int16_t);              \
+    HIPCUB_NONTEMPORAL_THREAD_STORE(uint8_t, uint8_t);              \
+    HIPCUB_NONTEMPORAL_THREAD_STORE(uint16_t, uint16_t);            \
+    HIPCUB_NONTEMPORAL_THREAD_STORE(__half, uint16_t);              \
+    HIPCUB_NONTEMPORAL_THREAD_STORE(hip_bfloat16, uint16_t);        \
+    HIPCUB_NONTEMPORAL_THREAD_STORE(int32_t, uint32_t);             \
+    HIPCUB_NONTEMPORAL_THREAD_STORE(uint32_t, uint32_t);            \
+    HIPCUB_NONTEMPORAL_THREAD_STORE(float, uint32_t);               \
+    HIPCUB_NONTEMPORAL_THREAD_STORE(int64_t, detail::uint32x2_t);   \
+    HIPCUB_NONTEMPORAL_THREAD_STORE(uint64_t, detail::uint32x2_t);  \
+    HIPCUB_NONTEMPORAL_THREAD_STORE(double, detail::uint32x2_t);    \
+    HIPCUB_NONTEMPORAL_THREAD_STORE(int2, detail::uint32x2_t);      \
+    HIPCUB_NONTEMPORAL_THREAD_STORE(uint2, detail::uint32x2_t);     \
+    HIPCUB_NONTEMPORAL_THREAD_STORE(float2, detail::uint32x2_t);    \
+    HIPCUB_NONTEMPORAL_THREAD_STORE(int3, detail::uint32x3_t);      \
+    HIPCUB_NONTEMPORAL_THREAD_STORE(uint3, detail::uint32x3_t);     \
+    HIPCUB_NONTEMPORAL_THREAD_STORE(float3, detail::uint32x3_t);    \
+    HIPCUB_NONTEMPORAL_THREAD_STORE(int4, detail::uint32x4_t);      \
+    HIPCUB_NONTEMPORAL_THREAD_STORE(uint4, detail::uint32x4_t);     \
+    HIPCUB_NONTEMPORAL_THREAD_STORE(float4, detail::uint32x4_t);    \
+    HIPCUB_NONTEMPORAL_THREAD_STORE(double2, detail::uint32x4_t);   \
+    HIPCUB_NONTEMPORAL_THREAD_STORE(longlong2, detail::uint32x4_t); \
+    HIPCUB_NONTEMPORAL_THREAD_STORE(ulonglong2, detail::uint32x4_t);
 
+// gfx94x replaced glc/slc with sc0/sc1, the rest of the modifier mapping is shared
 #if defined(__gfx940__) || defined(__gfx941__) || defined(__gfx942__)
-HIPCUB_ASM_THREAD_STORE_GROUP(STORE_WB, "sc0 sc1", ""); // TODO: gfx942 validation
-HIPCUB_ASM_THREAD_STORE_GROUP(STORE_CG, "sc0 sc1", "");
-HIPCUB_ASM_THREAD_STORE_GROUP(STORE_WT, "sc0 sc1", "vmcnt");
-HIPCUB_ASM_THREAD_STORE_GROUP(STORE_VOLATILE, "sc0 sc1", "vmcnt");
+    #define HIPCUB_ASM_THREAD_STORE_WB_MODIFIER "sc0 sc1" // TODO: gfx942 validation
+    #define HIPCUB_ASM_THREAD_STORE_CG_MODIFIER "sc0 sc1"
+    #define HIPCUB_ASM_THREAD_STORE_WT_MODIFIER "sc0 sc1"
 #else
-HIPCUB_ASM_THREAD_STORE_GROUP(STORE_WB, "glc", "");
-HIPCUB_ASM_THREAD_STORE_GROUP(STORE_CG, "glc slc", "");
-HIPCUB_ASM_THREAD_STORE_GROUP(STORE_WT, "glc", "vmcnt");
-HIPCUB_ASM_THREAD_STORE_GROUP(STORE_VOLATILE, "glc", "vmcnt");
+    #define HIPCUB_ASM_THREAD_STORE_WB_MODIFIER "glc"
+    #define HIPCUB_ASM_THREAD_STORE_CG_MODIFIER "glc slc"
+    #define HIPCUB_ASM_THREAD_STORE_WT_MODIFIER "glc"
 #endif
 
-// TODO find correct modifiers to match these
-HIPCUB_ASM_THREAD_STORE_GROUP(STORE_CS, "", "");
+HIPCUB_ASM_THREAD_STORE_GROUP(STORE_WB, HIPCUB_ASM_THREAD_STORE_WB_MODIFIER, "");
+HIPCUB_ASM_THREAD_STORE_GROUP(STORE_CG, HIPCUB_ASM_THREAD_STORE_CG_MODIFIER, "");
+HIPCUB_ASM_THREAD_STORE_GROUP(STORE_WT, HIPCUB_ASM_THREAD_STORE_WT_MODIFIER, "vmcnt");
+HIPCUB_ASM_THREAD_STORE_GROUP(STORE_VOLATILE, HIPCUB_ASM_THREAD_STORE_WT_MODIFIER, "vmcnt");
+HIPCUB_NONTEMPORAL_THREAD_STORE_GROUP();
 
 #endif
 
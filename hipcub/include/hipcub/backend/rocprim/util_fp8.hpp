@@ -0,0 +1,220 @@
+// MIT License
+//
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef HIPCUB_ROCPRIM_UTIL_FP8_HPP_
+#define HIPCUB_ROCPRIM_UTIL_FP8_HPP_
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "../../config.hpp"
+
+#include "util_type.hpp"
+
+/// \file util_fp8.hpp
+/// 8-bit floating-point types. This header is not included by any other hipCUB header.
+/// Radix sorting these keys also needs <tt>hipcub/util_radix_key_traits.hpp</tt>.
+
+BEGIN_HIPCUB_NAMESPACE
+
+namespace detail
+{
+
+/// Rounds a float to an 8-bit float with \p ExponentBits exponent bits, round to nearest even.
+/// E5M2 follows IEEE-754: overflow becomes infinity. E4M3 has no infinity, its only NaN
+/// encodings are S.1111.111, so overflow (including infinity) saturates to +-448.
+template<int ExponentBits, int MantissaBits>
+HIPCUB_HOST_DEVICE inline unsigned char float_to_fp8(float value)
+{
+    constexpr int           bias       = (1 << (ExponentBits - 1)) - 1;
+    constexpr bool          has_inf    = ExponentBits == 5;
+    constexpr unsigned char nan_bits   = has_inf ? 0x7E : 0x7F;
+    constexpr unsigned int  max_finite = has_inf ? 0x7B : 0x7E;
+
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    const unsigned char sign = static_cast<unsigned char>((bits >> 24) & 0x80);
+    bits &= 0x7FFFFFFF;
+
+    if(bits > 0x7F800000)
+    {
+        return sign | nan_bits;
+    }
+    if(bits == 0x7F800000)
+    {
+        return sign | static_cast<unsigned char>(has_inf ? max_finite + 1 : max_finite);
+    }
+    if(bits < 0x00800000)
+    {
+        // Float subnormals are far below the smallest 8-bit subnormal.
+        return sign;
+    }
+
+    int      exponent    = static_cast<int>(bits >> 23) - 127 + bias;
+    uint32_t significand = (bits & 0x7FFFFF) | 0x800000;
+    int      shift       = 23 - MantissaBits;
+    if(exponent <= 0)
+    {
+        // Subnormal result, the implicit bit becomes part of the mantissa.
+        shift += 1 - exponent;
+        exponent = 0;
+    }
+    if(shift > 24)
+    {
+        return sign;
+    }
+
+    uint32_t       rounded   = significand >> shift;
+    const uint32_t remainder = significand & ((uint32_t(1) << shift) - 1);
+    const uint32_t halfway   = uint32_t(1) << (shift - 1);
+    if(remainder > halfway || (remainder == halfway && (rounded & 1)))
+    {
+        rounded++;
+    }
+    // A carry out of the mantissa increments the exponent field.
+    const uint32_t result
+        = exponent > 0 ? (uint32_t(exponent - 1) << MantissaBits) + rounded : rounded;
+    if(result > max_finite)
+    {
+        return sign | static_cast<unsigned char>(has_inf ? max_finite + 1 : max_finite);
+    }
+    return sign | static_cast<unsigned char>(result);
+}
+
+/// Converts an 8-bit float to float, which is exact.
+template<int ExponentBits, int MantissaBits>
+HIPCUB_HOST_DEVICE inline float fp8_to_float(unsigned char value)
+{
+    constexpr int          bias          = (1 << (ExponentBits - 1)) - 1;
+    constexpr bool         has_inf       = ExponentBits == 5;
+    constexpr unsigned int exponent_mask = (1u << ExponentBits) - 1;
+
+    const uint32_t     sign     = uint32_t(value & 0x80) << 24;
+    const unsigned int exponent = (value & 0x7F) >> MantissaBits;
+    const unsigned int mantissa = value & ((1u << MantissaBits) - 1);
+
+    uint32_t bits;
+    if(has_inf && exponent == exponent_mask)
+    {
+        bits = mantissa == 0 ? 0x7F800000 : 0x7FC00000;
+    }
+    else if(!has_inf && (value & 0x7F) == 0x7F)
+    {
+        bits = 0x7FC00000;
+    }
+    else if(exponent == 0)
+    {
+        // mantissa * 2^(1 - bias - MantissaBits), exact in float.
+        const float magnitude
+            = static_cast<float>(mantissa) / static_cast<float>(1u << (bias - 1 + MantissaBits));
+        memcpy(&bits, &magnitude, sizeof(bits));
+    }
+    else
+    {
+        bits = (uint32_t(exponent - bias + 127) << 23) | (mantissa << (23 - MantissaBits));
+    }
+    bits |= sign;
+
+    float result;
+    memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+/// Storage type of the OCP 8-bit floating-point formats. Arithmetic is performed in float
+/// through the implicit conversions, like for \p hip_bfloat16.
+template<int ExponentBits, int MantissaBits>
+struct fp8
+{
+    unsigned char data;
+
+    fp8() = default;
+
+    HIPCUB_HOST_DEVICE fp8(float value)
+        : data(float_to_fp8<ExponentBits, MantissaBits>(value))
+    {}
+
+    HIPCUB_HOST_DEVICE operator float() const
+    {
+        return fp8_to_float<ExponentBits, MantissaBits>(data);
+    }
+
+    /// Constructs a value from its bit pattern.
+    HIPCUB_HOST_DEVICE static fp8 from_bits(unsigned char bits)
+    {
+        fp8 result;
+        result.data = bits;
+        return result;
+    }
+};
+
+} // end namespace detail
+
+/// 8-bit float with 4 exponent and 3 mantissa bits (OCP E4M3): no infinity, max 448.
+using fp8_e4m3 = detail::fp8<4, 3>;
+
+/// 8-bit float with 5 exponent and 2 mantissa bits (OCP E5M2): IEEE-754 like, max 57344.
+using fp8_e5m2 = detail::fp8<5, 2>;
+
+namespace detail
+{
+
+template<int ExponentBits, int MantissaBits>
+struct is_fp8<fp8<ExponentBits, MantissaBits>> : std::true_type
+{};
+
+} // end namespace detail
+
+template <>
+struct FpLimits<fp8_e4m3>
+{
+    static HIPCUB_HOST_DEVICE __forceinline__ fp8_e4m3 Max() {
+        return fp8_e4m3::from_bits(0x7E);
+    }
+
+    static HIPCUB_HOST_DEVICE __forceinline__ fp8_e4m3 Lowest() {
+        return fp8_e4m3::from_bits(0xFE);
+    }
+};
+
+template <>
+struct FpLimits<fp8_e5m2>
+{
+    static HIPCUB_HOST_DEVICE __forceinline__ fp8_e5m2 Max() {
+        return fp8_e5m2::from_bits(0x7B);
+    }
+
+    static HIPCUB_HOST_DEVICE __forceinline__ fp8_e5m2 Lowest() {
+        return fp8_e5m2::from_bits(0xFB);
+    }
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS    // Do not document
+
+template <> struct NumericTraits<fp8_e4m3> : BaseTraits<FLOATING_POINT, true, false, unsigned char, fp8_e4m3> {};
+template <> struct NumericTraits<fp8_e5m2> : BaseTraits<FLOATING_POINT, true, false, unsigned char, fp8_e5m2> {};
+
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_ROCPRIM_UTIL_FP8_HPP_
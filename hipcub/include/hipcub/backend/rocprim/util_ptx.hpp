@@ -227,18 +227,42 @@ auto unsigned_bit_extract(UnsignedBits source,
     #endif // __HIP_PLATFORM_AMD__
 }
 
+#ifdef HIPCUB_IS_INT128_ENABLED
+template <typename UnsignedBits>
+HIPCUB_DEVICE inline
+auto unsigned_bit_extract(UnsignedBits source,
+                          unsigned int bit_start,
+                          unsigned int num_bits)
+    -> typename std::enable_if<sizeof(UnsignedBits) == 16, unsigned int>::type
+{
+    // No 128-bit extract instruction exists, shift and mask instead.
+    const __uint128_t mask = (__uint128_t(1) << num_bits) - 1;
+    return static_cast<unsigned int>((source >> bit_start) & mask);
+}
+
+template <typename UnsignedBits>
+struct is_unsigned_bits
+    : std::integral_constant<bool, std::is_unsigned<UnsignedBits>::value
+                                       || std::is_same<UnsignedBits, __uint128_t>::value>
+{};
+#else
+template <typename UnsignedBits>
+struct is_unsigned_bits : std::is_unsigned<UnsignedBits>
+{};
+#endif
+
 } // end namespace detail
 
 // Bitfield-extract.
 // Extracts \p num_bits from \p source starting at bit-offset \p bit_start.
-// The input \p source may be an 8b, 16b, 32b, or 64b unsigned integer type.
+// The input \p source may be an 8b, 16b, 32b, 64b or 128b unsigned integer type.
 template <typename UnsignedBits>
 HIPCUB_DEVICE inline
 unsigned int BFE(UnsignedBits source,
                  unsigned int bit_start,
                  unsigned int num_bits)
 {
-    static_assert(std::is_unsigned<UnsignedBits>::value, "UnsignedBits must be unsigned");
+    static_assert(detail::is_unsigned_bits<UnsignedBits>::value, "UnsignedBits must be unsigned");
     return detail::unsigned_bit_extract(source, bit_start, num_bits);
 }
 
@@ -0,0 +1,407 @@
+// MIT License
+//
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef HIPCUB_ROCPRIM_UTIL_RADIX_KEY_TRAITS_HPP_
+#define HIPCUB_ROCPRIM_UTIL_RADIX_KEY_TRAITS_HPP_
+
+/// \file util_radix_key_traits.hpp
+/// Radix sorting of custom key types and of the 8-bit float types of util_fp8.hpp. This
+/// header is not included by any other hipCUB header, code that sorts such keys includes it
+/// before the radix sort headers are instantiated with them.
+///
+/// The keys are encoded by specializing \p rocprim::detail::radix_key_codec_base, which is
+/// an internal of rocPRIM and not part of its API. The specialization is only defined for
+/// the rocPRIM versions it was written against, 2.10 up to 3.x; with any other version
+/// including this header is an error.
+
+#include <cstring>
+#include <type_traits>
+
+#include "../../config.hpp"
+
+#include "util_fp8.hpp"
+#include "util_type.hpp"
+
+#include <rocprim/rocprim_version.hpp>
+
+#if !defined(ROCPRIM_VERSION) || ROCPRIM_VERSION < 201000 || ROCPRIM_VERSION >= 400000
+    #error "hipcub/util_radix_key_traits.hpp supports rocPRIM 2.10 up to 3.x"
+#endif
+
+#include <rocprim/detail/radix_sort.hpp>
+
+BEGIN_HIPCUB_NAMESPACE
+
+/**
+ * \brief Radix sort key traits, the specialization point for sorting keys of custom types.
+ *
+ * A specialization describes the key as an ordered bit string:
+ *   - \p UnsignedBits is an unsigned integer type of the same size as the key,
+ *   - <tt>static UnsignedBits TwiddleIn(const KeyT&)</tt> maps a key to bits whose unsigned
+ *     order is the key order, and <tt>static KeyT TwiddleOut(UnsignedBits)</tt> inverts it.
+ *
+ * \p RadixKeyFields derives both from a list of key members. The key type must be trivially
+ * copyable. \p DeviceRadixSort, \p DeviceSegmentedRadixSort and \p BlockRadixSort sort such
+ * keys, and their \p begin_bit and \p end_bit refer to the encoded bits.
+ *
+ * \par Snippet
+ * \code
+ * struct particle { float energy; int id; };
+ *
+ * // Highest energy first, then lowest id
+ * template<>
+ * struct hipcub::RadixSortKeyTraits<particle>
+ *     : hipcub::RadixKeyFields<particle,
+ *                              hipcub::RadixKeyField<particle, float, &particle::energy, true>,
+ *                              hipcub::RadixKeyField<particle, int, &particle::id>>
+ * {};
+ * \endcode
+ *
+ * This is an extension of the rocPRIM backend and is not available with CUB. The
+ * specialization must be visible where the sort is instantiated, so it is declared after
+ * including <tt>hipcub/util_radix_key_traits.hpp</tt>.
+ */
+template <typename KeyT>
+struct RadixSortKeyTraits
+{};
+
+/**
+ * \brief A member of a radix sort key, ordered by its \p NumericTraits twiddling, or in
+ * reverse if \p DESCENDING. Floating-point members order <tt>-0.0</tt> just before
+ * <tt>+0.0</tt>, so that sorting keeps their bits.
+ */
+template <typename KeyT, typename FieldT, FieldT KeyT::*MEMBER, bool DESCENDING = false>
+struct RadixKeyField
+{
+    typedef NumericTraits<FieldT>           TraitsT;
+    typedef typename TraitsT::UnsignedBits  UnsignedBits;
+
+    static_assert(TraitsT::CATEGORY != NOT_A_NUMBER,
+                  "RadixKeyField members must have arithmetic NumericTraits");
+
+    enum
+    {
+        BITS = sizeof(UnsignedBits) * 8,
+    };
+
+    static HIPCUB_HOST_DEVICE __forceinline__ UnsignedBits In(const KeyT& key)
+    {
+        UnsignedBits bits;
+        memcpy(&bits, &(key.*MEMBER), sizeof(bits));
+        bits = TraitsT::TwiddleIn(bits);
+        return DESCENDING ? UnsignedBits(~bits) : bits;
+    }
+
+    static HIPCUB_HOST_DEVICE __forceinline__ void Out(KeyT& key, UnsignedBits bits)
+    {
+        bits = TraitsT::TwiddleOut(DESCENDING ? UnsignedBits(~bits) : bits);
+        memcpy(&(key.*MEMBER), &bits, sizeof(bits));
+    }
+};
+
+namespace detail
+{
+
+template <int BYTES> struct radix_key_unsigned_bits;
+template <> struct radix_key_unsigned_bits<1> { typedef unsigned char Type; };
+template <> struct radix_key_unsigned_bits<2> { typedef unsigned short Type; };
+template <> struct radix_key_unsigned_bits<4> { typedef unsigned int Type; };
+template <> struct radix_key_unsigned_bits<8> { typedef unsigned long long Type; };
+#ifdef HIPCUB_IS_INT128_ENABLED
+template <> struct radix_key_unsigned_bits<16> { typedef __uint128_t Type; };
+#endif
+
+template <typename UnsignedBits, typename... Fields>
+struct radix_key_fields_impl
+{
+    enum
+    {
+        BITS = 0,
+    };
+
+    template <typename KeyT>
+    static HIPCUB_HOST_DEVICE __forceinline__ UnsignedBits In(const KeyT&)
+    {
+        return 0;
+    }
+
+    template <typename KeyT>
+    static HIPCUB_HOST_DEVICE __forceinline__ void Out(KeyT&, UnsignedBits)
+    {
+    }
+};
+
+template <typename UnsignedBits, typename Field, typename... Fields>
+struct radix_key_fields_impl<UnsignedBits, Field, Fields...>
+{
+    typedef radix_key_fields_impl<UnsignedBits, Fields...> Rest;
+
+    enum
+    {
+        BITS = Field::BITS + Rest::BITS,
+    };
+
+    // The first field is the most significant one
+    template <typename KeyT>
+    static HIPCUB_HOST_DEVICE __forceinline__ UnsignedBits In(const KeyT& key)
+    {
+        return (UnsignedBits(Field::In(key)) << Rest::BITS) | Rest::In(key);
+    }
+
+    template <typename KeyT>
+    static HIPCUB_HOST_DEVICE __forceinline__ void Out(KeyT& key, UnsignedBits bits)
+    {
+        Field::Out(key, static_cast<typename Field::UnsignedBits>(bits >> Rest::BITS));
+        Rest::Out(key, bits);
+    }
+};
+
+template <typename KeyT, typename = void>
+struct has_radix_sort_key_traits : std::false_type
+{};
+
+template <typename KeyT>
+struct has_radix_sort_key_traits<
+    KeyT,
+    typename std::conditional<true, void, typename RadixSortKeyTraits<KeyT>::UnsignedBits>::type>
+    : std::integral_constant<bool, !std::is_arithmetic<KeyT>::value>
+{};
+
+} // end namespace detail
+
+/**
+ * \brief Implements \p RadixSortKeyTraits for \p KeyT from a list of \p RadixKeyField,
+ * most significant first.
+ *
+ * The fields must cover every byte of \p KeyT: \p TwiddleOut value-initializes the key and
+ * only restores the listed members. Keys with padding or with members that are not part of
+ * the order need a hand-written \p RadixSortKeyTraits specialization.
+ */
+template <typename KeyT, typename... Fields>
+struct RadixKeyFields
+{
+    typedef typename detail::radix_key_unsigned_bits<sizeof(KeyT)>::Type UnsignedBits;
+    typedef detail::radix_key_fields_impl<UnsignedBits, Fields...>       ImplT;
+
+    enum
+    {
+        BITS = ImplT::BITS,
+    };
+
+    static_assert(BITS == sizeof(KeyT) * 8,
+                  "The fields of a radix sort key must cover the whole key, unlisted members "
+                  "and padding would be zeroed by TwiddleOut");
+
+    static HIPCUB_HOST_DEVICE __forceinline__ UnsignedBits TwiddleIn(const KeyT& key)
+    {
+        return ImplT::In(key);
+    }
+
+    static HIPCUB_HOST_DEVICE __forceinline__ KeyT TwiddleOut(UnsignedBits bits)
+    {
+        KeyT key{};
+        ImplT::Out(key, bits);
+        return key;
+    }
+};
+
+/// \brief Placement of NaN keys by \p RadixSortFloatKey, in ascending order. Descending sorts
+/// reverse it.
+enum RadixSortNaNPolicy
+{
+    /// All NaNs before <tt>-inf</tt>, positive NaNs first
+    RADIX_SORT_NAN_FIRST,
+    /// All NaNs after <tt>+inf</tt>, negative NaNs last
+    RADIX_SORT_NAN_LAST,
+    /// IEEE 754 totalOrder: negative NaNs before <tt>-inf</tt>, positive NaNs after <tt>+inf</tt>
+    RADIX_SORT_NAN_TOTAL_ORDER
+};
+
+/// \brief Ordering of <tt>-0.0</tt> and <tt>+0.0</tt> keys by \p RadixSortFloatKey.
+enum RadixSortSignedZeroPolicy
+{
+    /// <tt>-0.0</tt> is sorted and written as <tt>+0.0</tt>, so zeros keep their input order
+    RADIX_SORT_SIGNED_ZERO_CANONICALIZE,
+    /// IEEE 754 totalOrder: <tt>-0.0</tt> before <tt>+0.0</tt>
+    RADIX_SORT_SIGNED_ZERO_TOTAL_ORDER
+};
+
+namespace detail
+{
+
+/// Number of NaN bit patterns of each sign.
+template <typename T> struct radix_float_nan_codes;
+template <> struct radix_float_nan_codes<float>        { static constexpr unsigned int value = 0x7FFFFF; };
+template <> struct radix_float_nan_codes<double>       { static constexpr unsigned long long value = 0xFFFFFFFFFFFFFull; };
+template <> struct radix_float_nan_codes<__half>       { static constexpr unsigned short value = 0x3FF; };
+template <> struct radix_float_nan_codes<hip_bfloat16> { static constexpr unsigned short value = 0x7F; };
+template <> struct radix_float_nan_codes<fp8_e5m2>     { static constexpr unsigned char value = 0x3; };
+// E4M3 has no infinity and a single NaN encoding per sign
+template <> struct radix_float_nan_codes<fp8_e4m3>     { static constexpr unsigned char value = 0x1; };
+
+} // end namespace detail
+
+/**
+ * \brief A floating-point radix sort key with a compile-time NaN and signed-zero policy.
+ *
+ * It has the layout of \p T, so arrays of \p T can be sorted through a pointer to this type.
+ * The policies are applied while twiddling the keys, at no extra cost: the NaN policy rotates
+ * the twiddled bits, which is invertible, so all keys keep their bits, except for
+ * <tt>-0.0</tt> with \p RADIX_SORT_SIGNED_ZERO_CANONICALIZE.
+ *
+ * \par Snippet
+ * \code
+ * using key_type = hipcub::RadixSortFloatKey<float, hipcub::RADIX_SORT_NAN_LAST>;
+ * hipcub::DeviceRadixSort::SortKeys(d_temp_storage, temp_storage_bytes,
+ *                                   reinterpret_cast<const key_type*>(d_keys_in),
+ *                                   reinterpret_cast<key_type*>(d_keys_out), num_items);
+ * \endcode
+ *
+ * This is an extension of the rocPRIM backend and is not available with CUB.
+ */
+template <typename T,
+          RadixSortNaNPolicy        NAN_POLICY  = RADIX_SORT_NAN_TOTAL_ORDER,
+          RadixSortSignedZeroPolicy ZERO_POLICY = RADIX_SORT_SIGNED_ZERO_TOTAL_ORDER>
+struct RadixSortFloatKey
+{
+    static_assert(NumericTraits<T>::CATEGORY == FLOATING_POINT,
+                  "RadixSortFloatKey only supports floating-point types");
+
+    T value;
+
+    RadixSortFloatKey() = default;
+
+    HIPCUB_HOST_DEVICE inline
+    RadixSortFloatKey(T value) : value(value)
+    {
+    }
+
+    HIPCUB_HOST_DEVICE inline
+    operator T() const
+    {
+        return value;
+    }
+};
+
+template <typename T, RadixSortNaNPolicy NAN_POLICY, RadixSortSignedZeroPolicy ZERO_POLICY>
+struct RadixSortKeyTraits<RadixSortFloatKey<T, NAN_POLICY, ZERO_POLICY>>
+{
+    typedef RadixSortFloatKey<T, NAN_POLICY, ZERO_POLICY> KeyT;
+    typedef NumericTraits<T>                               TraitsT;
+    typedef typename TraitsT::UnsignedBits                 UnsignedBits;
+
+    enum
+    {
+        BITS = sizeof(UnsignedBits) * 8,
+    };
+
+    static constexpr UnsignedBits NAN_CODES = detail::radix_float_nan_codes<T>::value;
+
+    static HIPCUB_HOST_DEVICE __forceinline__ UnsignedBits TwiddleIn(const KeyT& key)
+    {
+        UnsignedBits bits;
+        memcpy(&bits, &key.value, sizeof(bits));
+        bits = TraitsT::TwiddleIn(bits);
+        if(ZERO_POLICY == RADIX_SORT_SIGNED_ZERO_CANONICALIZE
+           && bits == TraitsT::TwiddleIn(TraitsT::HIGH_BIT))
+        {
+            bits = TraitsT::TwiddleIn(0);
+        }
+        // Twiddled keys are ordered negative NaNs, -inf ... +inf, positive NaNs. Rotating them
+        // moves one of the NaN ranges to the other end.
+        if(NAN_POLICY == RADIX_SORT_NAN_LAST)
+        {
+            bits = UnsignedBits(bits - NAN_CODES);
+        }
+        else if(NAN_POLICY == RADIX_SORT_NAN_FIRST)
+        {
+            bits = UnsignedBits(bits + NAN_CODES);
+        }
+        return bits;
+    }
+
+    static HIPCUB_HOST_DEVICE __forceinline__ KeyT TwiddleOut(UnsignedBits bits)
+    {
+        if(NAN_POLICY == RADIX_SORT_NAN_LAST)
+        {
+            bits = UnsignedBits(bits + NAN_CODES);
+        }
+        else if(NAN_POLICY == RADIX_SORT_NAN_FIRST)
+        {
+            bits = UnsignedBits(bits - NAN_CODES);
+        }
+        bits = TraitsT::TwiddleOut(bits);
+        KeyT key;
+        memcpy(&key.value, &bits, sizeof(bits));
+        return key;
+    }
+};
+
+END_HIPCUB_NAMESPACE
+
+namespace rocprim
+{
+namespace detail
+{
+
+// Keys with a hipcub::RadixSortKeyTraits specialization are encoded with its bit string.
+// This relies on radix_key_codec<Key> taking its encoding from radix_key_codec_base<Key>.
+template<class Key>
+struct radix_key_codec_base<
+    Key,
+    typename std::enable_if<::hipcub::detail::has_radix_sort_key_traits<Key>::value>::type>
+{
+    using traits_type  = ::hipcub::RadixSortKeyTraits<Key>;
+    using bit_key_type = typename traits_type::UnsignedBits;
+
+    static_assert(sizeof(bit_key_type) == sizeof(Key),
+                  "RadixSortKeyTraits::UnsignedBits must have the size of the key");
+
+    HIPCUB_HOST_DEVICE inline
+    static bit_key_type encode(bit_key_type bit_key)
+    {
+        Key key;
+        memcpy(&key, &bit_key, sizeof(key));
+        return traits_type::TwiddleIn(key);
+    }
+
+    HIPCUB_HOST_DEVICE inline
+    static bit_key_type decode(bit_key_type bit_key)
+    {
+        const Key key = traits_type::TwiddleOut(bit_key);
+        memcpy(&bit_key, &key, sizeof(key));
+        return bit_key;
+    }
+};
+
+// 8-bit floats are encoded for radix sorting like the other floating-point types, -0.0 is
+// sorted as +0.0 and NaNs are sorted by their sign bit. radix_key_codec_floating is a rocPRIM
+// internal as well.
+template<int ExponentBits, int MantissaBits>
+struct radix_key_codec_base<::hipcub::detail::fp8<ExponentBits, MantissaBits>>
+    : radix_key_codec_floating<::hipcub::detail::fp8<ExponentBits, MantissaBits>, unsigned char>
+{};
+
+} // end namespace detail
+} // end namespace rocprim
+
+#endif // HIPCUB_ROCPRIM_UTIL_RADIX_KEY_TRAITS_HPP_
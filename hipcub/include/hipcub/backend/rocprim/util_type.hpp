@@ -158,9 +158,45 @@ using KeyValuePair = ::rocprim::key_value_pair<Key, Value>;
 template <typename T, typename Iter = T*>
 using FutureValue = ::rocprim::future_value<T, Iter>;
 
+/// \brief A running sum together with the rounding error it has accumulated, reduced with
+/// \p KahanSum. Converts to \p T as <tt>sum + compensation</tt>.
+template<typename T>
+struct KahanPair
+{
+    T sum;
+    T compensation;
+
+    KahanPair() = default;
+
+    HIPCUB_HOST_DEVICE inline
+    KahanPair(T value) : sum(value), compensation(0)
+    {
+    }
+
+    HIPCUB_HOST_DEVICE inline
+    KahanPair(T sum, T compensation) : sum(sum), compensation(compensation)
+    {
+    }
+
+    HIPCUB_HOST_DEVICE inline
+    operator T() const
+    {
+        return sum + compensation;
+    }
+};
+
 namespace detail
 {
 
+/// True for the 8-bit float types, which are specialized in util_fp8.hpp.
+template<class T>
+struct is_fp8 : std::false_type
+{};
+
+/// Type used to accumulate values of \p T. 8-bit floats are accumulated in float.
+template<class T>
+using accumulator_t = typename std::conditional<is_fp8<T>::value, float, T>::type;
+
 template<typename T>
 inline
 ::rocprim::double_buffer<T> to_double_buffer(DoubleBuffer<T>& source)
@@ -625,6 +661,11 @@ template <> struct NumericTraits<unsigned int> :        BaseTraits<UNSIGNED_INTE
 template <> struct NumericTraits<unsigned long> :       BaseTraits<UNSIGNED_INTEGER, true, false, unsigned long, unsigned long> {};
 template <> struct NumericTraits<unsigned long long> :  BaseTraits<UNSIGNED_INTEGER, true, false, unsigned long long, unsigned long long> {};
 
+#ifdef HIPCUB_IS_INT128_ENABLED
+template <> struct NumericTraits<__int128_t> :          BaseTraits<SIGNED_INTEGER, true, false, __uint128_t, __int128_t> {};
+template <> struct NumericTraits<__uint128_t> :         BaseTraits<UNSIGNED_INTEGER, true, false, __uint128_t, __uint128_t> {};
+#endif
+
 template <> struct NumericTraits<float> :               BaseTraits<FLOATING_POINT, true, false, unsigned int, float> {};
 template <> struct NumericTraits<double> :              BaseTraits<FLOATING_POINT, true, false, unsigned long long, double> {};
 template <> struct NumericTraits<__half> :              BaseTraits<FLOATING_POINT, true, false, unsigned short, __half> {};
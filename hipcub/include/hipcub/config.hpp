@@ -73,6 +73,19 @@
 #define HIPCUB_HOST_DEVICE __host__ __device__
 #define HIPCUB_SHARED_MEMORY __shared__
 
+/// 128-bit integers (__int128_t, __uint128_t) are supported as keys and values when the
+/// compiler provides them. Define HIPCUB_DISABLE_INT128 to opt out.
+#if defined(__SIZEOF_INT128__) && !defined(HIPCUB_DISABLE_INT128)
+    #ifdef HIPCUB_ROCPRIM_API
+        #define HIPCUB_IS_INT128_ENABLED 1
+    #else
+        #include <cub/util_type.cuh>
+        #ifdef CUB_IS_INT128_ENABLED
+            #define HIPCUB_IS_INT128_ENABLED 1
+        #endif
+    #endif
+#endif
+
 // Helper macros to disable warnings in clang
 #ifdef __clang__
 #define HIPCUB_PRAGMA_TO_STR(x) _Pragma(#x)
@@ -0,0 +1,50 @@
+// MIT License
+//
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef HIPCUB_DEVICE_DEVICE_FWD_HPP_
+#define HIPCUB_DEVICE_DEVICE_FWD_HPP_
+
+#include "../config.hpp"
+
+/// \file device_fwd.hpp
+/// Declarations of the Device* structs for headers which only name them. Include the
+/// header of an algorithm to call it.
+
+BEGIN_HIPCUB_NAMESPACE
+
+struct DeviceAdjacentDifference;
+struct DeviceHistogram;
+struct DeviceMergeSort;
+struct DevicePartition;
+struct DeviceRadixSort;
+class DeviceReduce;
+class DeviceRunLengthEncode;
+class DeviceScan;
+struct DeviceSegmentedRadixSort;
+struct DeviceSegmentedReduce;
+struct DeviceSegmentedSort;
+class DeviceSelect;
+class DeviceSpmv;
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_DEVICE_DEVICE_FWD_HPP_
@@ -0,0 +1,243 @@
+// MIT License
+//
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef HIPCUB_UTIL_LAUNCH_RECORDER_HPP_
+#define HIPCUB_UTIL_LAUNCH_RECORDER_HPP_
+
+#include "config.hpp"
+#include "util_launch_recorder_fwd.hpp"
+
+#include <cstddef>
+#include <vector>
+
+/// \file util_launch_recorder.hpp
+/// In-memory log of the kernels launched by hipCUB itself. Kernels launched inside rocPRIM
+/// or CUB are not recorded, so most \p Device* algorithms leave no record at all; only
+/// algorithms with hipCUB kernels, such as \p DeviceSegmentedReduce::ArgMin and
+/// \p DeviceSpmv, are recorded.
+///
+/// hipCUB's own kernels never print, \p debug_synchronous only synchronizes the stream
+/// after each of them. rocPRIM prints its launches to \p std::cout when it receives
+/// \p debug_synchronous, so the rocPRIM backend does not forward the flag while a
+/// \p LaunchRecorder is active and synchronizes the stream after the rocPRIM call
+/// instead. The CUB backend forwards \p debug_synchronous unchanged.
+
+BEGIN_HIPCUB_NAMESPACE
+
+/// \brief One kernel launch recorded by a \p LaunchRecorder.
+struct LaunchRecord
+{
+    /// Name of the kernel, for example "segmented_arg_minmax".
+    const char* kernel_name;
+    /// Grid size of the launch.
+    dim3 grid_size;
+    /// Block size of the launch.
+    dim3 block_size;
+    /// Dynamic shared memory of the launch in bytes.
+    size_t dynamic_shared_memory_bytes;
+    /// Stream the kernel was launched on.
+    hipStream_t stream;
+    /// Device time of the kernel in milliseconds, measured with events. Negative if
+    /// the time could not be measured.
+    float device_milliseconds;
+};
+
+/// \brief Records the kernel launches of hipCUB made by the calling thread during its
+/// lifetime. Kernels launched by rocPRIM or CUB are not recorded.
+///
+/// Recording does not synchronize, device times are resolved when \p Records is called.
+/// Recorders can be nested, only the innermost one records.
+///
+/// \par Example
+/// \code
+/// hipcub::LaunchRecorder recorder;
+/// hipcub::DeviceSegmentedReduce::ArgMin(...);
+/// for(const hipcub::LaunchRecord& record : recorder.Records())
+///     log(record.kernel_name, record.device_milliseconds);
+/// \endcode
+class LaunchRecorder
+{
+public:
+    LaunchRecorder() : previous_(detail::active_launch_recorder())
+    {
+        detail::active_launch_recorder() = this;
+    }
+
+    LaunchRecorder(const LaunchRecorder&) = delete;
+    LaunchRecorder& operator=(const LaunchRecorder&) = delete;
+
+    ~LaunchRecorder()
+    {
+        detail::active_launch_recorder() = previous_;
+        Clear();
+    }
+
+    /// \brief Returns the recorder receiving launches of the calling thread, or \p nullptr.
+    static LaunchRecorder* Active()
+    {
+        return detail::active_launch_recorder();
+    }
+
+    /// \brief Returns all recorded launches in launch order. Waits for recorded launches
+    /// whose device time is not known yet.
+    const std::vector<LaunchRecord>& Records()
+    {
+        for(size_t i = resolved_; i < records_.size(); i++)
+        {
+            float milliseconds = -1.0f;
+            if(events_[i].start != nullptr && hipEventSynchronize(events_[i].stop) == hipSuccess
+               && hipEventElapsedTime(&milliseconds, events_[i].start, events_[i].stop)
+                      != hipSuccess)
+            {
+                milliseconds = -1.0f;
+            }
+            records_[i].device_milliseconds = milliseconds;
+            destroy_events(events_[i]);
+        }
+        resolved_ = records_.size();
+        return records_;
+    }
+
+    /// \brief Removes all records.
+    void Clear()
+    {
+        for(size_t i = resolved_; i < records_.size(); i++)
+        {
+            destroy_events(events_[i]);
+        }
+        records_.clear();
+        events_.clear();
+        resolved_ = 0;
+    }
+
+    /// \brief Called by hipCUB before a kernel launch, records a start event.
+    void BeginLaunch(const char* kernel_name,
+                     dim3        grid_size,
+                     dim3        block_size,
+                     size_t      dynamic_shared_memory_bytes,
+                     hipStream_t stream)
+    {
+        LaunchRecord record;
+        record.kernel_name                 = kernel_name;
+        record.grid_size                   = grid_size;
+        record.block_size                  = block_size;
+        record.dynamic_shared_memory_bytes = dynamic_shared_memory_bytes;
+        record.stream                      = stream;
+        record.device_milliseconds         = -1.0f;
+
+        launch_events events{nullptr, nullptr};
+        if(hipEventCreate(&events.start) != hipSuccess)
+        {
+            events.start = nullptr;
+        }
+        else if(hipEventCreate(&events.stop) != hipSuccess)
+        {
+            (void)hipEventDestroy(events.start);
+            events.start = nullptr;
+        }
+        if(events.start != nullptr)
+        {
+            (void)hipEventRecord(events.start, stream);
+        }
+        records_.push_back(record);
+        events_.push_back(events);
+    }
+
+    /// \brief Called by hipCUB after a kernel launch, records the stop event.
+    void EndLaunch()
+    {
+        launch_events& events = events_.back();
+        if(events.start != nullptr)
+        {
+            (void)hipEventRecord(events.stop, records_.back().stream);
+        }
+    }
+
+private:
+    struct launch_events
+    {
+        hipEvent_t start;
+        hipEvent_t stop;
+    };
+
+    static void destroy_events(launch_events& events)
+    {
+        if(events.start != nullptr)
+        {
+            (void)hipEventDestroy(events.start);
+            (void)hipEventDestroy(events.stop);
+            events.start = nullptr;
+            events.stop  = nullptr;
+        }
+    }
+
+    LaunchRecorder*            previous_;
+    std::vector<LaunchRecord>  records_;
+    std::vector<launch_events> events_;
+    size_t                     resolved_ = 0;
+};
+
+namespace detail
+{
+
+/// Launches a kernel with \p launch, checks for launch errors, reports the launch to the
+/// active \p LaunchRecorder and synchronizes the stream if \p debug_synchronous is set.
+template<class Launch>
+inline hipError_t record_launch(const char* kernel_name,
+                                dim3        grid_size,
+                                dim3        block_size,
+                                size_t      dynamic_shared_memory_bytes,
+                                hipStream_t stream,
+                                bool        debug_synchronous,
+                                Launch      launch)
+{
+    LaunchRecorder* recorder = LaunchRecorder::Active();
+    if(recorder != nullptr)
+    {
+        recorder->BeginLaunch(kernel_name,
+                              grid_size,
+                              block_size,
+                              dynamic_shared_memory_bytes,
+                              stream);
+    }
+    launch();
+    hipError_t error = hipGetLastError();
+    if(recorder != nullptr)
+    {
+        recorder->EndLaunch();
+    }
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    if(debug_synchronous)
+    {
+        error = hipStreamSynchronize(stream);
+    }
+    return error;
+}
+
+} // namespace detail
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_UTIL_LAUNCH_RECORDER_HPP_
@@ -0,0 +1,69 @@
+// MIT License
+//
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef HIPCUB_UTIL_LAUNCH_RECORDER_FWD_HPP_
+#define HIPCUB_UTIL_LAUNCH_RECORDER_FWD_HPP_
+
+#include "config.hpp"
+
+/// \file util_launch_recorder_fwd.hpp
+/// Declares \p LaunchRecorder and the state that the \p Device* headers query, without the
+/// recorder itself and its \p std::vector. See util_launch_recorder.hpp.
+
+BEGIN_HIPCUB_NAMESPACE
+
+class LaunchRecorder;
+
+namespace detail
+{
+
+inline LaunchRecorder*& active_launch_recorder()
+{
+    static thread_local LaunchRecorder* recorder = nullptr;
+    return recorder;
+}
+
+/// Value of \p debug_synchronous to pass to rocPRIM: \p false while a \p LaunchRecorder
+/// is active, so that rocPRIM does not print to \p std::cout. The caller passes the
+/// result of the rocPRIM call to \p rocprim_debug_synchronize.
+inline bool rocprim_debug_synchronous(bool debug_synchronous)
+{
+    return debug_synchronous && active_launch_recorder() == nullptr;
+}
+
+/// Synchronizes \p stream after a successful rocPRIM call if \p debug_synchronous was
+/// requested but not passed to rocPRIM because a \p LaunchRecorder is active.
+inline hipError_t
+    rocprim_debug_synchronize(hipError_t error, hipStream_t stream, bool debug_synchronous)
+{
+    if(error == hipSuccess && debug_synchronous && active_launch_recorder() != nullptr)
+    {
+        error = hipStreamSynchronize(stream);
+    }
+    return error;
+}
+
+} // namespace detail
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_UTIL_LAUNCH_RECORDER_FWD_HPP_
@@ -0,0 +1,37 @@
+// MIT License
+//
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef HIPCUB_UTIL_RADIX_KEY_TRAITS_HPP_
+#define HIPCUB_UTIL_RADIX_KEY_TRAITS_HPP_
+
+/// \file util_radix_key_traits.hpp
+/// Opt-in header for radix sorting custom key types: \p RadixSortKeyTraits,
+/// \p RadixKeyFields and \p RadixSortFloatKey, and for radix sorting \p fp8_e4m3 and
+/// \p fp8_e5m2 keys. Only available with the rocPRIM backend.
+
+#ifdef __HIP_PLATFORM_AMD__
+    #include "backend/rocprim/util_radix_key_traits.hpp"
+#elif defined(__HIP_PLATFORM_NVIDIA__)
+    #error "hipcub/util_radix_key_traits.hpp is only available with the rocPRIM backend"
+#endif
+
+#endif // HIPCUB_UTIL_RADIX_KEY_TRAITS_HPP_
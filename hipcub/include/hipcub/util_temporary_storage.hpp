@@ -0,0 +1,237 @@
+// MIT License
+//
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef HIPCUB_UTIL_TEMPORARY_STORAGE_HPP_
+#define HIPCUB_UTIL_TEMPORARY_STORAGE_HPP_
+
+#include "config.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+/// \file util_temporary_storage.hpp
+/// Planning of a single temporary storage allocation for a pipeline of Device* calls.
+
+BEGIN_HIPCUB_NAMESPACE
+
+/// \brief Collects the temporary storage requirements of several Device* calls and lays
+/// them out in one allocation.
+///
+/// Every buffer is live during an inclusive range of stages. Buffers whose stages do not
+/// overlap may share memory. By default each added buffer gets its own stage, so the
+/// temporary storage of a sequence of calls on one stream is fully aliased. Buffers that
+/// must stay live across calls, such as intermediate results, can be given explicit
+/// stages.
+///
+/// \par Example
+/// \code
+/// hipcub::TempStoragePlanner planner;
+/// size_t reduce_id, scan_id;
+/// planner.Add(reduce_id, [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+///     return hipcub::DeviceReduce::Sum(d_temp_storage, temp_storage_bytes, d_in, d_sum, n);
+/// });
+/// planner.Add(scan_id, [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+///     return hipcub::DeviceScan::InclusiveSum(d_temp_storage, temp_storage_bytes, d_in, d_out, n);
+/// });
+///
+/// void* d_temp_storage;
+/// hipMalloc(&d_temp_storage, planner.TotalBytes());
+///
+/// size_t temp_storage_bytes = planner.Bytes(reduce_id);
+/// hipcub::DeviceReduce::Sum(planner.Get(d_temp_storage, reduce_id), temp_storage_bytes, ...);
+/// temp_storage_bytes = planner.Bytes(scan_id);
+/// hipcub::DeviceScan::InclusiveSum(planner.Get(d_temp_storage, scan_id), temp_storage_bytes, ...);
+/// \endcode
+class TempStoragePlanner
+{
+public:
+    /// Alignment of the returned sub-pointers, matching the alignment of \p hipMalloc.
+    static constexpr size_t default_alignment = 256;
+
+    /// \brief Adds a buffer of \p bytes live from \p first_stage to \p last_stage
+    /// inclusive and returns its id in \p id.
+    hipError_t AddBytes(size_t& id,
+                        size_t  bytes,
+                        size_t  first_stage,
+                        size_t  last_stage,
+                        size_t  alignment = default_alignment)
+    {
+        if(last_stage < first_stage || alignment == 0 || (alignment & (alignment - 1)) != 0)
+        {
+            return hipErrorInvalidValue;
+        }
+        buffer b;
+        b.bytes       = bytes;
+        b.alignment   = alignment;
+        b.first_stage = first_stage;
+        b.last_stage  = last_stage;
+        b.offset      = 0;
+        id            = buffers_.size();
+        buffers_.push_back(b);
+        next_stage_ = std::max(next_stage_, last_stage + 1);
+        planned_    = false;
+        return hipSuccess;
+    }
+
+    /// \brief Adds the temporary storage of a Device* call live from \p first_stage to
+    /// \p last_stage inclusive. \p query is called once as
+    /// <tt>query(nullptr, temp_storage_bytes)</tt> to obtain the size.
+    template<class Query>
+    hipError_t Add(size_t& id, Query query, size_t first_stage, size_t last_stage)
+    {
+        size_t     bytes = 0;
+        hipError_t error = query(static_cast<void*>(nullptr), bytes);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        return AddBytes(id, bytes, first_stage, last_stage);
+    }
+
+    /// \brief Adds the temporary storage of a Device* call in a new stage after all stages
+    /// added so far.
+    template<class Query>
+    hipError_t Add(size_t& id, Query query)
+    {
+        return Add(id, query, next_stage_, next_stage_);
+    }
+
+    /// \brief Returns the size in bytes of the single allocation holding all buffers.
+    size_t TotalBytes()
+    {
+        plan();
+        // Make sure user won't try to allocate 0 bytes memory, because
+        // hipMalloc will return nullptr when size is zero.
+        return std::max(total_bytes_, size_t(4));
+    }
+
+    /// \brief Returns the size in bytes requested for buffer \p id.
+    size_t Bytes(size_t id) const
+    {
+        return buffers_[id].bytes;
+    }
+
+    /// \brief Returns the offset of buffer \p id from the start of the allocation.
+    size_t Offset(size_t id)
+    {
+        plan();
+        return buffers_[id].offset;
+    }
+
+    /// \brief Returns the pointer to buffer \p id inside \p d_temp_storage, which must
+    /// be an allocation of at least \p TotalBytes() bytes aligned to the largest requested
+    /// alignment.
+    void* Get(void* d_temp_storage, size_t id)
+    {
+        return static_cast<char*>(d_temp_storage) + Offset(id);
+    }
+
+    /// \brief Removes all buffers.
+    void Clear()
+    {
+        buffers_.clear();
+        next_stage_  = 0;
+        total_bytes_ = 0;
+        planned_     = true;
+    }
+
+private:
+    struct buffer
+    {
+        size_t bytes;
+        size_t alignment;
+        size_t first_stage;
+        size_t last_stage;
+        size_t offset;
+    };
+
+    static size_t align_up(size_t value, size_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    // Places the largest buffers first, each at the lowest aligned offset that does not
+    // overlap a placed buffer with an overlapping lifetime.
+    void plan()
+    {
+        if(planned_)
+        {
+            return;
+        }
+        std::vector<size_t> order(buffers_.size());
+        for(size_t i = 0; i < order.size(); i++)
+        {
+            order[i] = i;
+        }
+        std::stable_sort(order.begin(),
+                         order.end(),
+                         [this](size_t a, size_t b)
+                         { return buffers_[a].bytes > buffers_[b].bytes; });
+
+        total_bytes_ = 0;
+        std::vector<size_t> placed;
+        placed.reserve(order.size());
+        for(size_t i : order)
+        {
+            buffer& b = buffers_[i];
+            // Buffers that are live at the same time as b, sorted by offset
+            std::vector<size_t> conflicts;
+            for(size_t j : placed)
+            {
+                const buffer& p = buffers_[j];
+                if(p.bytes > 0 && p.first_stage <= b.last_stage && b.first_stage <= p.last_stage)
+                {
+                    conflicts.push_back(j);
+                }
+            }
+            std::sort(conflicts.begin(),
+                      conflicts.end(),
+                      [this](size_t x, size_t y)
+                      { return buffers_[x].offset < buffers_[y].offset; });
+
+            size_t offset = 0;
+            for(size_t j : conflicts)
+            {
+                const buffer& p = buffers_[j];
+                if(align_up(offset, b.alignment) + b.bytes <= p.offset)
+                {
+                    break;
+                }
+                offset = std::max(offset, p.offset + p.bytes);
+            }
+            b.offset     = align_up(offset, b.alignment);
+            total_bytes_ = std::max(total_bytes_, b.offset + b.bytes);
+            placed.push_back(i);
+        }
+        planned_ = true;
+    }
+
+    std::vector<buffer> buffers_;
+    size_t              next_stage_  = 0;
+    size_t              total_bytes_ = 0;
+    bool                planned_     = true;
+};
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_UTIL_TEMPORARY_STORAGE_HPP_
@@ -0,0 +1,299 @@
+// MIT License
+//
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef HIPCUB_UTIL_TRACE_HPP_
+#define HIPCUB_UTIL_TRACE_HPP_
+
+/// \file util_trace.hpp
+/// Per-call tracing of the Device* functions.
+///
+/// Tracing is compiled out unless \p HIPCUB_ENABLE_TRACING is defined before any hipCUB
+/// header is included. When enabled, the callbacks registered with \p SetTraceCallbacks
+/// are called on entry and exit of every Device* function. Calls made by a Device*
+/// function to another Device* function are not reported separately.
+///
+/// Without \p HIPCUB_ENABLE_TRACING this header only defines an empty
+/// \p HIPCUB_DETAIL_TRACE_SCOPE, the tracing API below is not declared.
+
+#ifdef HIPCUB_ENABLE_TRACING
+
+#include "config.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+BEGIN_HIPCUB_NAMESPACE
+
+/// \brief Description of one Device* call, passed to the trace callbacks.
+struct TraceEvent
+{
+    /// Name of the algorithm, for example "DeviceRadixSort::SortKeys".
+    const char* algorithm;
+    /// Compiler provided signature of the function, including its template arguments.
+    const char* signature;
+    /// Number of items. Segmented algorithms report segments, histograms report samples
+    /// and \p DeviceSpmv reports non-zeros.
+    size_t num_items;
+    /// Temporary storage size. On exit this is the size returned by a size query.
+    size_t temp_storage_bytes;
+    /// Whether the call only queried the temporary storage size.
+    bool size_query;
+    /// Stream the algorithm was called on.
+    hipStream_t stream;
+    /// Host time spent in the call in seconds, 0 on entry.
+    double host_duration;
+};
+
+/// \brief Table of trace callbacks, members that are null are not called.
+struct TraceCallbacks
+{
+    void (*on_entry)(const TraceEvent& event, void* user_data) = nullptr;
+    void (*on_exit)(const TraceEvent& event, void* user_data)  = nullptr;
+    void* user_data                                             = nullptr;
+};
+
+namespace detail
+{
+
+inline std::atomic<const TraceCallbacks*>& trace_callbacks()
+{
+    static std::atomic<const TraceCallbacks*> callbacks{nullptr};
+    return callbacks;
+}
+
+inline int& trace_depth()
+{
+    static thread_local int depth = 0;
+    return depth;
+}
+
+} // namespace detail
+
+/// \brief Registers the trace callbacks, \p nullptr disables tracing.
+///
+/// The table is not copied and must stay valid while Device* functions can be called.
+inline void SetTraceCallbacks(const TraceCallbacks* callbacks)
+{
+    detail::trace_callbacks().store(callbacks, std::memory_order_release);
+}
+
+/// \brief Returns the registered trace callbacks or \p nullptr.
+inline const TraceCallbacks* GetTraceCallbacks()
+{
+    return detail::trace_callbacks().load(std::memory_order_acquire);
+}
+
+/// \brief Adapter for range based tracing APIs such as ROCTX or NVTX.
+///
+/// A range named after the algorithm is pushed on entry and popped on exit, for example
+/// <tt>TraceRangeAdapter adapter(roctxRangePushA, roctxRangePop);</tt>
+class TraceRangeAdapter
+{
+public:
+    using push_function = int (*)(const char* message);
+    using pop_function  = int (*)();
+
+    TraceRangeAdapter(push_function push, pop_function pop) : push_(push), pop_(pop)
+    {
+        callbacks_.on_entry  = &on_entry;
+        callbacks_.on_exit   = &on_exit;
+        callbacks_.user_data = this;
+    }
+
+    TraceRangeAdapter(const TraceRangeAdapter&) = delete;
+    TraceRangeAdapter& operator=(const TraceRangeAdapter&) = delete;
+
+    /// \brief Callbacks to pass to \p SetTraceCallbacks.
+    const TraceCallbacks* Callbacks() const
+    {
+        return &callbacks_;
+    }
+
+private:
+    static void on_entry(const TraceEvent& event, void* user_data)
+    {
+        static_cast<TraceRangeAdapter*>(user_data)->push_(event.algorithm);
+    }
+
+    static void on_exit(const TraceEvent& /*event*/, void* user_data)
+    {
+        static_cast<TraceRangeAdapter*>(user_data)->pop_();
+    }
+
+    push_function  push_;
+    pop_function   pop_;
+    TraceCallbacks callbacks_;
+};
+
+/// \brief Keeps the last \p capacity completed calls in memory.
+class TraceRingBuffer
+{
+public:
+    explicit TraceRingBuffer(size_t capacity) : events_(capacity), next_(0)
+    {
+        callbacks_.on_exit   = &on_exit;
+        callbacks_.user_data = this;
+    }
+
+    TraceRingBuffer(const TraceRingBuffer&) = delete;
+    TraceRingBuffer& operator=(const TraceRingBuffer&) = delete;
+
+    /// \brief Callbacks to pass to \p SetTraceCallbacks.
+    const TraceCallbacks* Callbacks() const
+    {
+        return &callbacks_;
+    }
+
+    /// \brief Returns the recorded calls, oldest first.
+    std::vector<TraceEvent> Events() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<TraceEvent>     result;
+        const size_t                capacity = events_.size();
+        const size_t                count    = next_ < capacity ? next_ : capacity;
+        result.reserve(count);
+        for(size_t i = next_ - count; i < next_; i++)
+        {
+            result.push_back(events_[i % capacity]);
+        }
+        return result;
+    }
+
+    /// \brief Number of calls recorded since construction or the last \p Clear.
+    size_t Count() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return next_;
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        next_ = 0;
+    }
+
+private:
+    static void on_exit(const TraceEvent& event, void* user_data)
+    {
+        TraceRingBuffer*            self = static_cast<TraceRingBuffer*>(user_data);
+        std::lock_guard<std::mutex> lock(self->mutex_);
+        if(!self->events_.empty())
+        {
+            self->events_[self->next_ % self->events_.size()] = event;
+        }
+        self->next_++;
+    }
+
+    std::vector<TraceEvent> events_;
+    size_t                  next_;
+    mutable std::mutex      mutex_;
+    TraceCallbacks          callbacks_;
+};
+
+namespace detail
+{
+
+/// Reports the enclosing Device* call to the registered callbacks.
+class trace_scope
+{
+public:
+    trace_scope(const char* algorithm,
+                const char* signature,
+                size_t      num_items,
+                const void* d_temp_storage,
+                size_t&     temp_storage_bytes,
+                hipStream_t stream)
+        : callbacks_(++trace_depth() == 1 ? GetTraceCallbacks() : nullptr)
+        , temp_storage_bytes_(temp_storage_bytes)
+    {
+        if(callbacks_ == nullptr)
+        {
+            return;
+        }
+        event_.algorithm          = algorithm;
+        event_.signature          = signature;
+        event_.num_items          = num_items;
+        event_.temp_storage_bytes = temp_storage_bytes;
+        event_.size_query         = d_temp_storage == nullptr;
+        event_.stream             = stream;
+        event_.host_duration      = 0.0;
+        if(callbacks_->on_entry != nullptr)
+        {
+            callbacks_->on_entry(event_, callbacks_->user_data);
+        }
+        start_ = std::chrono::steady_clock::now();
+    }
+
+    trace_scope(const trace_scope&) = delete;
+    trace_scope& operator=(const trace_scope&) = delete;
+
+    ~trace_scope()
+    {
+        --trace_depth();
+        if(callbacks_ == nullptr || callbacks_->on_exit == nullptr)
+        {
+            return;
+        }
+        const auto end            = std::chrono::steady_clock::now();
+        event_.temp_storage_bytes = temp_storage_bytes_;
+        event_.host_duration      = std::chrono::duration<double>(end - start_).count();
+        callbacks_->on_exit(event_, callbacks_->user_data);
+    }
+
+private:
+    const TraceCallbacks*                 callbacks_;
+    size_t&                               temp_storage_bytes_;
+    TraceEvent                            event_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace detail
+
+END_HIPCUB_NAMESPACE
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #define HIPCUB_DETAIL_FUNCTION_SIGNATURE __FUNCSIG__
+#else
+    #define HIPCUB_DETAIL_FUNCTION_SIGNATURE __PRETTY_FUNCTION__
+#endif
+
+/// Placed at the start of every Device* function.
+#define HIPCUB_DETAIL_TRACE_SCOPE(name, num_items, d_temp_storage, temp_storage_bytes, stream) \
+    ::hipcub::detail::trace_scope hipcub_trace_scope(name,                                     \
+                                                     HIPCUB_DETAIL_FUNCTION_SIGNATURE,         \
+                                                     static_cast<size_t>(num_items),           \
+                                                     d_temp_storage,                           \
+                                                     temp_storage_bytes,                       \
+                                                     stream)
+
+#else // HIPCUB_ENABLE_TRACING
+
+/// Placed at the start of every Device* function.
+#define HIPCUB_DETAIL_TRACE_SCOPE(name, num_items, d_temp_storage, temp_storage_bytes, stream) \
+    (void)0
+
+#endif // HIPCUB_ENABLE_TRACING
+
+#endif // HIPCUB_UTIL_TRACE_HPP_
@@ -0,0 +1,584 @@
+// MIT License
+//
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef HIPCUB_V2_HPP_
+#define HIPCUB_V2_HPP_
+
+#include "config.hpp"
+
+#include "device/device_radix_sort.hpp"
+#include "device/device_reduce.hpp"
+#include "device/device_scan.hpp"
+#include "util_allocator.hpp"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+/// \file v2.hpp
+/// Algorithm objects on top of the Device* functions.
+///
+/// An algorithm object is created once for a problem size. Creating it queries the
+/// temporary storage size, every invocation is then a single call which takes the
+/// temporary storage as a \p span or allocates it from an allocator, and returns the
+/// error in a \p result.
+///
+/// \par Example
+/// \code
+/// auto sort = hipcub::v2::radix_sort_keys<int>::create(num_items, stream);
+/// if(!sort)
+///     return sort.error();
+/// hipcub::v2::caching_allocator allocator(caching_device_allocator);
+/// for(int i = 0; i < iterations; i++)
+///     (*sort)(allocator, stream, d_keys_in, d_keys_out);
+/// \endcode
+
+BEGIN_HIPCUB_NAMESPACE
+
+namespace v2
+{
+
+/// \brief Non-owning view of \p size contiguous elements, constructible from any
+/// container with \p data() and \p size() such as \p std::span and \p std::vector.
+template<class T>
+class span
+{
+public:
+    using element_type = T;
+
+    constexpr span() noexcept : data_(nullptr), size_(0) {}
+
+    constexpr span(T* data, size_t size) noexcept : data_(data), size_(size) {}
+
+    template<class Container,
+             class = typename std::enable_if<
+                 !std::is_same<typename std::decay<Container>::type, span>::value
+                 && std::is_convertible<decltype(std::declval<Container&>().data()),
+                                        T*>::value>::type>
+    constexpr span(Container&& container) noexcept
+        : data_(container.data()), size_(container.size())
+    {}
+
+    constexpr T* data() const noexcept
+    {
+        return data_;
+    }
+
+    constexpr size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    constexpr size_t size_bytes() const noexcept
+    {
+        return size_ * sizeof(T);
+    }
+
+private:
+    T*     data_;
+    size_t size_;
+};
+
+/// \brief Either a value or the error which prevented computing it.
+///
+/// \p value() must only be called if \p has_value() is \p true.
+template<class T>
+class result
+{
+public:
+    result(T value) : error_(hipSuccess), value_(std::move(value)) {}
+
+    result(hipError_t error) : error_(error), value_() {}
+
+    bool has_value() const noexcept
+    {
+        return error_ == hipSuccess;
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return has_value();
+    }
+
+    hipError_t error() const noexcept
+    {
+        return error_;
+    }
+
+    T& value() & noexcept
+    {
+        return value_;
+    }
+
+    const T& value() const& noexcept
+    {
+        return value_;
+    }
+
+    T& operator*() & noexcept
+    {
+        return value_;
+    }
+
+    const T& operator*() const& noexcept
+    {
+        return value_;
+    }
+
+    T* operator->() noexcept
+    {
+        return &value_;
+    }
+
+    const T* operator->() const noexcept
+    {
+        return &value_;
+    }
+
+private:
+    hipError_t error_;
+    T          value_;
+};
+
+/// \brief Result of an operation without a value.
+template<>
+class result<void>
+{
+public:
+    result(hipError_t error = hipSuccess) : error_(error) {}
+
+    bool has_value() const noexcept
+    {
+        return error_ == hipSuccess;
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return has_value();
+    }
+
+    hipError_t error() const noexcept
+    {
+        return error_;
+    }
+
+private:
+    hipError_t error_;
+};
+
+/// \brief Allocates temporary storage with \p hipMalloc and \p hipFree.
+struct device_allocator
+{
+    hipError_t allocate(void** ptr, size_t bytes, hipStream_t /*stream*/)
+    {
+        return hipMalloc(ptr, bytes);
+    }
+
+    hipError_t deallocate(void* ptr, hipStream_t /*stream*/)
+    {
+        return hipFree(ptr);
+    }
+};
+
+/// \brief Allocates temporary storage from a \p CachingDeviceAllocator. Blocks are
+/// associated with the stream of the call and reused once the call is complete.
+class caching_allocator
+{
+public:
+    explicit caching_allocator(CachingDeviceAllocator& allocator) : allocator_(&allocator) {}
+
+    hipError_t allocate(void** ptr, size_t bytes, hipStream_t stream)
+    {
+        return allocator_->DeviceAllocate(ptr, bytes, stream);
+    }
+
+    hipError_t deallocate(void* ptr, hipStream_t /*stream*/)
+    {
+        return allocator_->DeviceFree(ptr);
+    }
+
+private:
+    CachingDeviceAllocator* allocator_;
+};
+
+namespace detail
+{
+
+template<class T>
+struct is_span : std::false_type
+{};
+
+template<class T>
+struct is_span<span<T>> : std::true_type
+{};
+
+/// Invocation of an algorithm object. \p Derived implements
+/// <tt>hipError_t run(void* d_temp_storage, size_t& temp_storage_bytes,
+/// hipStream_t stream, Args... args) const</tt>.
+template<class Derived>
+class algorithm
+{
+public:
+    /// \brief Temporary storage in bytes required by every invocation.
+    size_t storage_bytes() const noexcept
+    {
+        return storage_bytes_;
+    }
+
+    /// \brief Runs the algorithm with \p temp_storage, which must hold at least
+    /// \p storage_bytes() bytes.
+    template<class T, class... Args>
+    result<void> operator()(span<T> temp_storage, hipStream_t stream, Args&&... args) const
+    {
+        if(temp_storage.size_bytes() < storage_bytes_)
+        {
+            return hipErrorInvalidValue;
+        }
+        size_t temp_storage_bytes = storage_bytes_;
+        return derived().run(static_cast<void*>(temp_storage.data()),
+                             temp_storage_bytes,
+                             stream,
+                             std::forward<Args>(args)...);
+    }
+
+    /// \brief Runs the algorithm with temporary storage allocated from \p allocator
+    /// and released after the algorithm is enqueued on \p stream.
+    template<class Allocator,
+             class... Args,
+             class = typename std::enable_if<!is_span<Allocator>::value>::type>
+    result<void> operator()(Allocator& allocator, hipStream_t stream, Args&&... args) const
+    {
+        void*      d_temp_storage = nullptr;
+        hipError_t error          = allocator.allocate(&d_temp_storage, storage_bytes_, stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        size_t temp_storage_bytes = storage_bytes_;
+        error = derived().run(d_temp_storage,
+                              temp_storage_bytes,
+                              stream,
+                              std::forward<Args>(args)...);
+        const hipError_t free_error = allocator.deallocate(d_temp_storage, stream);
+        return error != hipSuccess ? error : free_error;
+    }
+
+protected:
+    /// Queries the temporary storage size by running \p derived with a null pointer.
+    template<class... Args>
+    hipError_t query_storage(hipStream_t stream, Args&&... args)
+    {
+        return derived().run(nullptr, storage_bytes_, stream, std::forward<Args>(args)...);
+    }
+
+private:
+    const Derived& derived() const
+    {
+        return static_cast<const Derived&>(*this);
+    }
+
+    Derived& derived()
+    {
+        return static_cast<Derived&>(*this);
+    }
+
+    size_t storage_bytes_ = 0;
+};
+
+} // namespace detail
+
+/// \brief \p DeviceReduce::Reduce of \p num_items values of type \p T.
+template<class T, class ReduceOp>
+class reduce : public detail::algorithm<reduce<T, ReduceOp>>
+{
+public:
+    reduce() = default;
+
+    /// \brief Creates the algorithm for \p num_items items on the device of \p stream.
+    static result<reduce> create(int num_items, ReduceOp op, T init, hipStream_t stream = 0)
+    {
+        reduce algorithm(num_items, op, init);
+        hipError_t error = algorithm.query_storage(stream,
+                                                   static_cast<const T*>(nullptr),
+                                                   static_cast<T*>(nullptr));
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        return algorithm;
+    }
+
+    hipError_t run(void*       d_temp_storage,
+                   size_t&     temp_storage_bytes,
+                   hipStream_t stream,
+                   const T*    d_in,
+                   T*          d_out) const
+    {
+        return DeviceReduce::Reduce(d_temp_storage,
+                                    temp_storage_bytes,
+                                    d_in,
+                                    d_out,
+                                    num_items_,
+                                    op_,
+                                    init_,
+                                    stream);
+    }
+
+private:
+    reduce(int num_items, ReduceOp op, T init) : num_items_(num_items), op_(op), init_(init) {}
+
+    int      num_items_ = 0;
+    ReduceOp op_{};
+    T        init_{};
+};
+
+/// \brief \p DeviceReduce::Sum of \p num_items values of type \p T.
+template<class T>
+class reduce_sum : public detail::algorithm<reduce_sum<T>>
+{
+public:
+    reduce_sum() = default;
+
+    /// \brief Creates the algorithm for \p num_items items on the device of \p stream.
+    static result<reduce_sum> create(int num_items, hipStream_t stream = 0)
+    {
+        reduce_sum algorithm;
+        algorithm.num_items_ = num_items;
+        hipError_t error     = algorithm.query_storage(stream,
+                                                       static_cast<const T*>(nullptr),
+                                                       static_cast<T*>(nullptr));
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        return algorithm;
+    }
+
+    hipError_t run(void*       d_temp_storage,
+                   size_t&     temp_storage_bytes,
+                   hipStream_t stream,
+                   const T*    d_in,
+                   T*          d_out) const
+    {
+        return DeviceReduce::Sum(d_temp_storage,
+                                 temp_storage_bytes,
+                                 d_in,
+                                 d_out,
+                                 num_items_,
+                                 stream);
+    }
+
+private:
+    int num_items_ = 0;
+};
+
+/// \brief \p DeviceScan::InclusiveSum of \p num_items values of type \p T.
+template<class T>
+class inclusive_sum : public detail::algorithm<inclusive_sum<T>>
+{
+public:
+    inclusive_sum() = default;
+
+    /// \brief Creates the algorithm for \p num_items items on the device of \p stream.
+    static result<inclusive_sum> create(size_t num_items, hipStream_t stream = 0)
+    {
+        inclusive_sum algorithm;
+        algorithm.num_items_ = num_items;
+        hipError_t error     = algorithm.query_storage(stream,
+                                                       static_cast<const T*>(nullptr),
+                                                       static_cast<T*>(nullptr));
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        return algorithm;
+    }
+
+    hipError_t run(void*       d_temp_storage,
+                   size_t&     temp_storage_bytes,
+                   hipStream_t stream,
+                   const T*    d_in,
+                   T*          d_out) const
+    {
+        return DeviceScan::InclusiveSum(d_temp_storage,
+                                        temp_storage_bytes,
+                                        d_in,
+                                        d_out,
+                                        num_items_,
+                                        stream);
+    }
+
+private:
+    size_t num_items_ = 0;
+};
+
+/// \brief \p DeviceScan::ExclusiveSum of \p num_items values of type \p T.
+template<class T>
+class exclusive_sum : public detail::algorithm<exclusive_sum<T>>
+{
+public:
+    exclusive_sum() = default;
+
+    /// \brief Creates the algorithm for \p num_items items on the device of \p stream.
+    static result<exclusive_sum> create(size_t num_items, hipStream_t stream = 0)
+    {
+        exclusive_sum algorithm;
+        algorithm.num_items_ = num_items;
+        hipError_t error     = algorithm.query_storage(stream,
+                                                       static_cast<const T*>(nullptr),
+                                                       static_cast<T*>(nullptr));
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        return algorithm;
+    }
+
+    hipError_t run(void*       d_temp_storage,
+                   size_t&     temp_storage_bytes,
+                   hipStream_t stream,
+                   const T*    d_in,
+                   T*          d_out) const
+    {
+        return DeviceScan::ExclusiveSum(d_temp_storage,
+                                        temp_storage_bytes,
+                                        d_in,
+                                        d_out,
+                                        num_items_,
+                                        stream);
+    }
+
+private:
+    size_t num_items_ = 0;
+};
+
+/// \brief \p DeviceRadixSort::SortKeys of \p num_items keys of type \p KeyT, comparing the
+/// bits [\p begin_bit, \p end_bit).
+template<class KeyT>
+class radix_sort_keys : public detail::algorithm<radix_sort_keys<KeyT>>
+{
+public:
+    radix_sort_keys() = default;
+
+    /// \brief Creates the algorithm for \p num_items keys on the device of \p stream.
+    static result<radix_sort_keys> create(size_t      num_items,
+                                          hipStream_t stream    = 0,
+                                          int         begin_bit = 0,
+                                          int         end_bit   = sizeof(KeyT) * 8)
+    {
+        radix_sort_keys algorithm;
+        algorithm.num_items_ = num_items;
+        algorithm.begin_bit_ = begin_bit;
+        algorithm.end_bit_   = end_bit;
+        hipError_t error     = algorithm.query_storage(stream,
+                                                       static_cast<const KeyT*>(nullptr),
+                                                       static_cast<KeyT*>(nullptr));
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        return algorithm;
+    }
+
+    hipError_t run(void*       d_temp_storage,
+                   size_t&     temp_storage_bytes,
+                   hipStream_t stream,
+                   const KeyT* d_keys_in,
+                   KeyT*       d_keys_out) const
+    {
+        return DeviceRadixSort::SortKeys(d_temp_storage,
+                                         temp_storage_bytes,
+                                         d_keys_in,
+                                         d_keys_out,
+                                         num_items_,
+                                         begin_bit_,
+                                         end_bit_,
+                                         stream);
+    }
+
+private:
+    size_t num_items_ = 0;
+    int    begin_bit_ = 0;
+    int    end_bit_   = sizeof(KeyT) * 8;
+};
+
+/// \brief \p DeviceRadixSort::SortPairs of \p num_items keys of type \p KeyT and values of
+/// type \p ValueT, comparing the bits [\p begin_bit, \p end_bit) of the keys.
+template<class KeyT, class ValueT>
+class radix_sort_pairs : public detail::algorithm<radix_sort_pairs<KeyT, ValueT>>
+{
+public:
+    radix_sort_pairs() = default;
+
+    /// \brief Creates the algorithm for \p num_items pairs on the device of \p stream.
+    static result<radix_sort_pairs> create(size_t      num_items,
+                                           hipStream_t stream    = 0,
+                                           int         begin_bit = 0,
+                                           int         end_bit   = sizeof(KeyT) * 8)
+    {
+        radix_sort_pairs algorithm;
+        algorithm.num_items_ = num_items;
+        algorithm.begin_bit_ = begin_bit;
+        algorithm.end_bit_   = end_bit;
+        hipError_t error     = algorithm.query_storage(stream,
+                                                       static_cast<const KeyT*>(nullptr),
+                                                       static_cast<KeyT*>(nullptr),
+                                                       static_cast<const ValueT*>(nullptr),
+                                                       static_cast<ValueT*>(nullptr));
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        return algorithm;
+    }
+
+    hipError_t run(void*         d_temp_storage,
+                   size_t&       temp_storage_bytes,
+                   hipStream_t   stream,
+                   const KeyT*   d_keys_in,
+                   KeyT*         d_keys_out,
+                   const ValueT* d_values_in,
+                   ValueT*       d_values_out) const
+    {
+        return DeviceRadixSort::SortPairs(d_temp_storage,
+                                          temp_storage_bytes,
+                                          d_keys_in,
+                                          d_keys_out,
+                                          d_values_in,
+                                          d_values_out,
+                                          num_items_,
+                                          begin_bit_,
+                                          end_bit_,
+                                          stream);
+    }
+
+private:
+    size_t num_items_ = 0;
+    int    begin_bit_ = 0;
+    int    end_bit_   = sizeof(KeyT) * 8;
+};
+
+} // namespace v2
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_V2_HPP_
@@ -48,13 +48,15 @@ def parse_args():
     Checks build arguments
     """)
     parser.add_argument('-t', '--test', required=True, type=str, action='append',
-                        help='Test set to run from rtest.xml (required, e.g. osdb)')
+                        help='Test set to run from rtest.xml (required, e.g. osdb, or small/large for the size class shards)')
     parser.add_argument('-g', '--debug', required=False, default=False,  action='store_true',
                         help='Test Debug build (optional, default: false)')
     parser.add_argument('-o', '--output', type=str, required=False, default="xml", 
                         help='Test output file (optional, default: test_detail.xml)')
     parser.add_argument('-a', '--argument', action=ArgAction, nargs=2, metavar=('NAME', 'VALUE'), default={},
                         help='Arguments to substitute into the xml file (optional, multiple)')
+    parser.add_argument('-j', '--jobs', type=int, required=False, default=0,
+                        help='Number of tests run in parallel by ctest (optional, default: serial)')
     parser.add_argument(      '--install_dir', type=str, required=False, default="build", 
                         help='Installation directory where build or release folders are (optional, default: build)')
     parser.add_argument(      '--fail_test', default=False, required=False, action='store_true',
@@ -301,6 +303,8 @@ def batch(script, xml):
                 else:
                     val = ""
                 var_subs[name] = val
+            if args.jobs > 0:
+                var_subs['CTEST_PARALLEL'] = f"--parallel {args.jobs}"
             for name, val in args.argument.items():
                 var_subs[name] = val
             for test in xml.getElementsByTagName('test'):
@@ -0,0 +1,277 @@
+#!/usr/bin/env python3
+
+# MIT License
+#
+# Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""Measures preprocessing time, compile time and object size of hipCUB.
+
+Every public header is measured in a translation unit that only includes it, and
+every algorithm instantiation in a translation unit that instantiates it for one
+set of types. Results are written as JSON and can be appended to a history file
+and compared against the previous entry, so that regressions in template bloat
+are visible over time.
+
+Cases which fail to compile (for example device code with a host-only compiler)
+are recorded with status "failed" instead of aborting the run, so the script
+can also measure the host-compilable subset when no GPU toolchain is available.
+With --preprocess-only only the preprocessor is run.
+"""
+
+import argparse
+from datetime import datetime
+import json
+import os
+import shlex
+import subprocess
+import sys
+import tempfile
+import time
+
+
+HEADER_DIRECTORIES = ['block', 'device', 'grid', 'iterator', 'thread', 'warp']
+
+# name -> (header, body). Body is placed into a host function, "bytes" is a size_t&.
+INSTANTIATIONS = {}
+
+
+def add_instantiations():
+    radix_sort_keys = ['uint8_t', 'uint16_t', 'uint32_t', 'uint64_t', 'float', 'double']
+    for key in radix_sort_keys:
+        INSTANTIATIONS[f'DeviceRadixSort::SortKeys<{key}>'] = (
+            'hipcub/device/device_radix_sort.hpp',
+            f'{key}* keys = nullptr;\n'
+            f'return hipcub::DeviceRadixSort::SortKeys(nullptr, bytes, keys, keys, 0);')
+    for key, value in [('uint32_t', 'uint32_t'), ('uint64_t', 'uint32_t'), ('float', 'uint32_t')]:
+        INSTANTIATIONS[f'DeviceRadixSort::SortPairs<{key},{value}>'] = (
+            'hipcub/device/device_radix_sort.hpp',
+            f'{key}* keys = nullptr;\n'
+            f'{value}* values = nullptr;\n'
+            f'return hipcub::DeviceRadixSort::SortPairs(nullptr, bytes, keys, keys, values, values, 0);')
+    for value in ['int', 'float', 'double']:
+        INSTANTIATIONS[f'DeviceReduce::Sum<{value}>'] = (
+            'hipcub/device/device_reduce.hpp',
+            f'{value}* data = nullptr;\n'
+            f'return hipcub::DeviceReduce::Sum(nullptr, bytes, data, data, 0);')
+        INSTANTIATIONS[f'DeviceScan::InclusiveSum<{value}>'] = (
+            'hipcub/device/device_scan.hpp',
+            f'{value}* data = nullptr;\n'
+            f'return hipcub::DeviceScan::InclusiveSum(nullptr, bytes, data, data, 0);')
+    INSTANTIATIONS['DeviceSelect::Flagged<int>'] = (
+        'hipcub/device/device_select.hpp',
+        'int* data = nullptr;\n'
+        'unsigned char* flags = nullptr;\n'
+        'unsigned int* count = nullptr;\n'
+        'return hipcub::DeviceSelect::Flagged(nullptr, bytes, data, flags, data, count, 0);')
+
+
+def header_source(header):
+    return f'#include <{header}>\n'
+
+
+def instantiation_source(header, body):
+    indented = '\n'.join('    ' + line for line in body.splitlines())
+    return (f'#include <{header}>\n'
+            '#include <cstdint>\n\n'
+            'hipError_t instantiate(size_t& bytes)\n'
+            '{\n'
+            f'{indented}\n'
+            '}\n')
+
+
+def find_headers(include_dir):
+    headers = ['hipcub/hipcub.hpp']
+    for directory in HEADER_DIRECTORIES:
+        path = os.path.join(include_dir, 'hipcub', directory)
+        if not os.path.isdir(path):
+            continue
+        for filename in sorted(os.listdir(path)):
+            if filename.endswith('.hpp'):
+                headers.append(f'hipcub/{directory}/{filename}')
+    return headers
+
+
+def run_timed(command, repetitions):
+    """Runs command repetitions times, returns (best seconds, last result)."""
+    best = None
+    result = None
+    for _ in range(repetitions):
+        start = time.perf_counter()
+        result = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+        elapsed = time.perf_counter() - start
+        if result.returncode != 0:
+            return None, result
+        best = elapsed if best is None else min(best, elapsed)
+    return best, result
+
+
+def measure(name, kind, source, args, work_dir):
+    source_path = os.path.join(work_dir, 'case.cpp')
+    object_path = os.path.join(work_dir, 'case.o')
+    with open(source_path, 'w') as file:
+        file.write(source)
+
+    record = {'name': name, 'kind': kind, 'status': 'ok'}
+    base_command = [args.compiler] + args.flags + [f'-I{d}' for d in args.include_dirs]
+
+    preprocess_time, result = run_timed(base_command + ['-E', source_path], args.repetitions)
+    if preprocess_time is None:
+        record['status'] = 'failed'
+        record['error'] = result.stderr.decode(errors='replace')[-2000:]
+        return record
+    record['preprocess_seconds'] = preprocess_time
+    record['preprocessed_bytes'] = len(result.stdout)
+    record['preprocessed_lines'] = result.stdout.count(b'\n')
+
+    if args.preprocess_only:
+        return record
+
+    if os.path.exists(object_path):
+        os.remove(object_path)
+    compile_time, result = run_timed(base_command + ['-c', source_path, '-o', object_path],
+                                     args.repetitions)
+    if compile_time is None:
+        record['status'] = 'failed'
+        record['error'] = result.stderr.decode(errors='replace')[-2000:]
+        return record
+    record['compile_seconds'] = compile_time
+    record['object_bytes'] = os.path.getsize(object_path)
+    return record
+
+
+def git_revision(source_dir):
+    try:
+        result = subprocess.run(['git', 'rev-parse', 'HEAD'], cwd=source_dir,
+                                stdout=subprocess.PIPE, stderr=subprocess.DEVNULL)
+        if result.returncode == 0:
+            return result.stdout.decode().strip()
+    except OSError:
+        pass
+    return None
+
+
+def load_previous(history_path):
+    if not history_path or not os.path.exists(history_path):
+        return None
+    previous = None
+    with open(history_path) as file:
+        for line in file:
+            if line.strip():
+                previous = json.loads(line)
+    return previous
+
+
+def compare(previous, current, threshold):
+    """Prints and returns the cases which grew by more than threshold percent."""
+    regressions = []
+    previous_cases = {case['name']: case for case in previous['cases']}
+    for case in current['cases']:
+        old = previous_cases.get(case['name'])
+        if old is None or old['status'] != 'ok' or case['status'] != 'ok':
+            continue
+        for metric in ['compile_seconds', 'object_bytes', 'preprocessed_bytes']:
+            if metric not in case or metric not in old or old[metric] == 0:
+                continue
+            change = 100.0 * (case[metric] - old[metric]) / old[metric]
+            if change > threshold:
+                regressions.append((case['name'], metric, old[metric], case[metric], change))
+    for name, metric, old, new, change in regressions:
+        print(f'[Regression] {name}: {metric} {old:.6g} -> {new:.6g} (+{change:.1f}%)')
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--source-dir', required=True,
+                        help='hipCUB include directory, headers are discovered from it')
+    parser.add_argument('--compiler', default=os.environ.get('CXX', 'c++'),
+                        help='compiler used for all measurements (default: $CXX)')
+    parser.add_argument('--flags', default='-std=c++14 -O3',
+                        help='compiler flags as one string (default: "%(default)s")')
+    parser.add_argument('-I', '--include-dir', dest='include_dirs', action='append', default=[],
+                        help='additional include directory, can be repeated')
+    parser.add_argument('--include-dirs', dest='include_dirs_list', default='',
+                        help='additional include directories as a ";" separated list (as CMake passes them)')
+    parser.add_argument('--repetitions', type=int, default=3,
+                        help='the fastest of this many runs is reported (default: %(default)s)')
+    parser.add_argument('--filter', default='',
+                        help='only measure cases whose name contains this string')
+    parser.add_argument('--preprocess-only', action='store_true',
+                        help='only measure the preprocessor')
+    parser.add_argument('--output', default='hipcub_compile_time.json',
+                        help='results of this run (default: %(default)s)')
+    parser.add_argument('--history', default=None,
+                        help='JSON lines file the results are appended to')
+    parser.add_argument('--threshold', type=float, default=10.0,
+                        help='percentage above which a change is a regression (default: %(default)s)')
+    parser.add_argument('--fail-on-regression', action='store_true',
+                        help='exit with 1 if a regression against the history was found')
+    args = parser.parse_args()
+    args.flags = shlex.split(args.flags)
+    args.include_dirs = ([args.source_dir] + args.include_dirs
+                         + [d for d in args.include_dirs_list.split(';') if d])
+
+    add_instantiations()
+    cases = [(header, 'header', header_source(header)) for header in find_headers(args.source_dir)]
+    cases += [(name, 'instantiation', instantiation_source(header, body))
+              for name, (header, body) in INSTANTIATIONS.items()]
+    cases = [case for case in cases if args.filter in case[0]]
+
+    results = []
+    with tempfile.TemporaryDirectory() as work_dir:
+        for name, kind, source in cases:
+            record = measure(name, kind, source, args, work_dir)
+            results.append(record)
+            if record['status'] == 'ok':
+                compile_text = (f", compile {record['compile_seconds']:.2f} s"
+                                f", object {record['object_bytes']} B"
+                                if 'compile_seconds' in record else '')
+                print(f"{name}: preprocess {record['preprocess_seconds']:.2f} s"
+                      f", {record['preprocessed_lines']} lines{compile_text}")
+            else:
+                print(f'{name}: failed')
+
+    current = {
+        'datetime': datetime.now().isoformat(timespec='seconds'),
+        'revision': git_revision(args.source_dir),
+        'compiler': args.compiler,
+        'flags': args.flags,
+        'cases': results,
+    }
+    with open(args.output, 'w') as file:
+        json.dump(current, file, indent=2)
+
+    regressions = []
+    previous = load_previous(args.history)
+    if previous is not None:
+        regressions = compare(previous, current, args.threshold)
+    if args.history:
+        with open(args.history, 'a') as file:
+            file.write(json.dumps(current) + '\n')
+
+    if regressions and args.fail_on_regression:
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
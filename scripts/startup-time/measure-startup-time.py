@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+
+# MIT License
+#
+# Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""Measures the startup cost of hipCUB binaries and the size of their code objects.
+
+Startup: the executable (normally benchmark_startup) is run --repetitions times for
+every value of HIP_ENABLE_DEFERRED_LOADING in --deferred-loading. The wall time of
+the process is measured, and if the executable prints a JSON object (as
+benchmark_startup does) its runtime initialization and first/second call times are
+reported as well. The median of the repetitions is reported.
+
+Code objects: every file given with --code-objects (executables, shared libraries
+such as libhipcub_instantiations.so, or object files) is searched for clang offload
+bundles, and the size of the code object of every target is reported. No ROCm tools
+are needed for this.
+"""
+
+import argparse
+import json
+import os
+import statistics
+import struct
+import subprocess
+import sys
+import time
+
+
+BUNDLE_MAGIC = b'__CLANG_OFFLOAD_BUNDLE__'
+
+
+def read_fatbin_sections(path):
+    """Returns the contents of the .hip_fatbin sections of an ELF file, or the whole
+    file if it is not an ELF file (for example a raw bundle)."""
+    with open(path, 'rb') as file:
+        data = file.read()
+    if data[:4] != b'\x7fELF' or data[4] != 2:
+        return [data]
+    endian = '<' if data[5] == 1 else '>'
+    section_offset, = struct.unpack_from(endian + 'Q', data, 0x28)
+    section_size, section_count, names_index = struct.unpack_from(endian + 'HHH', data, 0x3A)
+    sections = [struct.unpack_from(endian + 'IIQQQQIIQQ', data, section_offset + i * section_size)
+                for i in range(section_count)]
+    names = sections[names_index]
+    contents = []
+    for section in sections:
+        name_offset = names[4] + section[0]
+        name = data[name_offset:data.index(b'\0', name_offset)]
+        if name == b'.hip_fatbin':
+            contents.append(data[section[4]:section[4] + section[5]])
+    return contents
+
+
+def code_object_sizes(path):
+    """Returns {target: bytes} summed over all offload bundles of path."""
+    sizes = {}
+    for data in read_fatbin_sections(path):
+        position = data.find(BUNDLE_MAGIC)
+        while position >= 0:
+            entries, = struct.unpack_from('<Q', data, position + len(BUNDLE_MAGIC))
+            cursor = position + len(BUNDLE_MAGIC) + 8
+            end = position
+            for _ in range(entries):
+                offset, size, triple_size = struct.unpack_from('<QQQ', data, cursor)
+                cursor += 24
+                triple = data[cursor:cursor + triple_size].decode(errors='replace')
+                cursor += triple_size
+                if not triple.startswith('host'):
+                    sizes[triple] = sizes.get(triple, 0) + size
+                end = max(end, position + offset + size)
+            position = data.find(BUNDLE_MAGIC, max(end, position + 1))
+    return sizes
+
+
+def run_startup(executable, arguments, deferred_loading, repetitions):
+    environment = dict(os.environ)
+    if deferred_loading is None:
+        environment.pop('HIP_ENABLE_DEFERRED_LOADING', None)
+    else:
+        environment['HIP_ENABLE_DEFERRED_LOADING'] = deferred_loading
+    runs = []
+    for _ in range(repetitions):
+        start = time.perf_counter()
+        result = subprocess.run([executable] + arguments, env=environment,
+                                stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+        wall_ms = 1000.0 * (time.perf_counter() - start)
+        if result.returncode != 0:
+            sys.stderr.write(result.stderr.decode(errors='replace'))
+            raise RuntimeError(f'{executable} failed with exit code {result.returncode}')
+        run = {'wall_ms': wall_ms}
+        output = result.stdout.decode(errors='replace')
+        if '{' in output:
+            try:
+                run.update(json.loads(output[output.index('{'):output.rindex('}') + 1]))
+            except ValueError:
+                pass
+        runs.append(run)
+    return runs
+
+
+def summarize(runs):
+    summary = {'wall_ms': statistics.median(run['wall_ms'] for run in runs)}
+    if all('runtime_init_ms' in run for run in runs):
+        summary['runtime_init_ms'] = statistics.median(run['runtime_init_ms'] for run in runs)
+        summary['calls'] = {}
+        for name in runs[0].get('calls', {}):
+            summary['calls'][name] = {
+                metric: statistics.median(run['calls'][name][metric] for run in runs)
+                for metric in ['first_ms', 'second_ms']}
+    return summary
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--executable', default=None,
+                        help='executable whose startup is measured (normally benchmark_startup)')
+    parser.add_argument('--arguments', default='',
+                        help='arguments passed to the executable as one string')
+    parser.add_argument('--deferred-loading', default='0,1',
+                        help='comma separated values of HIP_ENABLE_DEFERRED_LOADING, "default" '
+                             'leaves it unset (default: %(default)s)')
+    parser.add_argument('--repetitions', type=int, default=5,
+                        help='the median of this many runs is reported (default: %(default)s)')
+    parser.add_argument('--code-objects', nargs='*', default=[],
+                        help='files whose code object sizes per target are reported')
+    parser.add_argument('--output', default='hipcub_startup_time.json',
+                        help='results of this run (default: %(default)s)')
+    args = parser.parse_args()
+
+    results = {'startup': {}, 'code_objects': {}}
+
+    for path in args.code_objects:
+        sizes = code_object_sizes(path)
+        results['code_objects'][path] = sizes
+        print(f'{path}: {sum(sizes.values())} B in {len(sizes)} code objects')
+        for target, size in sorted(sizes.items()):
+            print(f'    {target}: {size} B')
+
+    if args.executable:
+        for setting in args.deferred_loading.split(','):
+            value = None if setting == 'default' else setting
+            summary = summarize(run_startup(args.executable, args.arguments.split(),
+                                            value, args.repetitions))
+            results['startup'][setting] = summary
+            print(f'HIP_ENABLE_DEFERRED_LOADING={setting}: process {summary["wall_ms"]:.1f} ms'
+                  + (f', runtime init {summary["runtime_init_ms"]:.1f} ms'
+                     if 'runtime_init_ms' in summary else ''))
+            for name, call in summary.get('calls', {}).items():
+                print(f'    {name}: first {call["first_ms"]:.2f} ms'
+                      f', second {call["second_ms"]:.2f} ms')
+
+    with open(args.output, 'w') as file:
+        json.dump(results, file, indent=2)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
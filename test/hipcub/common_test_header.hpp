@@ -117,6 +117,33 @@ inline bool use_hmm()
     return false;
 }
 
+// Inputs larger than this belong to the "large" size class.
+constexpr size_t large_size_class_threshold = 1 << 18;
+
+// Returns whether inputs of this size are tested by the current test shard. Tests with large
+// inputs are registered with ctest once per size class, and ctest selects the size class with
+// the HIPCUB_TEST_SIZE_CLASS environment variable ("small" or "large"). If it is not set, all
+// sizes are tested.
+inline bool size_class_enabled(size_t size)
+{
+    const char* size_class = getenv("HIPCUB_TEST_SIZE_CLASS");
+    if (size_class == nullptr)
+    {
+        return true;
+    }
+
+    const bool large = size > large_size_class_threshold;
+    if (strcmp(size_class, "small") == 0)
+    {
+        return !large;
+    }
+    if (strcmp(size_class, "large") == 0)
+    {
+        return large;
+    }
+    return true;
+}
+
 // Helper for HMM allocations: HMM is requested through HIPCUB_USE_HMM environment variable
 template <class T>
 hipError_t hipMallocHelper(T** devPtr, size_t size)
@@ -34,6 +34,8 @@
 
 // kernel definitions
 #include "test_hipcub_block_load_store.kernels.hpp"
+#include "hipcub/iterator/cache_modified_input_iterator.hpp"
+#include "hipcub/iterator/cache_modified_output_iterator.hpp"
 #include "hipcub/iterator/discard_output_iterator.hpp"
 
 // Start stamping out tests
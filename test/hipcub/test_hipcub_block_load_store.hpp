@@ -429,3 +429,120 @@ typed_test_def(HipcubBlockLoadStoreTests, name_suffix, LoadStoreDiscardIterator)
         HIP_CHECK(hipFree(device_unguarded_elements));
     }
 }
+
+typed_test_def(HipcubBlockLoadStoreTests, name_suffix, LoadStoreCacheModifiedIterator)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using Type                                             = typename TestFixture::params::type;
+    constexpr size_t                      block_size       = TestFixture::params::block_size;
+    constexpr hipcub::BlockLoadAlgorithm  load_method      = TestFixture::params::load_method;
+    constexpr hipcub::BlockStoreAlgorithm store_method     = TestFixture::params::store_method;
+    const size_t                          items_per_thread = TestFixture::params::items_per_thread;
+    constexpr auto                        items_per_block  = block_size * items_per_thread;
+    const auto                            grid_size        = 113;
+    const size_t                          size             = items_per_block * grid_size;
+
+    constexpr double fraction_valid = 0.8f;
+
+    // Given block size not supported
+    if(block_size > test_utils::get_max_block_size() || (block_size & (block_size - 1)) != 0)
+    {
+        return;
+    }
+
+    using InputIteratorT  = hipcub::CacheModifiedInputIterator<hipcub::LOAD_CS, Type>;
+    using OutputIteratorT = hipcub::CacheModifiedOutputIterator<hipcub::STORE_CS, Type>;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value =
+            seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        const size_t unguarded_elements = size;
+        const size_t guarded_elements   = size_t(fraction_valid * double(unguarded_elements));
+
+        // Generate data
+        std::vector<Type> input =
+            test_utils::get_random_data<Type>(unguarded_elements, -100, 100, seed_value);
+        std::vector<Type> unguarded(unguarded_elements, test_utils::convert_to_device<Type>(0));
+        std::vector<Type> guarded(guarded_elements, test_utils::convert_to_device<Type>(0));
+
+        // Preparing device, with room to load from an input that is not aligned to the
+        // vector size
+        Type * device_input;
+        HIP_CHECK(test_common_utils::hipMallocHelper(
+            &device_input,
+            (input.size() + 1) * sizeof(typename decltype(input)::value_type)));
+        Type * device_guarded_elements;
+        HIP_CHECK(test_common_utils::hipMallocHelper(
+            &device_guarded_elements,
+            guarded.size() * sizeof(typename decltype(guarded)::value_type)));
+        Type * device_unguarded_elements;
+        HIP_CHECK(test_common_utils::hipMallocHelper(
+            &device_unguarded_elements,
+            unguarded.size() * sizeof(typename decltype(unguarded)::value_type)));
+
+        for(size_t offset : {0, 1})
+        {
+            SCOPED_TRACE(testing::Message() << "with offset= " << offset);
+
+            HIP_CHECK(hipMemset(device_guarded_elements,
+                                0,
+                                guarded.size() * sizeof(typename decltype(guarded)::value_type)));
+            HIP_CHECK(hipMemset(
+                device_unguarded_elements,
+                0,
+                unguarded.size() * sizeof(typename decltype(unguarded)::value_type)));
+            HIP_CHECK(hipMemcpy(device_input + offset,
+                                input.data(),
+                                input.size() * sizeof(typename decltype(input)::value_type),
+                                hipMemcpyHostToDevice));
+
+            // Running kernel, full tiles of the vectorized algorithms take the cache-modified
+            // vector load path
+            load_store_guarded_kernel<InputIteratorT,
+                                      OutputIteratorT,
+                                      load_method,
+                                      store_method,
+                                      block_size,
+                                      items_per_thread>
+                <<<dim3(grid_size), dim3(block_size)>>>(InputIteratorT(device_input + offset),
+                                                        OutputIteratorT(device_unguarded_elements),
+                                                        OutputIteratorT(device_guarded_elements),
+                                                        guarded_elements);
+
+            // Reading results from device
+            HIP_CHECK(hipMemcpy(unguarded.data(),
+                                device_unguarded_elements,
+                                unguarded.size() * sizeof(typename decltype(unguarded)::value_type),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipMemcpy(guarded.data(),
+                                device_guarded_elements,
+                                guarded.size() * sizeof(typename decltype(guarded)::value_type),
+                                hipMemcpyDeviceToHost));
+
+            // Validating results
+            for(size_t i = 0; i < guarded.size(); i++)
+            {
+                ASSERT_EQ(test_utils::convert_to_native(guarded[i]),
+                          test_utils::convert_to_native(input[i]))
+                    << "where index = " << i;
+            }
+            for(size_t i = 0; i < unguarded.size(); i++)
+            {
+                ASSERT_EQ(test_utils::convert_to_native(unguarded[i]),
+                          test_utils::convert_to_native(input[i]))
+                    << "where index = " << i;
+            }
+        }
+
+        HIP_CHECK(hipFree(device_input));
+        HIP_CHECK(hipFree(device_guarded_elements));
+        HIP_CHECK(hipFree(device_unguarded_elements));
+    }
+}
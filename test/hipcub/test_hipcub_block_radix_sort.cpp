@@ -27,6 +27,8 @@
 #include "hipcub/block/block_load.hpp"
 #include "hipcub/block/block_store.hpp"
 
+#include <cstring>
+
 
 
 template<
@@ -69,6 +71,10 @@ typedef ::testing::Types<
     params<float, int, 37U, 1>,
     params<test_utils::bfloat16, int, 37U, 1>,
     params<test_utils::half, int, 37U, 1>,
+#ifdef HIPCUB_ROCPRIM_API
+    params<hipcub::fp8_e4m3, int, 64U, 3>,
+    params<hipcub::fp8_e5m2, int, 37U, 1, true>,
+#endif
     params<long long, char, 510U, 1, true>,
     params<unsigned int, long long, 162U, 1, false, true>,
     params<unsigned char, float, 255U, 1>,
@@ -237,6 +243,135 @@ TYPED_TEST(HipcubBlockRadixSort, SortKeys)
     }
 }
 
+#ifdef HIPCUB_ROCPRIM_API
+/// Keys with a RadixSortKeyTraits specialization are sorted by their encoded bits.
+TEST(HipcubBlockRadixSortCustomTraits, SortKeys)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type = test_utils::custom_radix_key;
+    constexpr size_t       block_size       = 128;
+    constexpr size_t       items_per_thread = 4;
+    constexpr size_t       items_per_block  = block_size * items_per_thread;
+    constexpr unsigned int end_bit          = hipcub::RadixSortKeyTraits<key_type>::BITS;
+
+    const size_t size      = items_per_block * 113;
+    const size_t grid_size = size / items_per_block;
+
+    for(bool descending : {false, true})
+    {
+        SCOPED_TRACE(testing::Message() << "with descending = " << descending);
+
+        const unsigned int seed_value = rand();
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        std::vector<key_type> keys_output = test_utils::get_random_custom_radix_keys(size, seed_value);
+
+        std::vector<key_type> expected(keys_output);
+        for(size_t i = 0; i < grid_size; i++)
+        {
+            std::stable_sort(expected.begin() + (i * items_per_block),
+                             expected.begin() + ((i + 1) * items_per_block),
+                             [descending](const key_type& lhs, const key_type& rhs)
+                             {
+                                 return descending ? test_utils::custom_radix_key_less()(rhs, lhs)
+                                                   : test_utils::custom_radix_key_less()(lhs, rhs);
+                             });
+        }
+
+        key_type* device_keys_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&device_keys_output, size * sizeof(key_type)));
+        HIP_CHECK(hipMemcpy(device_keys_output,
+                            keys_output.data(),
+                            size * sizeof(key_type),
+                            hipMemcpyHostToDevice));
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(sort_key_kernel<block_size, items_per_thread, key_type>),
+            dim3(grid_size), dim3(block_size), 0, 0,
+            device_keys_output, false, descending, 0, end_bit
+        );
+        HIP_CHECK(hipPeekAtLastError());
+
+        HIP_CHECK(hipMemcpy(keys_output.data(),
+                            device_keys_output,
+                            size * sizeof(key_type),
+                            hipMemcpyDeviceToHost));
+        HIP_CHECK(hipFree(device_keys_output));
+
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected));
+    }
+}
+
+/// RadixSortFloatKey applies its NaN policy inside the block sort as well.
+TEST(HipcubBlockRadixSortCustomTraits, SortKeysNaNLast)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type    = hipcub::RadixSortFloatKey<float, hipcub::RADIX_SORT_NAN_LAST>;
+    using traits_type = hipcub::RadixSortKeyTraits<key_type>;
+    constexpr size_t block_size       = 256;
+    constexpr size_t items_per_thread = 2;
+    constexpr size_t items_per_block  = block_size * items_per_thread;
+
+    const size_t size      = items_per_block * 57;
+    const size_t grid_size = size / items_per_block;
+
+    const unsigned int seed_value = rand();
+    SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+    const std::vector<unsigned int> special_bits
+        = {0x7FC00000u, 0xFFC00001u, 0x80000000u, 0x00000000u, 0x7F800000u, 0xFF800000u};
+    std::vector<float> values = test_utils::get_random_data<float>(size, -10.0f, 10.0f, seed_value);
+    for(size_t i = 0; i < size; i += 3)
+    {
+        std::memcpy(&values[i], &special_bits[(i / 3) % special_bits.size()], sizeof(float));
+    }
+    std::vector<key_type> keys_output(values.begin(), values.end());
+
+    std::vector<key_type> expected(keys_output);
+    for(size_t i = 0; i < grid_size; i++)
+    {
+        std::stable_sort(expected.begin() + (i * items_per_block),
+                         expected.begin() + ((i + 1) * items_per_block),
+                         [](const key_type& lhs, const key_type& rhs)
+                         { return traits_type::TwiddleIn(lhs) < traits_type::TwiddleIn(rhs); });
+        // Negative NaNs are sorted after +inf as well
+        ASSERT_TRUE(std::isnan(expected[(i + 1) * items_per_block - 1].value));
+    }
+
+    key_type* device_keys_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&device_keys_output, size * sizeof(key_type)));
+    HIP_CHECK(hipMemcpy(device_keys_output,
+                        keys_output.data(),
+                        size * sizeof(key_type),
+                        hipMemcpyHostToDevice));
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(sort_key_kernel<block_size, items_per_thread, key_type>),
+        dim3(grid_size), dim3(block_size), 0, 0,
+        device_keys_output, false, false, 0, sizeof(float) * 8
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    HIP_CHECK(hipMemcpy(keys_output.data(),
+                        device_keys_output,
+                        size * sizeof(key_type),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(device_keys_output));
+
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(std::memcmp(&keys_output[i], &expected[i], sizeof(key_type)), 0)
+            << "at index " << i;
+    }
+}
+#endif // HIPCUB_ROCPRIM_API
+
 template<
     unsigned int BlockSize,
     unsigned int ItemsPerThread,
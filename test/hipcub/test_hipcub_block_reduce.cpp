@@ -357,9 +357,11 @@ typedef ::testing::Types<
     params<float, 65, 5>,
     params<float, 162, 7>,
     params<float, 255, 15>,
-    // half and bfloat require small block sizes due to the very limited accuracy
+    // half and bfloat16 items are summed in float within each thread
     params<test_utils::half, 32, 4>,
+    params<test_utils::half, 32, 12>,
     params<test_utils::bfloat16, 32, 4>,
+    params<test_utils::bfloat16, 256, 8>,
     // -----------------------------------------------------------------------
     // hipcub::BlockReduceAlgorithm::BLOCK_REDUCE_RAKING
     // -----------------------------------------------------------------------
@@ -372,9 +374,11 @@ typedef ::testing::Types<
     params<float, 65, 5, hipcub::BlockReduceAlgorithm::BLOCK_REDUCE_RAKING>,
     params<float, 162, 7, hipcub::BlockReduceAlgorithm::BLOCK_REDUCE_RAKING>,
     params<float, 255, 15, hipcub::BlockReduceAlgorithm::BLOCK_REDUCE_RAKING>,
-    // half and bfloat require small block sizes due to the very limited accuracy
+    // half and bfloat16 items are summed in float within each thread
     params<test_utils::half, 32, 4, hipcub::BlockReduceAlgorithm::BLOCK_REDUCE_RAKING>,
-    params<test_utils::bfloat16, 32, 4, hipcub::BlockReduceAlgorithm::BLOCK_REDUCE_RAKING>>
+    params<test_utils::half, 32, 12, hipcub::BlockReduceAlgorithm::BLOCK_REDUCE_RAKING>,
+    params<test_utils::bfloat16, 32, 4, hipcub::BlockReduceAlgorithm::BLOCK_REDUCE_RAKING>,
+    params<test_utils::bfloat16, 256, 8, hipcub::BlockReduceAlgorithm::BLOCK_REDUCE_RAKING>>
     InputArrayTestParams;
 
 TYPED_TEST_SUITE(HipcubBlockReduceInputArrayTests, InputArrayTestParams);
@@ -450,11 +454,12 @@ TYPED_TEST(HipcubBlockReduceInputArrayTests, Reduce)
                                            test_utils::convert_to_device<T>(0));
         for(size_t i = 0; i < output.size() / items_per_block; i++)
         {
-            test_utils::convert_to_native_t<T> value = 0;
+            // 16-bit floats are checked against a float reference
+            test_utils::convert_to_fundamental_t<T> value = 0;
             for(size_t j = 0; j < items_per_block; j++)
             {
                 auto idx = i * items_per_block + j;
-                value += output[idx];
+                value += test_utils::convert_to_fundamental(output[idx]);
             }
             expected_reductions[i] = test_utils::convert_to_device<T>(value);
         }
@@ -510,3 +515,103 @@ TYPED_TEST(HipcubBlockReduceInputArrayTests, Reduce)
         HIP_CHECK(hipFree(device_output_reductions));
     }
 }
+
+#ifdef HIPCUB_ROCPRIM_API
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+__global__
+__launch_bounds__(BlockSize)
+void reduce_kahan_kernel(float* device_input, float* device_output_reductions)
+{
+    const unsigned int index = ((hipBlockIdx_x * BlockSize) + hipThreadIdx_x) * ItemsPerThread;
+
+    hipcub::KahanPair<float> partial = device_input[index];
+    for(unsigned int j = 1; j < ItemsPerThread; j++)
+    {
+        partial = hipcub::KahanSum()(partial, device_input[index + j]);
+    }
+
+    using breduce_t = hipcub::BlockReduce<hipcub::KahanPair<float>, BlockSize>;
+    __shared__ typename breduce_t::TempStorage temp_storage;
+    const hipcub::KahanPair<float> reduction
+        = breduce_t(temp_storage).Reduce(partial, hipcub::KahanSum());
+
+    if(hipThreadIdx_x == 0)
+    {
+        device_output_reductions[hipBlockIdx_x] = static_cast<float>(reduction);
+    }
+}
+
+TEST(HipcubBlockReduceKahanSumTests, Reduce)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    constexpr unsigned int block_size       = 256;
+    constexpr unsigned int items_per_thread = 16;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+    constexpr unsigned int grid_size        = 37;
+    constexpr unsigned int size             = items_per_block * grid_size;
+
+    // Given block size not supported
+    if(block_size > test_utils::get_max_block_size())
+    {
+        return;
+    }
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        std::vector<float> input = test_utils::get_random_data<float>(size, 0.0f, 1.0f, seed_value);
+        std::vector<float> output_reductions(grid_size);
+
+        // Calculate expected results on host, in double
+        std::vector<double> expected_reductions(grid_size);
+        for(size_t i = 0; i < grid_size; i++)
+        {
+            expected_reductions[i] = std::accumulate(input.begin() + i * items_per_block,
+                                                     input.begin() + (i + 1) * items_per_block,
+                                                     0.0);
+        }
+
+        float* device_input;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&device_input, input.size() * sizeof(float)));
+        float* device_output_reductions;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&device_output_reductions,
+                                                     output_reductions.size() * sizeof(float)));
+
+        HIP_CHECK(hipMemcpy(device_input,
+                            input.data(),
+                            input.size() * sizeof(float),
+                            hipMemcpyHostToDevice));
+
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(reduce_kahan_kernel<block_size, items_per_thread>),
+                           dim3(grid_size),
+                           dim3(block_size),
+                           0,
+                           0,
+                           device_input,
+                           device_output_reductions);
+        HIP_CHECK(hipPeekAtLastError());
+
+        HIP_CHECK(hipMemcpy(output_reductions.data(),
+                            device_output_reductions,
+                            output_reductions.size() * sizeof(float),
+                            hipMemcpyDeviceToHost));
+
+        // The compensated block sum is within an ulp of the exact sum
+        for(size_t i = 0; i < output_reductions.size(); i++)
+        {
+            ASSERT_NEAR(output_reductions[i],
+                        expected_reductions[i],
+                        expected_reductions[i] * std::numeric_limits<float>::epsilon())
+                << "where index = " << i;
+        }
+
+        HIP_CHECK(hipFree(device_input));
+        HIP_CHECK(hipFree(device_output_reductions));
+    }
+}
+#endif // HIPCUB_ROCPRIM_API
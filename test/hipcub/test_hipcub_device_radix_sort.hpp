@@ -30,6 +30,8 @@
 
 #include "test_utils_sort_comparator.hpp"
 
+#include <cstring>
+
 template<
     class Key,
     class Value,
@@ -85,6 +87,7 @@ inline void sort_keys()
     for(unsigned int size : sizes)
     {
         if(size > (1 << 20) && !check_large_sizes) continue;
+        if(!test_common_utils::size_class_enabled(size)) continue;
 
         for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
         {
@@ -115,8 +118,16 @@ inline void sort_keys()
             );
 
             // Calculate expected results on host
-            std::vector<key_type> expected(keys_input);
-            std::stable_sort(expected.begin(), expected.end(), test_utils::key_comparator<key_type, descending, start_bit, end_bit>());
+            test_utils::host_buffer<key_type> expected;
+            test_utils::host_reference(
+                test_utils::make_host_reference_key(seed_value, keys_input),
+                [&]
+                {
+                    expected = test_utils::make_host_buffer(keys_input);
+                    test_utils::host_stable_sort(expected.begin(), expected.end(), test_utils::key_comparator<key_type, descending, start_bit, end_bit>());
+                },
+                expected
+            );
 
             size_t temporary_storage_bytes = 0;
             HIP_CHECK(
@@ -158,7 +169,7 @@ inline void sort_keys()
             HIP_CHECK(hipFree(d_temporary_storage));
             HIP_CHECK(hipFree(d_keys_input));
 
-            std::vector<key_type> keys_output(size);
+            test_utils::host_buffer<key_type> keys_output = test_utils::make_host_buffer<key_type>(size);
             HIP_CHECK(
                 hipMemcpy(
                     keys_output.data(), d_keys_output,
@@ -196,6 +207,7 @@ inline void sort_pairs()
     for(unsigned int size : sizes)
     {
         if(size > (1 << 20) && !check_large_sizes) continue;
+        if(!test_common_utils::size_class_enabled(size)) continue;
 
         for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
         {
@@ -242,14 +254,37 @@ inline void sort_pairs()
             using key_value = std::pair<key_type, value_type>;
 
             // Calculate expected results on host
-            std::vector<key_value> expected(size);
-            for(size_t i = 0; i < size; i++)
-            {
-                expected[i] = key_value(keys_input[i], values_input[i]);
-            }
-            std::stable_sort(
-                expected.begin(), expected.end(),
-                test_utils::key_value_comparator<key_type, value_type, descending, start_bit, end_bit>()
+            test_utils::host_buffer<key_type> keys_expected;
+            test_utils::host_buffer<value_type> values_expected;
+            test_utils::host_reference(
+                test_utils::make_host_reference_key(seed_value, keys_input, values_input),
+                [&]
+                {
+                    test_utils::host_buffer<key_value> expected(size);
+                    test_utils::parallel_for_chunks(size, [&](size_t begin, size_t end)
+                    {
+                        for(size_t i = begin; i < end; i++)
+                        {
+                            expected[i] = key_value(keys_input[i], values_input[i]);
+                        }
+                    });
+                    test_utils::host_stable_sort(
+                        expected.begin(), expected.end(),
+                        test_utils::key_value_comparator<key_type, value_type, descending, start_bit, end_bit>()
+                    );
+
+                    keys_expected = test_utils::host_buffer<key_type>(size);
+                    values_expected = test_utils::host_buffer<value_type>(size);
+                    test_utils::parallel_for_chunks(size, [&](size_t begin, size_t end)
+                    {
+                        for(size_t i = begin; i < end; i++)
+                        {
+                            keys_expected[i] = expected[i].first;
+                            values_expected[i] = expected[i].second;
+                        }
+                    });
+                },
+                keys_expected, values_expected
             );
 
             void * d_temporary_storage = nullptr;
@@ -293,7 +328,7 @@ inline void sort_pairs()
             HIP_CHECK(hipFree(d_keys_input));
             HIP_CHECK(hipFree(d_values_input));
 
-            std::vector<key_type> keys_output(size);
+            test_utils::host_buffer<key_type> keys_output = test_utils::make_host_buffer<key_type>(size);
             HIP_CHECK(
                 hipMemcpy(
                     keys_output.data(), d_keys_output,
@@ -302,7 +337,7 @@ inline void sort_pairs()
                 )
             );
 
-            std::vector<value_type> values_output(size);
+            test_utils::host_buffer<value_type> values_output = test_utils::make_host_buffer<value_type>(size);
             HIP_CHECK(
                 hipMemcpy(
                     values_output.data(), d_values_output,
@@ -314,14 +349,6 @@ inline void sort_pairs()
             HIP_CHECK(hipFree(d_keys_output));
             HIP_CHECK(hipFree(d_values_output));
 
-            std::vector<key_type> keys_expected(size);
-            std::vector<value_type> values_expected(size);
-            for(size_t i = 0; i < size; i++)
-            {
-                keys_expected[i] = expected[i].first;
-                values_expected[i] = expected[i].second;
-            }
-
             ASSERT_NO_FATAL_FAILURE(test_utils::assert_bit_eq(keys_output, keys_expected));
             ASSERT_NO_FATAL_FAILURE(test_utils::assert_bit_eq(values_output, values_expected));
         }
@@ -349,6 +376,7 @@ inline void sort_keys_double_buffer()
     for(unsigned int size : sizes)
     {
         if(size > (1 << 20) && !check_large_sizes) continue;
+        if(!test_common_utils::size_class_enabled(size)) continue;
 
         for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
         {
@@ -378,8 +406,16 @@ inline void sort_keys_double_buffer()
             );
 
             // Calculate expected results on host
-            std::vector<key_type> expected(keys_input);
-            std::stable_sort(expected.begin(), expected.end(), test_utils::key_comparator<key_type, descending, start_bit, end_bit>());
+            test_utils::host_buffer<key_type> expected;
+            test_utils::host_reference(
+                test_utils::make_host_reference_key(seed_value, keys_input),
+                [&]
+                {
+                    expected = test_utils::make_host_buffer(keys_input);
+                    test_utils::host_stable_sort(expected.begin(), expected.end(), test_utils::key_comparator<key_type, descending, start_bit, end_bit>());
+                },
+                expected
+            );
 
             hipcub::DoubleBuffer<key_type> d_keys(d_keys_input, d_keys_output);
 
@@ -422,7 +458,7 @@ inline void sort_keys_double_buffer()
 
             HIP_CHECK(hipFree(d_temporary_storage));
 
-            std::vector<key_type> keys_output(size);
+            test_utils::host_buffer<key_type> keys_output = test_utils::make_host_buffer<key_type>(size);
             HIP_CHECK(
                 hipMemcpy(
                     keys_output.data(), d_keys.Current(),
@@ -461,6 +497,7 @@ inline void sort_pairs_double_buffer()
     for(unsigned int size : sizes)
     {
         if(size > (1 << 20) && !check_large_sizes) continue;
+        if(!test_common_utils::size_class_enabled(size)) continue;
 
         for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
         {
@@ -507,14 +544,37 @@ inline void sort_pairs_double_buffer()
             using key_value = std::pair<key_type, value_type>;
 
             // Calculate expected results on host
-            std::vector<key_value> expected(size);
-            for(size_t i = 0; i < size; i++)
-            {
-                expected[i] = key_value(keys_input[i], values_input[i]);
-            }
-            std::stable_sort(
-                expected.begin(), expected.end(),
-                test_utils::key_value_comparator<key_type, value_type, descending, start_bit, end_bit>()
+            test_utils::host_buffer<key_type> keys_expected;
+            test_utils::host_buffer<value_type> values_expected;
+            test_utils::host_reference(
+                test_utils::make_host_reference_key(seed_value, keys_input, values_input),
+                [&]
+                {
+                    test_utils::host_buffer<key_value> expected(size);
+                    test_utils::parallel_for_chunks(size, [&](size_t begin, size_t end)
+                    {
+                        for(size_t i = begin; i < end; i++)
+                        {
+                            expected[i] = key_value(keys_input[i], values_input[i]);
+                        }
+                    });
+                    test_utils::host_stable_sort(
+                        expected.begin(), expected.end(),
+                        test_utils::key_value_comparator<key_type, value_type, descending, start_bit, end_bit>()
+                    );
+
+                    keys_expected = test_utils::host_buffer<key_type>(size);
+                    values_expected = test_utils::host_buffer<value_type>(size);
+                    test_utils::parallel_for_chunks(size, [&](size_t begin, size_t end)
+                    {
+                        for(size_t i = begin; i < end; i++)
+                        {
+                            keys_expected[i] = expected[i].first;
+                            values_expected[i] = expected[i].second;
+                        }
+                    });
+                },
+                keys_expected, values_expected
             );
 
             hipcub::DoubleBuffer<key_type> d_keys(d_keys_input, d_keys_output);
@@ -559,7 +619,7 @@ inline void sort_pairs_double_buffer()
 
             HIP_CHECK(hipFree(d_temporary_storage));
 
-            std::vector<key_type> keys_output(size);
+            test_utils::host_buffer<key_type> keys_output = test_utils::make_host_buffer<key_type>(size);
             HIP_CHECK(
                 hipMemcpy(
                     keys_output.data(), d_keys.Current(),
@@ -568,7 +628,7 @@ inline void sort_pairs_double_buffer()
                 )
             );
 
-            std::vector<value_type> values_output(size);
+            test_utils::host_buffer<value_type> values_output = test_utils::make_host_buffer<value_type>(size);
             HIP_CHECK(
                 hipMemcpy(
                     values_output.data(), d_values.Current(),
@@ -582,14 +642,6 @@ inline void sort_pairs_double_buffer()
             HIP_CHECK(hipFree(d_values_input));
             HIP_CHECK(hipFree(d_values_output));
 
-            std::vector<key_type> keys_expected(size);
-            std::vector<value_type> values_expected(size);
-            for(size_t i = 0; i < size; i++)
-            {
-                keys_expected[i] = expected[i].first;
-                values_expected[i] = expected[i].second;
-            }
-
             ASSERT_NO_FATAL_FAILURE(test_utils::assert_bit_eq(keys_output, keys_expected));
             ASSERT_NO_FATAL_FAILURE(test_utils::assert_bit_eq(values_output, values_expected));
         }
@@ -611,6 +663,11 @@ inline void sort_keys_over_4g()
     constexpr size_t number_of_possible_keys = 1ull << (8ull * sizeof(key_type));
     assert(std::is_unsigned<key_type>::value);
 
+    if(!test_common_utils::size_class_enabled(size))
+    {
+        GTEST_SKIP() << "size class not tested by this shard";
+    }
+
     hipDeviceProp_t dev_prop;
     HIP_CHECK(hipGetDeviceProperties(&dev_prop, device_id));
     
@@ -681,4 +738,362 @@ inline void sort_keys_over_4g()
     HIP_CHECK(hipFree(d_temporary_storage));
 }
 
+#ifdef HIPCUB_ROCPRIM_API
+inline void sort_keys_custom_traits()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type = test_utils::custom_radix_key;
+    constexpr hipStream_t stream = 0;
+
+    const std::vector<unsigned int> sizes = get_sizes();
+    for(unsigned int size : sizes)
+    {
+        if(size > (1 << 20)) continue;
+        if(!test_common_utils::size_class_enabled(size)) continue;
+
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+        for(bool descending : {false, true})
+        {
+            SCOPED_TRACE(testing::Message() << "with descending = " << descending);
+
+            const int seed_value = rand();
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+            std::vector<key_type> keys_input
+                = test_utils::get_random_custom_radix_keys(size, seed_value);
+
+            std::vector<key_type> expected(keys_input);
+            if(descending)
+            {
+                std::stable_sort(expected.begin(),
+                                 expected.end(),
+                                 [](const key_type& lhs, const key_type& rhs)
+                                 { return test_utils::custom_radix_key_less()(rhs, lhs); });
+            }
+            else
+            {
+                std::stable_sort(expected.begin(),
+                                 expected.end(),
+                                 test_utils::custom_radix_key_less());
+            }
+
+            key_type* d_keys_input;
+            key_type* d_keys_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+
+            // Both fields are 32 bits wide, so all bits of the key are used
+            constexpr int end_bit = hipcub::RadixSortKeyTraits<key_type>::BITS;
+
+            auto sort = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+            {
+                return descending
+                    ? hipcub::DeviceRadixSort::SortKeysDescending(d_temporary_storage,
+                                                                  temporary_storage_bytes,
+                                                                  d_keys_input,
+                                                                  d_keys_output,
+                                                                  size,
+                                                                  0,
+                                                                  end_bit,
+                                                                  stream)
+                    : hipcub::DeviceRadixSort::SortKeys(d_temporary_storage,
+                                                        temporary_storage_bytes,
+                                                        d_keys_input,
+                                                        d_keys_output,
+                                                        size,
+                                                        0,
+                                                        end_bit,
+                                                        stream);
+            };
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(sort(nullptr, temporary_storage_bytes));
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(sort(d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(hipPeekAtLastError());
+
+            std::vector<key_type> keys_output(size);
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output,
+                                size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_temporary_storage));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected));
+        }
+    }
+}
+
+template<hipcub::RadixSortNaNPolicy NaNPolicy, hipcub::RadixSortSignedZeroPolicy ZeroPolicy>
+inline void sort_keys_float_policy()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type    = hipcub::RadixSortFloatKey<float, NaNPolicy, ZeroPolicy>;
+    using traits_type = hipcub::RadixSortKeyTraits<key_type>;
+    constexpr hipStream_t stream = 0;
+
+    const std::vector<unsigned int> sizes = get_sizes();
+    for(unsigned int size : sizes)
+    {
+        if(size > (1 << 20)) continue;
+        if(!test_common_utils::size_class_enabled(size)) continue;
+
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+        for(bool descending : {false, true})
+        {
+            SCOPED_TRACE(testing::Message() << "with descending = " << descending);
+
+            const int seed_value = rand();
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+            // Mix in NaNs of both signs with different payloads, signed zeros and infinities
+            const std::vector<unsigned int> special_bits
+                = {0x7FC00000u, 0x7F800001u, 0xFFC00000u, 0xFFFFFFFFu,
+                   0x80000000u, 0x00000000u, 0x7F800000u, 0xFF800000u};
+            std::vector<float> values = test_utils::get_random_data<float>(size, -100.0f, 100.0f, seed_value);
+            const std::vector<unsigned int> special_indices
+                = test_utils::get_random_data<unsigned int>(size, 0, 2 * special_bits.size(), seed_value + 1);
+            for(size_t i = 0; i < size; i++)
+            {
+                if(special_indices[i] < special_bits.size())
+                {
+                    std::memcpy(&values[i], &special_bits[special_indices[i]], sizeof(float));
+                }
+            }
+            const std::vector<key_type> keys_input(values.begin(), values.end());
+
+            // The order of the encoded keys, and the keys as they are written
+            std::vector<key_type> expected(keys_input);
+            std::stable_sort(expected.begin(),
+                             expected.end(),
+                             [descending](const key_type& lhs, const key_type& rhs)
+                             {
+                                 return descending
+                                            ? traits_type::TwiddleIn(rhs) < traits_type::TwiddleIn(lhs)
+                                            : traits_type::TwiddleIn(lhs) < traits_type::TwiddleIn(rhs);
+                             });
+            for(key_type& key : expected)
+            {
+                key = traits_type::TwiddleOut(traits_type::TwiddleIn(key));
+            }
+
+            key_type* d_keys_input;
+            key_type* d_keys_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+
+            auto sort = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+            {
+                return descending
+                    ? hipcub::DeviceRadixSort::SortKeysDescending(d_temporary_storage,
+                                                                  temporary_storage_bytes,
+                                                                  d_keys_input,
+                                                                  d_keys_output,
+                                                                  size,
+                                                                  0,
+                                                                  sizeof(float) * 8,
+                                                                  stream)
+                    : hipcub::DeviceRadixSort::SortKeys(d_temporary_storage,
+                                                        temporary_storage_bytes,
+                                                        d_keys_input,
+                                                        d_keys_output,
+                                                        size,
+                                                        0,
+                                                        sizeof(float) * 8,
+                                                        stream);
+            };
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(sort(nullptr, temporary_storage_bytes));
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(sort(d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(hipPeekAtLastError());
+
+            std::vector<key_type> keys_output(size);
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output,
+                                size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_temporary_storage));
+
+            // NaNs do not compare equal, so the keys are compared bitwise
+            for(size_t i = 0; i < size; i++)
+            {
+                ASSERT_EQ(std::memcmp(&keys_output[i], &expected[i], sizeof(key_type)), 0)
+                    << "at index " << i << ": " << keys_output[i].value
+                    << " != " << expected[i].value;
+            }
+
+            // The NaN policy places all NaNs at one end of the ascending order
+            if(NaNPolicy != hipcub::RADIX_SORT_NAN_TOTAL_ORDER)
+            {
+                const bool nans_first = (NaNPolicy == hipcub::RADIX_SORT_NAN_FIRST) != descending;
+                const auto is_nan     = [](const key_type& key) { return std::isnan(key.value); };
+                ASSERT_TRUE(nans_first
+                                ? std::is_partitioned(keys_output.begin(), keys_output.end(), is_nan)
+                                : std::is_partitioned(keys_output.rbegin(), keys_output.rend(), is_nan));
+            }
+        }
+    }
+}
+
+/// DeviceRadixSortWithConfig with a non-default configuration must produce the same result
+/// as DeviceRadixSort.
+inline void sort_pairs_with_config()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type   = unsigned int;
+    using value_type = int;
+    using config     = rocprim::radix_sort_config_v2<
+        rocprim::default_config,
+        rocprim::default_config,
+        rocprim::radix_sort_onesweep_config<rocprim::kernel_config<256, 12>,
+                                            rocprim::kernel_config<128, 8>,
+                                            4>>;
+    using config_sort = hipcub::DeviceRadixSortWithConfig<config>;
+    constexpr hipStream_t stream = 0;
+
+    const std::vector<unsigned int> sizes = get_sizes();
+    for(unsigned int size : sizes)
+    {
+        if(size > (1 << 20)) continue;
+        if(!test_common_utils::size_class_enabled(size)) continue;
+
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+        const int seed_value = rand();
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        const std::vector<key_type> keys_input
+            = test_utils::get_random_data<key_type>(size, 0, 1000, seed_value);
+        std::vector<value_type> values_input(size);
+        std::iota(values_input.begin(), values_input.end(), 0);
+
+        key_type*   d_keys_input;
+        key_type*   d_keys_output;
+        value_type* d_values_input;
+        value_type* d_values_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, 2 * size * sizeof(key_type)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input, size * sizeof(value_type)));
+        HIP_CHECK(
+            test_common_utils::hipMallocHelper(&d_values_output, 2 * size * sizeof(value_type)));
+        HIP_CHECK(hipMemcpy(d_keys_input,
+                            keys_input.data(),
+                            size * sizeof(key_type),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_values_input,
+                            values_input.data(),
+                            size * sizeof(value_type),
+                            hipMemcpyHostToDevice));
+
+        // The default configuration writes the first half of the outputs, config the second
+        size_t default_temporary_storage_bytes;
+        HIP_CHECK(hipcub::DeviceRadixSort::SortPairs(nullptr,
+                                                     default_temporary_storage_bytes,
+                                                     d_keys_input,
+                                                     d_keys_output,
+                                                     d_values_input,
+                                                     d_values_output,
+                                                     size,
+                                                     0,
+                                                     sizeof(key_type) * 8,
+                                                     stream));
+        size_t config_temporary_storage_bytes;
+        HIP_CHECK(config_sort::SortPairs(nullptr,
+                                         config_temporary_storage_bytes,
+                                         d_keys_input,
+                                         d_keys_output + size,
+                                         d_values_input,
+                                         d_values_output + size,
+                                         size,
+                                         0,
+                                         sizeof(key_type) * 8,
+                                         stream));
+        size_t temporary_storage_bytes
+            = std::max(default_temporary_storage_bytes, config_temporary_storage_bytes);
+        void* d_temporary_storage;
+        HIP_CHECK(
+            test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+        HIP_CHECK(hipcub::DeviceRadixSort::SortPairs(d_temporary_storage,
+                                                     temporary_storage_bytes,
+                                                     d_keys_input,
+                                                     d_keys_output,
+                                                     d_values_input,
+                                                     d_values_output,
+                                                     size,
+                                                     0,
+                                                     sizeof(key_type) * 8,
+                                                     stream));
+        HIP_CHECK(config_sort::SortPairs(d_temporary_storage,
+                                         temporary_storage_bytes,
+                                         d_keys_input,
+                                         d_keys_output + size,
+                                         d_values_input,
+                                         d_values_output + size,
+                                         size,
+                                         0,
+                                         sizeof(key_type) * 8,
+                                         stream));
+        HIP_CHECK(hipPeekAtLastError());
+
+        std::vector<key_type>   keys_output(2 * size);
+        std::vector<value_type> values_output(2 * size);
+        HIP_CHECK(hipMemcpy(keys_output.data(),
+                            d_keys_output,
+                            2 * size * sizeof(key_type),
+                            hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(values_output.data(),
+                            d_values_output,
+                            2 * size * sizeof(value_type),
+                            hipMemcpyDeviceToHost));
+
+        HIP_CHECK(hipFree(d_keys_input));
+        HIP_CHECK(hipFree(d_keys_output));
+        HIP_CHECK(hipFree(d_values_input));
+        HIP_CHECK(hipFree(d_values_output));
+        HIP_CHECK(hipFree(d_temporary_storage));
+
+        // Radix sort is stable, so the values must match as well
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_EQ(keys_output[size + i], keys_output[i]) << "at index " << i;
+            ASSERT_EQ(values_output[size + i], values_output[i]) << "at index " << i;
+        }
+    }
+}
+#endif // HIPCUB_ROCPRIM_API
+
 #endif // HIPCUB_TEST_HIPCUB_DEVICE_RADIX_SORT_HPP_
@@ -58,6 +58,11 @@ typedef ::testing::Types<
     DeviceReduceParams<float>,
     DeviceReduceParams<short, float>,
     DeviceReduceParams<int, double>
+#ifdef HIPCUB_IS_INT128_ENABLED
+    ,
+    DeviceReduceParams<__int128_t>,
+    DeviceReduceParams<int, __uint128_t>
+#endif
 #ifdef __HIP_PLATFORM_AMD__
     ,
     DeviceReduceParams<test_utils::half, float>, // Doesn't compile in CUB 2.0.1
@@ -70,7 +75,9 @@ typedef ::testing::Types<
 #ifdef HIPCUB_ROCPRIM_API
     ,
     DeviceReduceParams<test_utils::custom_test_type<float>, test_utils::custom_test_type<float>>,
-    DeviceReduceParams<test_utils::custom_test_type<int>, test_utils::custom_test_type<float>>
+    DeviceReduceParams<test_utils::custom_test_type<int>, test_utils::custom_test_type<float>>,
+    DeviceReduceParams<hipcub::fp8_e4m3, float>,
+    DeviceReduceParams<hipcub::fp8_e5m2, float>
 #endif
     >
     HipcubDeviceReduceTestsParams;
@@ -444,6 +451,144 @@ TYPED_TEST(HipcubDeviceReduceTests, ReduceArgMaximum)
     test_argminmax<TestFixture, ArgMaxDispatch, HostOp>(test_utils::numeric_limits<T>::lowest());
 }
 
+#ifdef HIPCUB_ROCPRIM_API
+struct ArgMinPackedDispatch
+{
+    template<typename InputIteratorT, typename OutputIteratorT>
+    auto operator()(void*           d_temp_storage,
+                    size_t&         temp_storage_bytes,
+                    InputIteratorT  d_in,
+                    OutputIteratorT d_out,
+                    int             num_items,
+                    hipStream_t     stream,
+                    bool            debug_synchronous) const
+    {
+        return hipcub::DeviceReduce::ArgMinPacked(d_temp_storage,
+                                                  temp_storage_bytes,
+                                                  d_in,
+                                                  d_out,
+                                                  num_items,
+                                                  stream,
+                                                  debug_synchronous);
+    }
+};
+
+struct ArgMaxPackedDispatch
+{
+    template<typename InputIteratorT, typename OutputIteratorT>
+    auto operator()(void*           d_temp_storage,
+                    size_t&         temp_storage_bytes,
+                    InputIteratorT  d_in,
+                    OutputIteratorT d_out,
+                    int             num_items,
+                    hipStream_t     stream,
+                    bool            debug_synchronous) const
+    {
+        return hipcub::DeviceReduce::ArgMaxPacked(d_temp_storage,
+                                                  temp_storage_bytes,
+                                                  d_in,
+                                                  d_out,
+                                                  num_items,
+                                                  stream,
+                                                  debug_synchronous);
+    }
+};
+
+// The packed variants only take values of at most 32 bits
+template<class Params>
+class HipcubDeviceReduceArgMinMaxPackedTests : public HipcubDeviceReduceTests<Params>
+{};
+
+typedef ::testing::Types<DeviceReduceParams<int>,
+                         DeviceReduceParams<unsigned int>,
+                         DeviceReduceParams<short>,
+                         DeviceReduceParams<float>,
+                         DeviceReduceParams<test_utils::half>,
+                         DeviceReduceParams<test_utils::bfloat16>>
+    HipcubDeviceReduceArgMinMaxPackedTestsParams;
+
+TYPED_TEST_SUITE(HipcubDeviceReduceArgMinMaxPackedTests,
+                 HipcubDeviceReduceArgMinMaxPackedTestsParams);
+
+TYPED_TEST(HipcubDeviceReduceArgMinMaxPackedTests, ReduceArgMinimumPacked)
+{
+    using T      = typename TestFixture::input_type;
+    using HostOp = typename ArgMinSelector<T>::type;
+    test_argminmax<TestFixture, ArgMinPackedDispatch, HostOp>(
+        test_utils::numeric_limits<T>::max());
+}
+
+TYPED_TEST(HipcubDeviceReduceArgMinMaxPackedTests, ReduceArgMaximumPacked)
+{
+    using T      = typename TestFixture::input_type;
+    using HostOp = typename ArgMaxSelector<T>::type;
+    test_argminmax<TestFixture, ArgMaxPackedDispatch, HostOp>(
+        test_utils::numeric_limits<T>::lowest());
+}
+
+/// Signed zeros compare equal, so the packed encoding must let them tie and pick the lowest
+/// index, as ArgMin and ArgMax do.
+TEST(HipcubDeviceReduceArgMinMaxPackedSignedZeroTests, ReduceArgMinMaxPackedSignedZero)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_value = hipcub::KeyValuePair<int, float>;
+
+    const std::vector<float> input = {1.0f, 0.0f, -0.0f, 2.0f, 0.0f, 2.0f, -0.0f, 1.0f};
+
+    float*     d_input;
+    key_value* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(float)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, 2 * sizeof(key_value)));
+    HIP_CHECK(
+        hipMemcpy(d_input, input.data(), input.size() * sizeof(float), hipMemcpyHostToDevice));
+
+    size_t min_temp_storage_bytes;
+    HIP_CHECK(hipcub::DeviceReduce::ArgMinPacked(nullptr,
+                                                 min_temp_storage_bytes,
+                                                 d_input,
+                                                 d_output,
+                                                 input.size()));
+    size_t max_temp_storage_bytes;
+    HIP_CHECK(hipcub::DeviceReduce::ArgMaxPacked(nullptr,
+                                                 max_temp_storage_bytes,
+                                                 d_input,
+                                                 d_output + 1,
+                                                 input.size()));
+
+    size_t temp_storage_bytes = std::max(min_temp_storage_bytes, max_temp_storage_bytes);
+    void*  d_temp_storage     = nullptr;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_bytes));
+
+    HIP_CHECK(hipcub::DeviceReduce::ArgMinPacked(d_temp_storage,
+                                                 temp_storage_bytes,
+                                                 d_input,
+                                                 d_output,
+                                                 input.size()));
+    HIP_CHECK(hipcub::DeviceReduce::ArgMaxPacked(d_temp_storage,
+                                                 temp_storage_bytes,
+                                                 d_input,
+                                                 d_output + 1,
+                                                 input.size()));
+    HIP_CHECK(hipPeekAtLastError());
+
+    key_value output[2];
+    HIP_CHECK(hipMemcpy(output, d_output, 2 * sizeof(key_value), hipMemcpyDeviceToHost));
+
+    ASSERT_EQ(output[0].key, 1);
+    ASSERT_EQ(output[0].value, 0.0f);
+    ASSERT_FALSE(std::signbit(output[0].value));
+    ASSERT_EQ(output[1].key, 3);
+    ASSERT_EQ(output[1].value, 2.0f);
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_temp_storage));
+}
+#endif // HIPCUB_ROCPRIM_API
+
 template<class T>
 class HipcubDeviceReduceArgMinMaxSpecialTests : public testing::Test
 {};
@@ -548,3 +693,226 @@ TYPED_TEST(HipcubDeviceReduceArgMinMaxSpecialTests, ReduceArgMaxInf)
         test_utils::numeric_limits<TypeParam>::lowest());
 }
 #endif // __HIP_PLATFORM_AMD__
+
+#ifdef HIPCUB_ROCPRIM_API
+/// DeviceReduceWithConfig with a non-default configuration must produce the same
+/// result as DeviceReduce.
+TEST(HipcubDeviceReduceWithConfigTests, ReduceSumWithConfig)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T      = int;
+    using config = rocprim::reduce_config<128, 4, rocprim::block_reduce_algorithm::default_algorithm>;
+
+    const std::vector<size_t> sizes = get_sizes();
+    for(auto size : sizes)
+    {
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+        const unsigned int seed_value = seeds[0];
+        std::vector<T>     input      = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+        std::vector<T>     output(1, 0);
+
+        T* d_input;
+        T* d_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(T)));
+        HIP_CHECK(
+            hipMemcpy(d_input, input.data(), input.size() * sizeof(T), hipMemcpyHostToDevice));
+
+        const T expected = std::accumulate(input.begin(), input.end(), T(0));
+
+        size_t temp_storage_size_bytes;
+        void*  d_temp_storage = nullptr;
+        HIP_CHECK(hipcub::DeviceReduceWithConfig<config>::Sum(d_temp_storage,
+                                                              temp_storage_size_bytes,
+                                                              d_input,
+                                                              d_output,
+                                                              input.size()));
+        ASSERT_GT(temp_storage_size_bytes, 0U);
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+        HIP_CHECK(hipcub::DeviceReduceWithConfig<config>::Sum(d_temp_storage,
+                                                              temp_storage_size_bytes,
+                                                              d_input,
+                                                              d_output,
+                                                              input.size()));
+        HIP_CHECK(hipPeekAtLastError());
+        HIP_CHECK(hipMemcpy(output.data(), d_output, sizeof(T), hipMemcpyDeviceToHost));
+
+        ASSERT_EQ(output[0], expected);
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_output));
+        HIP_CHECK(hipFree(d_temp_storage));
+    }
+}
+#endif // HIPCUB_ROCPRIM_API
+
+#ifdef HIPCUB_ROCPRIM_API
+/// Reduce with KahanSum keeps float input and output but accumulates (sum, compensation)
+/// pairs, so its result stays within an ulp of the exact sum for any size, while the error
+/// of Sum grows with the size.
+TEST(HipcubDeviceReduceKahanSumTests, ReduceKahanSum)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = float;
+
+    std::vector<size_t> sizes = get_sizes();
+    sizes.push_back(1 << 24);
+    for(auto size : sizes)
+    {
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+        const unsigned int seed_value = seeds[0];
+        std::vector<T>     input      = test_utils::get_random_data<T>(size, 0.0f, 1.0f, seed_value);
+
+        const double expected = std::accumulate(input.begin(), input.end(), 0.0);
+
+        T* d_input;
+        T* d_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, 2 * sizeof(T)));
+        HIP_CHECK(
+            hipMemcpy(d_input, input.data(), input.size() * sizeof(T), hipMemcpyHostToDevice));
+
+        size_t sum_temp_storage_bytes;
+        HIP_CHECK(hipcub::DeviceReduce::Sum(nullptr,
+                                            sum_temp_storage_bytes,
+                                            d_input,
+                                            d_output,
+                                            input.size()));
+        size_t kahan_temp_storage_bytes;
+        HIP_CHECK(hipcub::DeviceReduce::Reduce(nullptr,
+                                               kahan_temp_storage_bytes,
+                                               d_input,
+                                               d_output + 1,
+                                               input.size(),
+                                               hipcub::KahanSum(),
+                                               T(0)));
+
+        size_t temp_storage_bytes = std::max(sum_temp_storage_bytes, kahan_temp_storage_bytes);
+        void*  d_temp_storage     = nullptr;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_bytes));
+
+        HIP_CHECK(hipcub::DeviceReduce::Sum(d_temp_storage,
+                                            temp_storage_bytes,
+                                            d_input,
+                                            d_output,
+                                            input.size()));
+        HIP_CHECK(hipcub::DeviceReduce::Reduce(d_temp_storage,
+                                               temp_storage_bytes,
+                                               d_input,
+                                               d_output + 1,
+                                               input.size(),
+                                               hipcub::KahanSum(),
+                                               T(0)));
+        HIP_CHECK(hipPeekAtLastError());
+
+        T output[2];
+        HIP_CHECK(hipMemcpy(output, d_output, 2 * sizeof(T), hipMemcpyDeviceToHost));
+
+        const double sum_error   = std::abs(output[0] - expected) / expected;
+        const double kahan_error = std::abs(output[1] - expected) / expected;
+        SCOPED_TRACE(testing::Message() << "Sum relative error = " << sum_error
+                                        << ", KahanSum relative error = " << kahan_error);
+
+        ASSERT_LE(kahan_error, std::numeric_limits<T>::epsilon());
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_output));
+        HIP_CHECK(hipFree(d_temp_storage));
+    }
+}
+
+/// Infinities and NaNs in the input give the same result as Sum, the compensation must not
+/// turn them into NaN.
+TEST(HipcubDeviceReduceKahanSumTests, ReduceKahanSumNonFinite)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = float;
+
+    const T inf = std::numeric_limits<T>::infinity();
+
+    for(auto size : get_sizes())
+    {
+        if(size < 2)
+        {
+            continue;
+        }
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+        const unsigned int seed_value = seeds[0];
+        std::vector<T>     input      = test_utils::get_random_data<T>(size, 0.0f, 1.0f, seed_value);
+
+        // +inf, -inf, and both (NaN)
+        for(int test_case = 0; test_case < 3; test_case++)
+        {
+            SCOPED_TRACE(testing::Message() << "with test_case = " << test_case);
+            std::vector<T> case_input = input;
+            if(test_case != 1)
+            {
+                case_input[size / 3] = inf;
+            }
+            if(test_case != 0)
+            {
+                case_input[size - 1] = -inf;
+            }
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(T)));
+            HIP_CHECK(
+                hipMemcpy(d_input, case_input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            size_t temp_storage_bytes;
+            HIP_CHECK(hipcub::DeviceReduce::Reduce(nullptr,
+                                                   temp_storage_bytes,
+                                                   d_input,
+                                                   d_output,
+                                                   size,
+                                                   hipcub::KahanSum(),
+                                                   T(0)));
+            void* d_temp_storage = nullptr;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_bytes));
+            HIP_CHECK(hipcub::DeviceReduce::Reduce(d_temp_storage,
+                                                   temp_storage_bytes,
+                                                   d_input,
+                                                   d_output,
+                                                   size,
+                                                   hipcub::KahanSum(),
+                                                   T(0)));
+            HIP_CHECK(hipPeekAtLastError());
+
+            T output;
+            HIP_CHECK(hipMemcpy(&output, d_output, sizeof(T), hipMemcpyDeviceToHost));
+
+            if(test_case == 0)
+            {
+                ASSERT_EQ(output, inf);
+            }
+            else if(test_case == 1)
+            {
+                ASSERT_EQ(output, -inf);
+            }
+            else
+            {
+                ASSERT_TRUE(std::isnan(output));
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
+#endif // HIPCUB_ROCPRIM_API
@@ -1121,3 +1121,79 @@ TYPED_TEST(HipcubDeviceScanTests, ExclusiveScanFuture)
         }
     }
 }
+
+#ifdef HIPCUB_ROCPRIM_API
+/// DeviceScanWithConfig with a non-default configuration must produce the same result as
+/// DeviceScan.
+TEST(HipcubDeviceScanWithConfigTests, InclusiveSumWithConfig)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T      = int;
+    using config = rocprim::scan_config<128,
+                                        4,
+                                        true,
+                                        rocprim::block_load_method::block_load_transpose,
+                                        rocprim::block_store_method::block_store_transpose,
+                                        rocprim::block_scan_algorithm::using_warp_scan>;
+
+    const std::vector<size_t> sizes = get_sizes();
+    for(auto size : sizes)
+    {
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+        const unsigned int seed_value = seeds[0];
+        std::vector<T>     input      = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+
+        // The default configuration writes the first half of the output, config the second
+        T* d_input;
+        T* d_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, 2 * size * sizeof(T)));
+        HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+        size_t default_temp_storage_bytes;
+        HIP_CHECK(hipcub::DeviceScan::InclusiveSum(nullptr,
+                                                   default_temp_storage_bytes,
+                                                   d_input,
+                                                   d_output,
+                                                   size));
+        size_t config_temp_storage_bytes;
+        HIP_CHECK(hipcub::DeviceScanWithConfig<config>::InclusiveSum(nullptr,
+                                                                     config_temp_storage_bytes,
+                                                                     d_input,
+                                                                     d_output + size,
+                                                                     size));
+        size_t temp_storage_bytes = std::max(default_temp_storage_bytes, config_temp_storage_bytes);
+        void*  d_temp_storage     = nullptr;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_bytes));
+
+        HIP_CHECK(hipcub::DeviceScan::InclusiveSum(d_temp_storage,
+                                                   temp_storage_bytes,
+                                                   d_input,
+                                                   d_output,
+                                                   size));
+        HIP_CHECK(hipcub::DeviceScanWithConfig<config>::InclusiveSum(d_temp_storage,
+                                                                     temp_storage_bytes,
+                                                                     d_input,
+                                                                     d_output + size,
+                                                                     size));
+        HIP_CHECK(hipPeekAtLastError());
+
+        std::vector<T> output(2 * size);
+        HIP_CHECK(
+            hipMemcpy(output.data(), d_output, 2 * size * sizeof(T), hipMemcpyDeviceToHost));
+
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_EQ(output[size + i], output[i]) << "where index = " << i;
+        }
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_output));
+        HIP_CHECK(hipFree(d_temp_storage));
+    }
+}
+#endif // HIPCUB_ROCPRIM_API
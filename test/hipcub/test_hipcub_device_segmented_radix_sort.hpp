@@ -99,6 +99,8 @@ inline void sort_keys()
     const std::vector<size_t> sizes = get_sizes();
     for(size_t size : sizes)
     {
+        if(!test_common_utils::size_class_enabled(size)) continue;
+
         for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
         {
             unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
@@ -120,8 +122,8 @@ inline void sort_keys()
             {
                 keys_input = test_utils::get_random_data<key_type>(
                     size,
-                    std::numeric_limits<key_type>::min(),
-                    std::numeric_limits<key_type>::max(),
+                    test_utils::numeric_limits<key_type>::min(),
+                    test_utils::numeric_limits<key_type>::max(),
                     seed_value + seed_value_addition
                 );
             }
@@ -263,6 +265,8 @@ inline void sort_pairs()
     const std::vector<size_t> sizes = get_sizes();
     for(size_t size : sizes)
     {
+        if(!test_common_utils::size_class_enabled(size)) continue;
+
         for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
         {
             unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
@@ -284,8 +288,8 @@ inline void sort_pairs()
             {
                 keys_input = test_utils::get_random_data<key_type>(
                     size,
-                    std::numeric_limits<key_type>::min(),
-                    std::numeric_limits<key_type>::max(),
+                    test_utils::numeric_limits<key_type>::min(),
+                    test_utils::numeric_limits<key_type>::max(),
                     seed_value + seed_value_addition
                 );
             }
@@ -459,6 +463,8 @@ inline void sort_keys_double_buffer()
     const std::vector<size_t> sizes = get_sizes();
     for(size_t size : sizes)
     {
+        if(!test_common_utils::size_class_enabled(size)) continue;
+
         for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
         {
             unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
@@ -480,8 +486,8 @@ inline void sort_keys_double_buffer()
             {
                 keys_input = test_utils::get_random_data<key_type>(
                     size,
-                    std::numeric_limits<key_type>::min(),
-                    std::numeric_limits<key_type>::max(),
+                    test_utils::numeric_limits<key_type>::min(),
+                    test_utils::numeric_limits<key_type>::max(),
                     seed_value + seed_value_addition
                 );
             }
@@ -625,6 +631,8 @@ inline void sort_pairs_double_buffer()
     const std::vector<size_t> sizes = get_sizes();
     for(size_t size : sizes)
     {
+        if(!test_common_utils::size_class_enabled(size)) continue;
+
         for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
         {
             unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
@@ -646,8 +654,8 @@ inline void sort_pairs_double_buffer()
             {
                 keys_input = test_utils::get_random_data<key_type>(
                     size,
-                    std::numeric_limits<key_type>::min(),
-                    std::numeric_limits<key_type>::max(),
+                    test_utils::numeric_limits<key_type>::min(),
+                    test_utils::numeric_limits<key_type>::max(),
                     seed_value + seed_value_addition
                 );
             }
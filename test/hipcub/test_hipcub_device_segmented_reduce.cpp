@@ -775,6 +775,88 @@ TYPED_TEST(HipcubDeviceSegmentedReduce, ArgMax)
     test_argminmax<TestFixture, ArgMaxDispatch, HostOp>(test_utils::numeric_limits<T>::lowest());
 }
 
+#ifdef HIPCUB_ROCPRIM_API
+struct ArgMinPackedDispatch
+{
+    template<typename InputIteratorT, typename OutputIteratorT, typename OffsetIteratorT>
+    auto operator()(void*           d_temp_storage,
+                    size_t&         temp_storage_bytes,
+                    InputIteratorT  d_in,
+                    OutputIteratorT d_out,
+                    int             num_segments,
+                    OffsetIteratorT d_begin_offsets,
+                    OffsetIteratorT d_end_offsets,
+                    hipStream_t     stream,
+                    bool            debug_synchronous) const
+    {
+        return hipcub::DeviceSegmentedReduce::ArgMinPacked(d_temp_storage,
+                                                           temp_storage_bytes,
+                                                           d_in,
+                                                           d_out,
+                                                           num_segments,
+                                                           d_begin_offsets,
+                                                           d_end_offsets,
+                                                           stream,
+                                                           debug_synchronous);
+    }
+};
+
+struct ArgMaxPackedDispatch
+{
+    template<typename InputIteratorT, typename OutputIteratorT, typename OffsetIteratorT>
+    auto operator()(void*           d_temp_storage,
+                    size_t&         temp_storage_bytes,
+                    InputIteratorT  d_in,
+                    OutputIteratorT d_out,
+                    int             num_segments,
+                    OffsetIteratorT d_begin_offsets,
+                    OffsetIteratorT d_end_offsets,
+                    hipStream_t     stream,
+                    bool            debug_synchronous) const
+    {
+        return hipcub::DeviceSegmentedReduce::ArgMaxPacked(d_temp_storage,
+                                                           temp_storage_bytes,
+                                                           d_in,
+                                                           d_out,
+                                                           num_segments,
+                                                           d_begin_offsets,
+                                                           d_end_offsets,
+                                                           stream,
+                                                           debug_synchronous);
+    }
+};
+
+// The packed variants only take values of at most 32 bits
+template<class Params>
+class HipcubDeviceSegmentedReducePacked : public HipcubDeviceSegmentedReduce<Params>
+{};
+
+typedef ::testing::Types<params2<unsigned int, unsigned int>,
+                         params2<int, int, 0, 10000>,
+                         params2<float, float, 100, 200>,
+                         params2<test_utils::half, float>,
+                         params2<test_utils::bfloat16, float>>
+    ParamsPacked;
+
+TYPED_TEST_SUITE(HipcubDeviceSegmentedReducePacked, ParamsPacked);
+
+TYPED_TEST(HipcubDeviceSegmentedReducePacked, ArgMinPacked)
+{
+    using T      = typename TestFixture::params::input_type;
+    using HostOp = typename ArgMinSelector<T>::type;
+    test_argminmax<TestFixture, ArgMinPackedDispatch, HostOp>(
+        test_utils::numeric_limits<T>::max());
+}
+
+TYPED_TEST(HipcubDeviceSegmentedReducePacked, ArgMaxPacked)
+{
+    using T      = typename TestFixture::params::input_type;
+    using HostOp = typename ArgMaxSelector<T>::type;
+    test_argminmax<TestFixture, ArgMaxPackedDispatch, HostOp>(
+        test_utils::numeric_limits<T>::lowest());
+}
+#endif // HIPCUB_ROCPRIM_API
+
 template<class T>
 class HipcubDeviceReduceArgMinMaxSpecialTests : public testing::Test
 {};
@@ -923,3 +1005,93 @@ TYPED_TEST(HipcubDeviceReduceArgMinMaxSpecialTests, ReduceArgMaxInf)
         test_utils::numeric_limits<TypeParam>::lowest());
 }
 #endif // __HIP_PLATFORM_AMD__
+
+#ifdef HIPCUB_ROCPRIM_API
+/// Reduce with KahanSum keeps float input and output, and the sum of every segment stays
+/// within an ulp of its exact sum.
+TEST(HipcubDeviceSegmentedReduceKahanSumTests, ReduceKahanSum)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T           = float;
+    using offset_type = unsigned int;
+
+    const std::vector<size_t> sizes = get_sizes();
+    for(size_t size : sizes)
+    {
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+        const unsigned int seed_value = seeds[0];
+        std::vector<T>     input = test_utils::get_random_data<T>(size, 0.0f, 1.0f, seed_value);
+
+        // A few long segments, so that the float error of a plain sum would be visible
+        const size_t             segment_length = std::max<size_t>(1, size / 7);
+        std::vector<offset_type> offsets;
+        std::vector<double>      expected;
+        for(size_t offset = 0; offset < size; offset += segment_length)
+        {
+            const size_t end = std::min(size, offset + segment_length);
+            offsets.push_back(offset);
+            expected.push_back(
+                std::accumulate(input.begin() + offset, input.begin() + end, 0.0));
+        }
+        offsets.push_back(size);
+        const unsigned int segments_count = expected.size();
+
+        T*           d_input;
+        T*           d_output;
+        offset_type* d_offsets;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, segments_count * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets,
+                                                     offsets.size() * sizeof(offset_type)));
+        HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_offsets,
+                            offsets.data(),
+                            offsets.size() * sizeof(offset_type),
+                            hipMemcpyHostToDevice));
+
+        size_t temp_storage_bytes;
+        void*  d_temp_storage = nullptr;
+        HIP_CHECK(hipcub::DeviceSegmentedReduce::Reduce(d_temp_storage,
+                                                        temp_storage_bytes,
+                                                        d_input,
+                                                        d_output,
+                                                        segments_count,
+                                                        d_offsets,
+                                                        d_offsets + 1,
+                                                        hipcub::KahanSum(),
+                                                        T(0)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_bytes));
+        HIP_CHECK(hipcub::DeviceSegmentedReduce::Reduce(d_temp_storage,
+                                                        temp_storage_bytes,
+                                                        d_input,
+                                                        d_output,
+                                                        segments_count,
+                                                        d_offsets,
+                                                        d_offsets + 1,
+                                                        hipcub::KahanSum(),
+                                                        T(0)));
+        HIP_CHECK(hipPeekAtLastError());
+
+        std::vector<T> output(segments_count);
+        HIP_CHECK(hipMemcpy(output.data(),
+                            d_output,
+                            segments_count * sizeof(T),
+                            hipMemcpyDeviceToHost));
+
+        for(size_t i = 0; i < segments_count; i++)
+        {
+            ASSERT_NEAR(output[i], expected[i], expected[i] * std::numeric_limits<T>::epsilon())
+                << "where segment = " << i;
+        }
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_output));
+        HIP_CHECK(hipFree(d_offsets));
+        HIP_CHECK(hipFree(d_temp_storage));
+    }
+}
+#endif // HIPCUB_ROCPRIM_API
@@ -170,27 +170,42 @@ inline T * hipMallocAndCopy(const std::vector<T> &data)
     return d_ptr;
 }
 
+// Segments are sorted in parallel in groups of this many segments.
+constexpr size_t expected_data_segment_chunk = 64;
+
 template<typename key_type, typename offset_type>
 inline std::vector<key_type> generate_expected_data(const std::vector<key_type> &keys_input,
                                              const std::vector<offset_type> &offsets,
-                                             const bool descending)
+                                             const bool descending,
+                                             const int seed_value)
 {
     const size_t segments_count = offsets.size() - 1;
-    std::vector<key_type> expected(keys_input);
-    for (size_t i = 0; i < segments_count; ++i)
-    {
-        std::stable_sort(
-            expected.begin() + offsets[i],
-            expected.begin() + offsets[i + 1]
-        );
-        if (descending)
+    std::vector<key_type> expected;
+    test_utils::host_reference(
+        test_utils::make_host_reference_key(seed_value, keys_input, offsets),
+        [&]
         {
-            std::reverse(
-                expected.begin() + offsets[i],
-                expected.begin() + offsets[i + 1]
-            );
-        }
-    }
+            expected = keys_input;
+            test_utils::parallel_for_chunks(segments_count, [&](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    std::stable_sort(
+                        expected.begin() + offsets[i],
+                        expected.begin() + offsets[i + 1]
+                    );
+                    if (descending)
+                    {
+                        std::reverse(
+                            expected.begin() + offsets[i],
+                            expected.begin() + offsets[i + 1]
+                        );
+                    }
+                }
+            }, expected_data_segment_chunk);
+        },
+        expected
+    );
     return expected;
 }
 
@@ -198,22 +213,48 @@ template<bool descending, typename key_type, typename value_type, typename offse
 std::vector<std::pair<key_type, value_type>>
 inline generate_expected_data(const std::vector<key_type> &keys_input,
                        const std::vector<value_type> &values_input,
-                       const std::vector<offset_type> &offsets)
+                       const std::vector<offset_type> &offsets,
+                       const int seed_value)
 {
     const size_t size = keys_input.size();
     const size_t segments_count = offsets.size() - 1;
     std::vector<std::pair<key_type, value_type>> expected(size);
+
+    // The sorted keys and values are cached separately, std::pair is not trivially copyable.
+    std::vector<key_type> keys_expected;
+    std::vector<value_type> values_expected;
+    test_utils::host_reference(
+        test_utils::make_host_reference_key(seed_value, keys_input, values_input, offsets),
+        [&]
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                expected[i] = std::make_pair(keys_input[i], values_input[i]);
+            }
+            test_utils::parallel_for_chunks(segments_count, [&](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    std::stable_sort(
+                        expected.begin() + offsets[i],
+                        expected.begin() + offsets[i + 1],
+                        test_utils::key_value_comparator<key_type, value_type, descending, 0, sizeof(key_type) * 8>()
+                    );
+                }
+            }, expected_data_segment_chunk);
+            keys_expected.resize(size);
+            values_expected.resize(size);
+            for (size_t i = 0; i < size; ++i)
+            {
+                keys_expected[i] = expected[i].first;
+                values_expected[i] = expected[i].second;
+            }
+        },
+        keys_expected, values_expected
+    );
     for (size_t i = 0; i < size; ++i)
     {
-        expected[i] = std::make_pair(keys_input[i], values_input[i]);
-    }
-    for (size_t i = 0; i < segments_count; ++i)
-    {
-        std::stable_sort(
-            expected.begin() + offsets[i],
-            expected.begin() + offsets[i + 1],
-            test_utils::key_value_comparator<key_type, value_type, descending, 0, sizeof(key_type) * 8>()
-        );
+        expected[i] = std::make_pair(keys_expected[i], values_expected[i]);
     }
     return expected;
 }
@@ -255,6 +296,7 @@ inline void sort_keys()
         const int seed_value = seed_index < random_seeds_count ? seeds[seed_index] : rand();
         for (const size_t size : get_sizes(seed_value))
         {
+            if (!test_common_utils::size_class_enabled(size)) continue;
             SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
             SCOPED_TRACE(testing::Message() << "with size = " << size);
 
@@ -272,7 +314,7 @@ inline void sort_keys()
             key_type * d_keys_output{};
             HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
 
-            const std::vector<key_type> expected = generate_expected_data(keys_input, offsets, descending);
+            const std::vector<key_type> expected = generate_expected_data(keys_input, offsets, descending, seed_value);
 
             size_t temporary_storage_bytes{};
             dispatch_sort_keys(
@@ -326,6 +368,7 @@ inline void sort_keys_double_buffer()
         const int seed_value = seed_index < random_seeds_count ? seeds[seed_index] : rand();
         for (const size_t size : get_sizes(seed_value))
         {
+            if (!test_common_utils::size_class_enabled(size)) continue;
             SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
             SCOPED_TRACE(testing::Message() << "with size = " << size);
 
@@ -343,7 +386,7 @@ inline void sort_keys_double_buffer()
             key_type * d_keys_output{};
             HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
 
-            std::vector<key_type> expected = generate_expected_data(keys_input, offsets, descending);
+            std::vector<key_type> expected = generate_expected_data(keys_input, offsets, descending, seed_value);
 
             hipcub::DoubleBuffer<key_type> d_keys(d_keys_input, d_keys_output);
 
@@ -430,6 +473,7 @@ inline void sort_pairs()
         const int seed_value = seed_index < random_seeds_count ? seeds[seed_index] : rand();
         for (const size_t size : get_sizes(seed_value))
         {
+            if (!test_common_utils::size_class_enabled(size)) continue;
             SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
             SCOPED_TRACE(testing::Message() << "with size = " << size);
 
@@ -453,7 +497,7 @@ inline void sort_pairs()
             value_type * d_values_output{};
             HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output, size * sizeof(value_type)));
 
-            const std::vector<std::pair<key_type, value_type>> expected = generate_expected_data<descending>(keys_input, values_input, offsets);
+            const std::vector<std::pair<key_type, value_type>> expected = generate_expected_data<descending>(keys_input, values_input, offsets, seed_value);
 
             size_t temporary_storage_bytes{};
             dispatch_sort_pairs(
@@ -518,6 +562,7 @@ inline void sort_pairs_double_buffer()
         const int seed_value = seed_index < random_seeds_count ? seeds[seed_index] : rand();
         for (const size_t size : get_sizes(seed_value))
         {
+            if (!test_common_utils::size_class_enabled(size)) continue;
             SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
             SCOPED_TRACE(testing::Message() << "with size = " << size);
 
@@ -541,7 +586,7 @@ inline void sort_pairs_double_buffer()
             value_type * d_values_output{};
             HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output, size * sizeof(value_type)));
 
-            const std::vector<std::pair<key_type, value_type>> expected = generate_expected_data<descending>(keys_input, values_input, offsets);
+            const std::vector<std::pair<key_type, value_type>> expected = generate_expected_data<descending>(keys_input, values_input, offsets, seed_value);
 
             hipcub::DoubleBuffer<key_type> d_keys(d_keys_input, d_keys_output);
             hipcub::DoubleBuffer<value_type> d_values(d_values_input, d_values_output);
@@ -899,3 +899,98 @@ TYPED_TEST(HipcubDeviceUniqueByKeyTests, UniqueByKey)
         }
     }
 }
+
+#ifdef HIPCUB_ROCPRIM_API
+/// DeviceSelectWithConfig with a non-default configuration must produce the same result
+/// as DeviceSelect.
+TEST(HipcubDeviceSelectWithConfigTests, SelectOpWithConfig)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T      = int;
+    using config = rocprim::select_config<128,
+                                          4,
+                                          rocprim::block_load_method::block_load_transpose,
+                                          rocprim::block_load_method::block_load_transpose,
+                                          rocprim::block_load_method::block_load_transpose,
+                                          rocprim::block_scan_algorithm::using_warp_scan>;
+
+    const std::vector<size_t> sizes = get_sizes();
+    for(auto size : sizes)
+    {
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+        const unsigned int seed_value = seeds[0];
+        std::vector<T>     input      = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+
+        // The default configuration writes the first half of the outputs, config the second
+        T*            d_input;
+        T*            d_output;
+        unsigned int* d_selected_count_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, 2 * size * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_selected_count_output,
+                                                     2 * sizeof(*d_selected_count_output)));
+        HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+        size_t default_temp_storage_bytes;
+        HIP_CHECK(hipcub::DeviceSelect::If(nullptr,
+                                           default_temp_storage_bytes,
+                                           d_input,
+                                           d_output,
+                                           d_selected_count_output,
+                                           size,
+                                           TestSelectOp()));
+        size_t config_temp_storage_bytes;
+        HIP_CHECK(hipcub::DeviceSelectWithConfig<config>::If(nullptr,
+                                                             config_temp_storage_bytes,
+                                                             d_input,
+                                                             d_output + size,
+                                                             d_selected_count_output + 1,
+                                                             size,
+                                                             TestSelectOp()));
+        size_t temp_storage_bytes = std::max(default_temp_storage_bytes, config_temp_storage_bytes);
+        void*  d_temp_storage     = nullptr;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_bytes));
+
+        HIP_CHECK(hipcub::DeviceSelect::If(d_temp_storage,
+                                           temp_storage_bytes,
+                                           d_input,
+                                           d_output,
+                                           d_selected_count_output,
+                                           size,
+                                           TestSelectOp()));
+        HIP_CHECK(hipcub::DeviceSelectWithConfig<config>::If(d_temp_storage,
+                                                             temp_storage_bytes,
+                                                             d_input,
+                                                             d_output + size,
+                                                             d_selected_count_output + 1,
+                                                             size,
+                                                             TestSelectOp()));
+        HIP_CHECK(hipPeekAtLastError());
+
+        unsigned int selected_count_output[2];
+        HIP_CHECK(hipMemcpy(selected_count_output,
+                            d_selected_count_output,
+                            sizeof(selected_count_output),
+                            hipMemcpyDeviceToHost));
+        ASSERT_EQ(selected_count_output[1], selected_count_output[0]);
+
+        std::vector<T> output(2 * size);
+        HIP_CHECK(
+            hipMemcpy(output.data(), d_output, 2 * size * sizeof(T), hipMemcpyDeviceToHost));
+
+        for(size_t i = 0; i < selected_count_output[0]; i++)
+        {
+            ASSERT_EQ(output[size + i], output[i]) << "where index = " << i;
+        }
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_output));
+        HIP_CHECK(hipFree(d_selected_count_output));
+        HIP_CHECK(hipFree(d_temp_storage));
+    }
+}
+#endif // HIPCUB_ROCPRIM_API
@@ -0,0 +1,132 @@
+// MIT License
+//
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "common_test_header.hpp"
+
+// hipcub API
+#include "hipcub/device/device_segmented_reduce.hpp"
+#include "hipcub/util_launch_recorder.hpp"
+
+#include <cstring>
+#include <vector>
+
+TEST(HipcubLaunchRecorderTests, SegmentedArgMin)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                         = int;
+    using OffsetT                   = int;
+    using ResultT                   = hipcub::KeyValuePair<int, T>;
+    const unsigned int segments     = 37;
+    const size_t       segment_size = 100;
+    const size_t       size         = segments * segment_size;
+
+    std::vector<OffsetT> offsets(segments + 1);
+    for(size_t i = 0; i < offsets.size(); i++)
+    {
+        offsets[i] = static_cast<OffsetT>(i * segment_size);
+    }
+
+    T*       d_input;
+    ResultT* d_output;
+    OffsetT* d_offsets;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, segments * sizeof(ResultT)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets, offsets.size() * sizeof(OffsetT)));
+    HIP_CHECK(hipMemset(d_input, 0, size * sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_offsets,
+                        offsets.data(),
+                        offsets.size() * sizeof(OffsetT),
+                        hipMemcpyHostToDevice));
+
+    hipcub::LaunchRecorder recorder;
+    ASSERT_EQ(hipcub::LaunchRecorder::Active(), &recorder);
+
+    size_t temp_storage_bytes = 0;
+    void*  d_temp_storage     = nullptr;
+    HIP_CHECK(hipcub::DeviceSegmentedReduce::ArgMin(d_temp_storage,
+                                                    temp_storage_bytes,
+                                                    d_input,
+                                                    d_output,
+                                                    segments,
+                                                    d_offsets,
+                                                    d_offsets + 1));
+    // Size queries do not launch kernels
+    ASSERT_TRUE(recorder.Records().empty());
+
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_bytes));
+    HIP_CHECK(hipcub::DeviceSegmentedReduce::ArgMin(d_temp_storage,
+                                                    temp_storage_bytes,
+                                                    d_input,
+                                                    d_output,
+                                                    segments,
+                                                    d_offsets,
+                                                    d_offsets + 1));
+
+#ifdef HIPCUB_ROCPRIM_API
+    const std::vector<hipcub::LaunchRecord>& records = recorder.Records();
+    ASSERT_EQ(records.size(), 1u);
+    ASSERT_EQ(std::strcmp(records[0].kernel_name, "segmented_arg_minmax"), 0);
+    ASSERT_EQ(records[0].grid_size.x, segments);
+    ASSERT_GT(records[0].block_size.x, 0u);
+    ASSERT_EQ(records[0].stream, hipStream_t(0));
+    ASSERT_GE(records[0].device_milliseconds, 0.0f);
+
+    recorder.Clear();
+    ASSERT_TRUE(recorder.Records().empty());
+#else
+    // Kernels launched by CUB are not recorded
+    ASSERT_TRUE(recorder.Records().empty());
+#endif
+
+    {
+        hipcub::LaunchRecorder nested;
+        ASSERT_EQ(hipcub::LaunchRecorder::Active(), &nested);
+    }
+    ASSERT_EQ(hipcub::LaunchRecorder::Active(), &recorder);
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_offsets));
+    HIP_CHECK(hipFree(d_temp_storage));
+}
+
+TEST(HipcubLaunchRecorderTests, RocprimDebugSynchronous)
+{
+    ASSERT_EQ(hipcub::LaunchRecorder::Active(), nullptr);
+    ASSERT_TRUE(hipcub::detail::rocprim_debug_synchronous(true));
+    ASSERT_FALSE(hipcub::detail::rocprim_debug_synchronous(false));
+    {
+        // rocPRIM would print its launches to std::cout
+        hipcub::LaunchRecorder recorder;
+        ASSERT_FALSE(hipcub::detail::rocprim_debug_synchronous(true));
+        ASSERT_FALSE(hipcub::detail::rocprim_debug_synchronous(false));
+
+        // hipCUB synchronizes after the rocPRIM call instead, and keeps its errors
+        HIP_CHECK(hipcub::detail::rocprim_debug_synchronize(hipSuccess, 0, true));
+        ASSERT_EQ(hipcub::detail::rocprim_debug_synchronize(hipErrorInvalidValue, 0, true),
+                  hipErrorInvalidValue);
+    }
+    ASSERT_TRUE(hipcub::detail::rocprim_debug_synchronous(true));
+}
@@ -0,0 +1,145 @@
+// MIT License
+//
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "common_test_header.hpp"
+
+// hipcub API
+#include "hipcub/device/device_reduce.hpp"
+#include "hipcub/device/device_scan.hpp"
+#include "hipcub/util_temporary_storage.hpp"
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+TEST(HipcubTempStoragePlannerTests, Layout)
+{
+    hipcub::TempStoragePlanner planner;
+    ASSERT_EQ(planner.TotalBytes(), 4u);
+
+    size_t a, b, c, d;
+    // Sequential stages alias each other
+    HIP_CHECK(planner.AddBytes(a, 1000, 0, 0));
+    HIP_CHECK(planner.AddBytes(b, 3000, 1, 1));
+    ASSERT_EQ(planner.Offset(a), 0u);
+    ASSERT_EQ(planner.Offset(b), 0u);
+    ASSERT_EQ(planner.TotalBytes(), 3000u);
+
+    // A buffer live during both stages must not overlap either of them
+    HIP_CHECK(planner.AddBytes(c, 500, 0, 1));
+    ASSERT_EQ(planner.Offset(c), 3072u);
+    ASSERT_EQ(planner.TotalBytes(), 3572u);
+
+    HIP_CHECK(planner.AddBytes(d, 100, 1, 1, 512));
+    ASSERT_EQ(planner.Offset(d) % 512, 0u);
+    ASSERT_GE(planner.Offset(d), planner.Offset(c) + 500);
+    ASSERT_EQ(planner.Bytes(d), 100u);
+
+    ASSERT_EQ(planner.AddBytes(d, 1, 2, 1), hipErrorInvalidValue);
+    ASSERT_EQ(planner.AddBytes(d, 1, 0, 0, 3), hipErrorInvalidValue);
+
+    planner.Clear();
+    ASSERT_EQ(planner.TotalBytes(), 4u);
+}
+
+TEST(HipcubTempStoragePlannerTests, ReduceThenScan)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T           = int;
+    const size_t size = 54321;
+
+    std::vector<T> input(size);
+    for(size_t i = 0; i < size; i++)
+    {
+        input[i] = static_cast<T>(i % 7);
+    }
+
+    T* d_input;
+    T* d_sum;
+    T* d_scan;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_sum, sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_scan, size * sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+    hipcub::TempStoragePlanner planner;
+    size_t                     reduce_id, scan_id;
+    HIP_CHECK(planner.Add(reduce_id,
+                          [&](void* d_temp_storage, size_t& temp_storage_bytes)
+                          {
+                              return hipcub::DeviceReduce::Sum(d_temp_storage,
+                                                               temp_storage_bytes,
+                                                               d_input,
+                                                               d_sum,
+                                                               size);
+                          }));
+    HIP_CHECK(planner.Add(scan_id,
+                          [&](void* d_temp_storage, size_t& temp_storage_bytes)
+                          {
+                              return hipcub::DeviceScan::InclusiveSum(d_temp_storage,
+                                                                      temp_storage_bytes,
+                                                                      d_input,
+                                                                      d_scan,
+                                                                      size);
+                          }));
+    ASSERT_EQ(planner.TotalBytes(),
+              std::max(std::max(planner.Bytes(reduce_id), planner.Bytes(scan_id)), size_t(4)));
+
+    void* d_temp_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, planner.TotalBytes()));
+
+    size_t temp_storage_bytes = planner.Bytes(reduce_id);
+    void*  d_reduce_storage   = planner.Get(d_temp_storage, reduce_id);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(d_reduce_storage)
+                  % hipcub::TempStoragePlanner::default_alignment,
+              0u);
+    HIP_CHECK(hipcub::DeviceReduce::Sum(d_reduce_storage,
+                                        temp_storage_bytes,
+                                        d_input,
+                                        d_sum,
+                                        size));
+    temp_storage_bytes = planner.Bytes(scan_id);
+    HIP_CHECK(hipcub::DeviceScan::InclusiveSum(planner.Get(d_temp_storage, scan_id),
+                                               temp_storage_bytes,
+                                               d_input,
+                                               d_scan,
+                                               size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<T> expected(size);
+    std::partial_sum(input.begin(), input.end(), expected.begin());
+
+    T              sum;
+    std::vector<T> scan(size);
+    HIP_CHECK(hipMemcpy(&sum, d_sum, sizeof(T), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(scan.data(), d_scan, size * sizeof(T), hipMemcpyDeviceToHost));
+    ASSERT_EQ(sum, expected.back());
+    ASSERT_EQ(scan, expected);
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_sum));
+    HIP_CHECK(hipFree(d_scan));
+    HIP_CHECK(hipFree(d_temp_storage));
+}
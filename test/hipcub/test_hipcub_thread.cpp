@@ -221,6 +221,111 @@ TYPED_TEST(HipcubThreadOperationTests, Store)
     }
 }
 
+template<class Params>
+class HipcubThreadVectorOperationTests : public ::testing::Test
+{
+public:
+    using type = typename Params::type;
+    static constexpr hipcub::CacheLoadModifier load_modifier = Params::load_modifier;
+    static constexpr hipcub::CacheStoreModifier store_modifier = Params::store_modifier;
+};
+
+typedef ::testing::Types<
+    params<test_utils::half, hipcub::LOAD_CA, hipcub::STORE_WB>,
+    params<float, hipcub::LOAD_CA, hipcub::STORE_WB>,
+    params<float3, hipcub::LOAD_CA, hipcub::STORE_WB>,
+    params<float4, hipcub::LOAD_CA, hipcub::STORE_WB>,
+
+    params<int32_t, hipcub::LOAD_CG, hipcub::STORE_CG>,
+    params<double, hipcub::LOAD_CG, hipcub::STORE_CG>,
+    params<int3, hipcub::LOAD_CG, hipcub::STORE_CG>,
+    params<double2, hipcub::LOAD_CG, hipcub::STORE_CG>,
+
+    params<test_utils::bfloat16, hipcub::LOAD_CV, hipcub::STORE_WT>,
+    params<float2, hipcub::LOAD_CV, hipcub::STORE_WT>,
+    params<uint4, hipcub::LOAD_CV, hipcub::STORE_WT>,
+
+    params<int8_t, hipcub::LOAD_CS, hipcub::STORE_CS>,
+    params<uint16_t, hipcub::LOAD_CS, hipcub::STORE_CS>,
+    params<float, hipcub::LOAD_CS, hipcub::STORE_CS>,
+    params<uint64_t, hipcub::LOAD_CS, hipcub::STORE_CS>,
+    params<uint3, hipcub::LOAD_CS, hipcub::STORE_CS>,
+    params<float4, hipcub::LOAD_CS, hipcub::STORE_CS>,
+    params<longlong2, hipcub::LOAD_CS, hipcub::STORE_CS>
+> ThreadVectorOperationTestParams;
+
+TYPED_TEST_SUITE(HipcubThreadVectorOperationTests, ThreadVectorOperationTestParams);
+
+template<class Type, hipcub::CacheLoadModifier LoadModifier, hipcub::CacheStoreModifier StoreModifier>
+__global__
+void thread_load_store_kernel(Type* const device_input, Type* device_output)
+{
+    size_t index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    hipcub::ThreadStore<StoreModifier>(device_output + index,
+                                       hipcub::ThreadLoad<LoadModifier>(device_input + index));
+}
+
+TYPED_TEST(HipcubThreadVectorOperationTests, LoadStore)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::type;
+    constexpr hipcub::CacheLoadModifier LoadModifier = TestFixture::load_modifier;
+    constexpr hipcub::CacheStoreModifier StoreModifier = TestFixture::store_modifier;
+    constexpr uint32_t block_size = 256;
+    constexpr uint32_t grid_size = 128;
+    constexpr uint32_t size = block_size * grid_size;
+    constexpr size_t bytes = size * sizeof(T);
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        // Random bytes, so every bit of the vector lanes (including NaN payloads) has to
+        // survive the round trip
+        std::vector<uint8_t> input = test_utils::get_random_data<uint8_t>(bytes, 0, 255, seed_value);
+        std::vector<uint8_t> output(bytes);
+
+        // Preparing device
+        T* device_input;
+        HIP_CHECK(hipMalloc(&device_input, bytes));
+        T* device_output;
+        HIP_CHECK(hipMalloc(&device_output, bytes));
+
+        HIP_CHECK(
+            hipMemcpy(
+                device_input, input.data(),
+                bytes,
+                hipMemcpyHostToDevice
+            )
+        );
+
+        thread_load_store_kernel<T, LoadModifier, StoreModifier>
+            <<<grid_size, block_size>>>(device_input, device_output);
+
+        // Reading results back
+        HIP_CHECK(
+            hipMemcpy(
+                output.data(), device_output,
+                bytes,
+                hipMemcpyDeviceToHost
+            )
+        );
+
+        // Verifying results
+        for(size_t i = 0; i < bytes; i++)
+        {
+            ASSERT_EQ(output[i], input[i]) << "where byte index = " << i;
+        }
+
+        HIP_CHECK(hipFree(device_input));
+        HIP_CHECK(hipFree(device_output));
+    }
+}
+
 struct sum_op
 {
     template<typename T> HIPCUB_HOST_DEVICE
@@ -316,6 +421,386 @@ TYPED_TEST(HipcubThreadOperationTests, Reduction)
     }
 }
 
+// 16-bit reductions with float accumulation and KahanSum are provided by the
+// rocPRIM backend
+#ifdef HIPCUB_ROCPRIM_API
+
+template<class T, int Length>
+struct widened_reduction_params
+{
+    using type                  = T;
+    static constexpr int length = Length;
+};
+
+template<class Params>
+class HipcubThreadWidenedReductionTests : public ::testing::Test
+{
+public:
+    using type                  = typename Params::type;
+    static constexpr int length = Params::length;
+};
+
+// Lengths cover a single item, whole pairs and an odd tail
+typedef ::testing::Types<widened_reduction_params<test_utils::half, 1>,
+                         widened_reduction_params<test_utils::half, 8>,
+                         widened_reduction_params<test_utils::half, 19>,
+                         widened_reduction_params<test_utils::bfloat16, 2>,
+                         widened_reduction_params<test_utils::bfloat16, 16>,
+                         widened_reduction_params<test_utils::bfloat16, 31>>
+    ThreadWidenedReductionTestParams;
+
+TYPED_TEST_SUITE(HipcubThreadWidenedReductionTests, ThreadWidenedReductionTestParams);
+
+template<class Type, int Length>
+__global__
+void thread_widened_reduce_kernel(Type* const device_input, Type* device_output)
+{
+    const size_t index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    Type input[Length];
+    for(int i = 0; i < Length; i++)
+    {
+        input[i] = device_input[index * Length + i];
+    }
+
+    device_output[index * 3 + 0] = hipcub::internal::ThreadReduce(input, hipcub::Sum());
+    device_output[index * 3 + 1] = hipcub::internal::ThreadReduce(input, hipcub::Max());
+    device_output[index * 3 + 2] = hipcub::internal::ThreadReduce(input, hipcub::Min());
+}
+
+TYPED_TEST(HipcubThreadWidenedReductionTests, Reduction)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                       = typename TestFixture::type;
+    constexpr int      length     = TestFixture::length;
+    constexpr uint32_t block_size = 64;
+    constexpr uint32_t grid_size  = 32;
+    constexpr uint32_t items      = block_size * grid_size;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        // Generate data
+        std::vector<T> input = test_utils::get_random_data<T>(items * length,
+                                                              test_utils::convert_to_device<T>(-100),
+                                                              test_utils::convert_to_device<T>(100),
+                                                              seed_value);
+        std::vector<T> output(items * 3);
+
+        // Calculate expected results on host, in float
+        std::vector<float> expected(items * 3);
+        for(uint32_t i = 0; i < items; i++)
+        {
+            float sum = 0.0f;
+            float max = test_utils::convert_to_fundamental(input[i * length]);
+            float min = max;
+            for(int j = 0; j < length; j++)
+            {
+                const float value = test_utils::convert_to_fundamental(input[i * length + j]);
+                sum += value;
+                max = std::max(max, value);
+                min = std::min(min, value);
+            }
+            expected[i * 3 + 0] = sum;
+            expected[i * 3 + 1] = max;
+            expected[i * 3 + 2] = min;
+        }
+
+        // Preparing device
+        T* device_input;
+        HIP_CHECK(hipMalloc(&device_input, input.size() * sizeof(T)));
+        T* device_output;
+        HIP_CHECK(hipMalloc(&device_output, output.size() * sizeof(T)));
+
+        HIP_CHECK(
+            hipMemcpy(
+                device_input, input.data(),
+                input.size() * sizeof(T),
+                hipMemcpyHostToDevice
+            )
+        );
+
+        thread_widened_reduce_kernel<T, length><<<grid_size, block_size>>>(device_input, device_output);
+
+        // Reading results back
+        HIP_CHECK(
+            hipMemcpy(
+                output.data(), device_output,
+                output.size() * sizeof(T),
+                hipMemcpyDeviceToHost
+            )
+        );
+
+        // Verifying results: the sum is only rounded once, max and min are exact
+        for(uint32_t i = 0; i < items; i++)
+        {
+            ASSERT_NEAR(test_utils::convert_to_fundamental(output[i * 3 + 0]),
+                        expected[i * 3 + 0],
+                        std::abs(expected[i * 3 + 0]) * 0.01f + 0.5f)
+                << "where index = " << i;
+            ASSERT_EQ(test_utils::convert_to_fundamental(output[i * 3 + 1]), expected[i * 3 + 1])
+                << "where index = " << i;
+            ASSERT_EQ(test_utils::convert_to_fundamental(output[i * 3 + 2]), expected[i * 3 + 2])
+                << "where index = " << i;
+        }
+
+        HIP_CHECK(hipFree(device_input));
+        HIP_CHECK(hipFree(device_output));
+    }
+}
+
+/// The float accumulators start from the items rather than from an identity, so a sum of
+/// -0.0 keeps its sign and Max and Min return NaN for the same inputs as a serial reduction.
+TYPED_TEST(HipcubThreadWidenedReductionTests, SignedZeroAndNaN)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                       = typename TestFixture::type;
+    constexpr int      length     = TestFixture::length;
+    constexpr uint32_t block_size = 64;
+    constexpr uint32_t items      = block_size;
+    static_assert(items >= 2 * length, "Every NaN position needs a row");
+
+    // Rows of only -0.0, then rows with one NaN, at every position of a row
+    std::vector<T> input(items * length);
+    for(uint32_t i = 0; i < items; i++)
+    {
+        for(int j = 0; j < length; j++)
+        {
+            const float value = i < length ? -0.0f : static_cast<float>(j % 5) - 2.0f;
+            input[i * length + j] = test_utils::convert_to_device<T>(value);
+        }
+        if(i >= length)
+        {
+            input[i * length + i % length]
+                = test_utils::convert_to_device<T>(std::numeric_limits<float>::quiet_NaN());
+        }
+    }
+    std::vector<T> output(items * 3);
+
+    T* device_input;
+    HIP_CHECK(hipMalloc(&device_input, input.size() * sizeof(T)));
+    T* device_output;
+    HIP_CHECK(hipMalloc(&device_output, output.size() * sizeof(T)));
+
+    HIP_CHECK(
+        hipMemcpy(
+            device_input, input.data(),
+            input.size() * sizeof(T),
+            hipMemcpyHostToDevice
+        )
+    );
+
+    thread_widened_reduce_kernel<T, length><<<1, block_size>>>(device_input, device_output);
+
+    HIP_CHECK(
+        hipMemcpy(
+            output.data(), device_output,
+            output.size() * sizeof(T),
+            hipMemcpyDeviceToHost
+        )
+    );
+
+    for(uint32_t i = 0; i < items; i++)
+    {
+        SCOPED_TRACE(testing::Message() << "where index = " << i);
+
+        // Serial reference with the same operators
+        float sum = test_utils::convert_to_fundamental(input[i * length]);
+        float max = sum;
+        float min = sum;
+        for(int j = 1; j < length; j++)
+        {
+            const float value = test_utils::convert_to_fundamental(input[i * length + j]);
+            sum = hipcub::Sum()(sum, value);
+            max = hipcub::Max()(max, value);
+            min = hipcub::Min()(min, value);
+        }
+
+        const float output_sum = test_utils::convert_to_fundamental(output[i * 3 + 0]);
+        const float output_max = test_utils::convert_to_fundamental(output[i * 3 + 1]);
+        const float output_min = test_utils::convert_to_fundamental(output[i * 3 + 2]);
+        if(i < length)
+        {
+            ASSERT_EQ(output_sum, 0.0f);
+            ASSERT_TRUE(std::signbit(output_sum));
+        }
+        ASSERT_EQ(std::isnan(output_max), std::isnan(max));
+        ASSERT_EQ(std::isnan(output_min), std::isnan(min));
+    }
+
+    HIP_CHECK(hipFree(device_input));
+    HIP_CHECK(hipFree(device_output));
+}
+
+// Summing the same float many times makes every naive addition round the same way, so the
+// error of a naive sum grows linearly while the compensated sum stays correctly rounded.
+TEST(HipcubThreadKahanSumTests, HostError)
+{
+    constexpr int   size  = 1 << 22;
+    constexpr float value = 0.1f;
+
+    float                    naive = 0.0f;
+    hipcub::KahanPair<float> compensated(0.0f);
+    for(int i = 0; i < size; i++)
+    {
+        naive += value;
+        compensated = hipcub::KahanSum()(compensated, value);
+    }
+
+    const double expected          = static_cast<double>(value) * size;
+    const double naive_error       = std::abs(naive - expected) / expected;
+    const double compensated_error = std::abs(static_cast<float>(compensated) - expected) / expected;
+    SCOPED_TRACE(testing::Message() << "naive relative error = " << naive_error
+                                    << ", compensated relative error = " << compensated_error);
+
+    ASSERT_GT(naive_error, 1e-3);
+    ASSERT_LE(compensated_error, std::numeric_limits<float>::epsilon() / 2);
+}
+
+// TwoSum of an infinite sum is NaN, KahanSum must propagate infinities and NaNs like a
+// plain sum instead.
+TEST(HipcubThreadKahanSumTests, HostNonFinite)
+{
+    const float inf = std::numeric_limits<float>::infinity();
+    const float max = std::numeric_limits<float>::max();
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+
+    struct test_case
+    {
+        float a;
+        float b;
+    };
+    const std::vector<test_case> cases = {
+        {1.0f, inf},
+        {inf, 1.0f},
+        {-inf, 1.0f},
+        {inf, inf},
+        {max, max},
+        {-max, -max},
+        {inf, -inf},
+        {nan, 1.0f},
+        {1.0f, nan}
+    };
+    for(const test_case& c : cases)
+    {
+        SCOPED_TRACE(testing::Message() << "with a = " << c.a << ", b = " << c.b);
+        const float expected = c.a + c.b;
+
+        const hipcub::KahanPair<float> pair = hipcub::KahanSum()(c.a, c.b);
+        ASSERT_EQ(pair.compensation, 0.0f);
+        if(std::isnan(expected))
+        {
+            ASSERT_TRUE(std::isnan(pair.sum));
+            ASSERT_TRUE(std::isnan(static_cast<float>(pair)));
+        }
+        else
+        {
+            ASSERT_EQ(pair.sum, expected);
+            ASSERT_EQ(static_cast<float>(pair), expected);
+        }
+
+        // Finite values added to an infinite sum keep it infinite
+        const hipcub::KahanPair<float> more = hipcub::KahanSum()(pair, 0.1f);
+        if(std::isinf(expected))
+        {
+            ASSERT_EQ(static_cast<float>(more), expected);
+        }
+    }
+}
+
+template<int Length>
+__global__
+void thread_kahan_reduce_kernel(float* const device_input, float* device_output)
+{
+    const size_t index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    float input[Length];
+    for(int i = 0; i < Length; i++)
+    {
+        input[i] = device_input[index * Length + i];
+    }
+
+    device_output[index] = hipcub::internal::ThreadReduce(input, hipcub::KahanSum());
+}
+
+TEST(HipcubThreadKahanSumTests, Reduction)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    constexpr int      length     = 33;
+    constexpr uint32_t block_size = 64;
+    constexpr uint32_t grid_size  = 32;
+    constexpr uint32_t items      = block_size * grid_size;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        // Values of very different magnitudes, so that a naive float sum loses the small ones
+        std::vector<float> input = test_utils::get_random_data<float>(items * length, 0.0f, 1.0f, seed_value);
+        for(uint32_t i = 0; i < items; i++)
+        {
+            input[i * length] *= 1e7f;
+        }
+        std::vector<float> output(items);
+
+        // Calculate expected results on host, in double
+        std::vector<double> expected(items);
+        for(uint32_t i = 0; i < items; i++)
+        {
+            expected[i] = std::accumulate(input.begin() + i * length,
+                                          input.begin() + (i + 1) * length,
+                                          0.0);
+        }
+
+        float* device_input;
+        HIP_CHECK(hipMalloc(&device_input, input.size() * sizeof(float)));
+        float* device_output;
+        HIP_CHECK(hipMalloc(&device_output, output.size() * sizeof(float)));
+
+        HIP_CHECK(
+            hipMemcpy(
+                device_input, input.data(),
+                input.size() * sizeof(float),
+                hipMemcpyHostToDevice
+            )
+        );
+
+        thread_kahan_reduce_kernel<length><<<grid_size, block_size>>>(device_input, device_output);
+
+        HIP_CHECK(
+            hipMemcpy(
+                output.data(), device_output,
+                output.size() * sizeof(float),
+                hipMemcpyDeviceToHost
+            )
+        );
+
+        // The compensated sum is within an ulp of the exact sum
+        for(uint32_t i = 0; i < items; i++)
+        {
+            ASSERT_NEAR(output[i], expected[i], std::abs(expected[i]) * std::numeric_limits<float>::epsilon())
+                << "where index = " << i;
+        }
+
+        HIP_CHECK(hipFree(device_input));
+        HIP_CHECK(hipFree(device_output));
+    }
+}
+
+#endif // HIPCUB_ROCPRIM_API
+
 template<class Type, int32_t Length>
 __global__
 void thread_scan_kernel(Type* const device_input, Type* device_output)
@@ -0,0 +1,153 @@
+// MIT License
+//
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Tracing has to be enabled before any hipCUB header is included
+#define HIPCUB_ENABLE_TRACING
+
+#include "common_test_header.hpp"
+
+// hipcub API
+#include "hipcub/device/device_reduce.hpp"
+#include "hipcub/device/device_scan.hpp"
+#include "hipcub/util_trace.hpp"
+
+#include <string>
+
+namespace
+{
+
+int range_depth = 0;
+int range_count = 0;
+
+int push_range(const char* message)
+{
+    EXPECT_STREQ(message, "DeviceReduce::Sum");
+    range_count++;
+    return range_depth++;
+}
+
+int pop_range()
+{
+    return --range_depth;
+}
+
+} // namespace
+
+TEST(HipcubTraceTests, RingBuffer)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T           = int;
+    const size_t size = 12345;
+
+    T* d_input;
+    T* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+    HIP_CHECK(hipMemset(d_input, 0, size * sizeof(T)));
+
+    hipcub::TraceRingBuffer ring_buffer(2);
+    hipcub::SetTraceCallbacks(ring_buffer.Callbacks());
+
+    size_t temp_storage_bytes = 0;
+    void*  d_temp_storage     = nullptr;
+    HIP_CHECK(hipcub::DeviceReduce::Sum(d_temp_storage,
+                                        temp_storage_bytes,
+                                        d_input,
+                                        d_output,
+                                        size));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_bytes));
+    HIP_CHECK(hipcub::DeviceReduce::Sum(d_temp_storage,
+                                        temp_storage_bytes,
+                                        d_input,
+                                        d_output,
+                                        size));
+    HIP_CHECK(hipFree(d_temp_storage));
+
+    // DeviceScan::ExclusiveSum calls DeviceScan::ExclusiveScan, only the outer call is reported
+    temp_storage_bytes = 0;
+    d_temp_storage     = nullptr;
+    HIP_CHECK(hipcub::DeviceScan::ExclusiveSum(d_temp_storage,
+                                               temp_storage_bytes,
+                                               d_input,
+                                               d_output,
+                                               size));
+
+    hipcub::SetTraceCallbacks(nullptr);
+
+    // Not recorded anymore
+    HIP_CHECK(hipcub::DeviceScan::ExclusiveSum(d_temp_storage,
+                                               temp_storage_bytes,
+                                               d_input,
+                                               d_output,
+                                               size));
+
+    ASSERT_EQ(ring_buffer.Count(), 3U);
+    const std::vector<hipcub::TraceEvent> events = ring_buffer.Events();
+    ASSERT_EQ(events.size(), 2U);
+
+    ASSERT_STREQ(events[0].algorithm, "DeviceReduce::Sum");
+    ASSERT_FALSE(events[0].size_query);
+    ASSERT_EQ(events[0].num_items, size);
+    ASSERT_GT(events[0].temp_storage_bytes, 0U);
+    ASSERT_GE(events[0].host_duration, 0.0);
+    ASSERT_NE(std::string(events[0].signature).find("Sum"), std::string::npos);
+
+    ASSERT_STREQ(events[1].algorithm, "DeviceScan::ExclusiveSum");
+    ASSERT_TRUE(events[1].size_query);
+    ASSERT_EQ(events[1].temp_storage_bytes, temp_storage_bytes);
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
+
+TEST(HipcubTraceTests, RangeAdapter)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T           = float;
+    const size_t size = 1024;
+
+    T* d_input;
+    T* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(T)));
+
+    hipcub::TraceRangeAdapter adapter(push_range, pop_range);
+    hipcub::SetTraceCallbacks(adapter.Callbacks());
+
+    size_t temp_storage_bytes = 0;
+    HIP_CHECK(
+        hipcub::DeviceReduce::Sum(nullptr, temp_storage_bytes, d_input, d_output, size));
+
+    hipcub::SetTraceCallbacks(nullptr);
+
+    ASSERT_EQ(range_count, 1);
+    ASSERT_EQ(range_depth, 0);
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
@@ -0,0 +1,267 @@
+// MIT License
+//
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "common_test_header.hpp"
+
+// hipcub API
+#include "hipcub/device/device_radix_sort.hpp"
+#include "hipcub/device/device_reduce.hpp"
+#include "hipcub/device/device_scan.hpp"
+
+#ifdef HIPCUB_ROCPRIM_API
+
+#include <type_traits>
+
+namespace
+{
+
+using hipcub::detail::tuned_algorithm;
+using hipcub::detail::tuned_arch;
+using hipcub::detail::tuned_size_class;
+using rocprim::detail::target_arch;
+
+using small_reduce_config
+    = rocprim::reduce_config<256, 4, rocprim::block_reduce_algorithm::using_warp_reduce>;
+
+// Entries for a key size no real type uses, so that the lookup can be tested without
+// changing the dispatch of any other test
+constexpr size_t test_key_size = 3;
+
+} // namespace
+
+BEGIN_HIPCUB_NAMESPACE
+namespace detail
+{
+
+#define HIPCUB_TEST_TUNED_REDUCE_CONFIG(arch) \
+    HIPCUB_DETAIL_TUNED_CONFIG(reduce, arch, test_key_size, 0, small, small_reduce_config)
+
+HIPCUB_TEST_TUNED_REDUCE_CONFIG(gfx906)
+HIPCUB_TEST_TUNED_REDUCE_CONFIG(gfx908)
+HIPCUB_TEST_TUNED_REDUCE_CONFIG(gfx90a)
+HIPCUB_TEST_TUNED_REDUCE_CONFIG(gfx1030)
+HIPCUB_TEST_TUNED_REDUCE_CONFIG(gfx942)
+HIPCUB_TEST_TUNED_REDUCE_CONFIG(gfx1100)
+
+#undef HIPCUB_TEST_TUNED_REDUCE_CONFIG
+
+} // namespace detail
+END_HIPCUB_NAMESPACE
+
+namespace
+{
+
+// Returns the index of the resolved configuration in Configs..., or -1
+template<class... Configs>
+struct resolve_index;
+
+template<>
+struct resolve_index<>
+{
+    template<class Config>
+    static int get()
+    {
+        return -1;
+    }
+};
+
+template<class First, class... Rest>
+struct resolve_index<First, Rest...>
+{
+    template<class Config>
+    static int get()
+    {
+        if(std::is_same<Config, First>::value)
+        {
+            return 0;
+        }
+        const int index = resolve_index<Rest...>::template get<Config>();
+        return index < 0 ? index : index + 1;
+    }
+};
+
+template<tuned_algorithm Algorithm, size_t KeySize, size_t ValueSize, class... Configs>
+int resolve(target_arch arch, size_t num_items)
+{
+    int index = -2;
+    HIP_CHECK((hipcub::detail::dispatch_tuned_config_for_arch<Algorithm, KeySize, ValueSize>(
+        arch,
+        num_items,
+        [&](auto config_tag)
+        {
+            using config = typename decltype(config_tag)::type;
+            index        = resolve_index<Configs...>::template get<config>();
+            return hipSuccess;
+        })));
+    return index;
+}
+
+} // namespace
+
+TEST(HipcubTunedConfigTests, SizeClass)
+{
+    static_assert(hipcub::detail::get_tuned_size_class(0) == tuned_size_class::small, "");
+    static_assert(hipcub::detail::get_tuned_size_class(1 << 16) == tuned_size_class::small, "");
+    static_assert(hipcub::detail::get_tuned_size_class((1 << 16) + 1) == tuned_size_class::medium,
+                  "");
+    static_assert(hipcub::detail::get_tuned_size_class(1 << 22) == tuned_size_class::medium, "");
+    static_assert(hipcub::detail::get_tuned_size_class((1 << 22) + 1) == tuned_size_class::large,
+                  "");
+}
+
+TEST(HipcubTunedConfigTests, ReduceLookup)
+{
+    // Targets are passed with the value rocPRIM reports for them, also targets that the
+    // installed rocPRIM does not have an enumerator for
+    for(target_arch arch : {target_arch::gfx906,
+                            target_arch::gfx908,
+                            target_arch::gfx90a,
+                            target_arch::gfx1030,
+                            static_cast<target_arch>(tuned_arch::gfx942),
+                            static_cast<target_arch>(tuned_arch::gfx1100)})
+    {
+        SCOPED_TRACE(testing::Message() << "with arch = " << static_cast<unsigned int>(arch));
+        auto lookup = [&](size_t num_items)
+        {
+            return resolve<tuned_algorithm::reduce,
+                           test_key_size,
+                           0,
+                           small_reduce_config,
+                           rocprim::default_config>(arch, num_items);
+        };
+        ASSERT_EQ(lookup(1000), 0);
+        ASSERT_EQ(lookup(1 << 20), 1);
+        ASSERT_EQ(lookup(1 << 24), 1);
+    }
+
+    // Targets without entries and unknown targets use the defaults of rocPRIM
+    for(target_arch arch : {target_arch::gfx803,
+                            target_arch::gfx900,
+                            static_cast<target_arch>(tuned_arch::gfx1101),
+                            target_arch::unknown})
+    {
+        SCOPED_TRACE(testing::Message() << "with arch = " << static_cast<unsigned int>(arch));
+        ASSERT_EQ((resolve<tuned_algorithm::reduce,
+                           test_key_size,
+                           0,
+                           small_reduce_config,
+                           rocprim::default_config>(arch, 1000)),
+                  1);
+    }
+
+    // Types without entries use the defaults of rocPRIM
+    ASSERT_EQ((resolve<tuned_algorithm::reduce, 2, 0, small_reduce_config, rocprim::default_config>(
+                  target_arch::gfx90a,
+                  1000)),
+              1);
+}
+
+TEST(HipcubTunedConfigTests, ShippedDatabaseIsEmpty)
+{
+    // No entry is shipped without measurements, so every real type uses the rocPRIM defaults
+    static_assert(
+        std::is_same<hipcub::detail::tuned_config<tuned_algorithm::reduce,
+                                                  tuned_arch::gfx90a,
+                                                  4,
+                                                  0,
+                                                  tuned_size_class::small>::type,
+                     rocprim::default_config>::value,
+        "");
+    static_assert(
+        std::is_same<hipcub::detail::tuned_config<tuned_algorithm::scan,
+                                                  tuned_arch::gfx1030,
+                                                  4,
+                                                  0,
+                                                  tuned_size_class::small>::type,
+                     rocprim::default_config>::value,
+        "");
+    static_assert(
+        std::is_same<hipcub::detail::tuned_config<tuned_algorithm::radix_sort,
+                                                  tuned_arch::gfx908,
+                                                  4,
+                                                  0,
+                                                  tuned_size_class::medium>::type,
+                     rocprim::default_config>::value,
+        "");
+    static_assert(
+        std::is_same<hipcub::detail::tuned_config<tuned_algorithm::reduce,
+                                                  tuned_arch::gfx803,
+                                                  test_key_size,
+                                                  0,
+                                                  tuned_size_class::small>::type,
+                     rocprim::default_config>::value,
+        "");
+}
+
+TEST(HipcubTunedConfigTests, ArgReduceKeySize)
+{
+    // ArgMin and ArgMax look up the entry of their value type, not of the pair
+    static_assert(
+        hipcub::detail::tuned_reduce_key_size<hipcub::KeyValuePair<int, float>>::value
+            == sizeof(float),
+        "");
+    static_assert(
+        hipcub::detail::tuned_reduce_key_size<hipcub::KeyValuePair<int, double>>::value
+            == sizeof(double),
+        "");
+    static_assert(hipcub::detail::tuned_reduce_key_size<short>::value == sizeof(short), "");
+}
+
+TEST(HipcubTunedConfigTests, DatabaseIsOptIn)
+{
+    // HIPCUB_ENABLE_TUNED_CONFIG is not defined, so the default config is kept even where
+    // the database has an entry
+    int index = -2;
+    HIP_CHECK((hipcub::detail::dispatch_tuned_config<rocprim::default_config,
+                                                     tuned_algorithm::reduce,
+                                                     test_key_size,
+                                                     0>(
+        1000,
+        hipStream_t(0),
+        [&](auto config_tag)
+        {
+            using config = typename decltype(config_tag)::type;
+            index        = resolve_index<rocprim::default_config>::template get<config>();
+            return hipSuccess;
+        })));
+    ASSERT_EQ(index, 0);
+}
+
+TEST(HipcubTunedConfigTests, ExplicitConfigIsKept)
+{
+    int index = -2;
+    HIP_CHECK((hipcub::detail::dispatch_tuned_config<small_reduce_config,
+                                                     tuned_algorithm::reduce,
+                                                     sizeof(int),
+                                                     0>(
+        size_t(1) << 24,
+        hipStream_t(0),
+        [&](auto config_tag)
+        {
+            using config = typename decltype(config_tag)::type;
+            index        = resolve_index<small_reduce_config>::template get<config>();
+            return hipSuccess;
+        })));
+    ASSERT_EQ(index, 0);
+}
+
+#endif // HIPCUB_ROCPRIM_API
@@ -0,0 +1,148 @@
+// MIT License
+//
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "common_test_header.hpp"
+
+// hipcub API
+#include "hipcub/util_type.hpp"
+#ifdef HIPCUB_ROCPRIM_API
+    #include "hipcub/util_radix_key_traits.hpp"
+#endif
+
+#include <cstring>
+#include <vector>
+
+#ifdef HIPCUB_IS_INT128_ENABLED
+
+template<class T>
+class HipcubNumericTraitsInt128Tests : public ::testing::Test
+{
+public:
+    using type = T;
+};
+
+using Int128Types = ::testing::Types<__int128_t, __uint128_t>;
+TYPED_TEST_SUITE(HipcubNumericTraitsInt128Tests, Int128Types);
+
+template<class T>
+std::vector<T> int128_test_values()
+{
+    // Strictly ascending, covering both 64-bit halves and the sign bit. Lowest() is 0 for
+    // __uint128_t.
+    const __uint128_t high = static_cast<__uint128_t>(1) << 64;
+    std::vector<T>    values;
+    values.push_back(hipcub::NumericTraits<T>::Lowest());
+    if(std::is_same<T, __int128_t>::value)
+    {
+        values.push_back(static_cast<T>(-(high * 3)));
+        values.push_back(static_cast<T>(-high));
+        values.push_back(static_cast<T>(-high + 1));
+        values.push_back(static_cast<T>(-2));
+        values.push_back(static_cast<T>(-1));
+        values.push_back(static_cast<T>(0));
+    }
+    values.push_back(static_cast<T>(1));
+    values.push_back(static_cast<T>(high - 1));
+    values.push_back(static_cast<T>(high));
+    values.push_back(static_cast<T>(high + 1));
+    values.push_back(static_cast<T>(high * 5 + 7));
+    values.push_back(hipcub::NumericTraits<T>::Max());
+    return values;
+}
+
+TYPED_TEST(HipcubNumericTraitsInt128Tests, TwiddleRoundTrip)
+{
+    using T            = typename TestFixture::type;
+    using traits       = hipcub::NumericTraits<T>;
+    using UnsignedBits = typename traits::UnsignedBits;
+
+    static_assert(sizeof(UnsignedBits) == sizeof(T), "UnsignedBits must be 128 bits wide");
+
+    const std::vector<T> values = int128_test_values<T>();
+    for(size_t i = 0; i < values.size(); i++)
+    {
+        // The standard streams cannot print 128-bit integers, report the index instead
+        SCOPED_TRACE(testing::Message() << "with value index = " << i);
+        const T      value = values[i];
+        UnsignedBits bits;
+        std::memcpy(&bits, &value, sizeof(T));
+        const UnsignedBits out = traits::TwiddleOut(traits::TwiddleIn(bits));
+        T                  result;
+        std::memcpy(&result, &out, sizeof(T));
+        ASSERT_TRUE(result == value);
+    }
+}
+
+TYPED_TEST(HipcubNumericTraitsInt128Tests, TwiddlePreservesOrder)
+{
+    using T            = typename TestFixture::type;
+    using traits       = hipcub::NumericTraits<T>;
+    using UnsignedBits = typename traits::UnsignedBits;
+
+    const std::vector<T> values = int128_test_values<T>();
+
+    std::vector<UnsignedBits> twiddled;
+    for(const T value : values)
+    {
+        UnsignedBits bits;
+        std::memcpy(&bits, &value, sizeof(T));
+        twiddled.push_back(traits::TwiddleIn(bits));
+    }
+
+    // Lowest and Max map to the ends of the unsigned range
+    ASSERT_TRUE(twiddled.front() == UnsignedBits(0));
+    ASSERT_TRUE(twiddled.back() == UnsignedBits(-1));
+    for(size_t i = 1; i < twiddled.size(); i++)
+    {
+        SCOPED_TRACE(testing::Message() << "with value index = " << i);
+        ASSERT_TRUE(values[i - 1] < values[i]);
+        ASSERT_TRUE(twiddled[i - 1] < twiddled[i]);
+    }
+}
+
+#endif // HIPCUB_IS_INT128_ENABLED
+
+#ifdef HIPCUB_ROCPRIM_API
+
+TEST(HipcubRadixKeyFieldsTests, TwiddleRoundTrip)
+{
+    using key_type = test_utils::custom_radix_key;
+    using traits   = hipcub::RadixSortKeyTraits<key_type>;
+
+    // RadixKeyFields only accepts field lists that cover the whole key
+    static_assert(traits::BITS == sizeof(key_type) * 8, "The fields must cover the key");
+
+    const std::vector<key_type> keys = {
+        {2.5f, 7},
+        {-0.0f, 1},
+        {0.0f, -3},
+        {-1.0e30f, 42}
+    };
+    for(size_t i = 0; i < keys.size(); i++)
+    {
+        SCOPED_TRACE(testing::Message() << "with key = " << keys[i]);
+        const key_type result = traits::TwiddleOut(traits::TwiddleIn(keys[i]));
+        ASSERT_EQ(std::memcmp(&result, &keys[i], sizeof(key_type)), 0);
+    }
+}
+
+#endif // HIPCUB_ROCPRIM_API
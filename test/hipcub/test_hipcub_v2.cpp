@@ -0,0 +1,137 @@
+// MIT License
+//
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "common_test_header.hpp"
+
+// hipcub API
+#include "hipcub/v2.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+TEST(HipcubV2Tests, RadixSortKeysReusesStorage)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type    = unsigned int;
+    const size_t size = 100000;
+
+    std::vector<key_type> keys(size);
+    for(size_t i = 0; i < size; i++)
+    {
+        keys[i] = static_cast<key_type>((i * 2654435761u) % 1000003u);
+    }
+    std::vector<key_type> expected(keys);
+    std::sort(expected.begin(), expected.end());
+
+    key_type* d_keys_in;
+    key_type* d_keys_out;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_in, size * sizeof(key_type)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_out, size * sizeof(key_type)));
+    HIP_CHECK(
+        hipMemcpy(d_keys_in, keys.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+
+    hipStream_t stream = 0;
+    auto        sort   = hipcub::v2::radix_sort_keys<key_type>::create(size, stream);
+    HIP_CHECK(sort.error());
+    ASSERT_GT(sort->storage_bytes(), 0u);
+
+    // Temporary storage passed as a span
+    unsigned char* d_temp_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, sort->storage_bytes()));
+    const hipcub::v2::span<unsigned char> temp_storage(d_temp_storage, sort->storage_bytes());
+    for(int i = 0; i < 2; i++)
+    {
+        HIP_CHECK((*sort)(temp_storage, stream, d_keys_in, d_keys_out).error());
+    }
+
+    std::vector<key_type> output(size);
+    HIP_CHECK(
+        hipMemcpy(output.data(), d_keys_out, size * sizeof(key_type), hipMemcpyDeviceToHost));
+    ASSERT_EQ(output, expected);
+
+    // Too small temporary storage is rejected before launching
+    const hipcub::v2::span<unsigned char> small_storage(d_temp_storage,
+                                                        sort->storage_bytes() - 1);
+    ASSERT_EQ((*sort)(small_storage, stream, d_keys_in, d_keys_out).error(),
+              hipErrorInvalidValue);
+
+    // Temporary storage allocated from a caching allocator
+    HIP_CHECK(hipMemset(d_keys_out, 0, size * sizeof(key_type)));
+    hipcub::CachingDeviceAllocator caching_device_allocator;
+    hipcub::v2::caching_allocator  allocator(caching_device_allocator);
+    HIP_CHECK((*sort)(allocator, stream, d_keys_in, d_keys_out).error());
+    HIP_CHECK(hipStreamSynchronize(stream));
+    HIP_CHECK(
+        hipMemcpy(output.data(), d_keys_out, size * sizeof(key_type), hipMemcpyDeviceToHost));
+    ASSERT_EQ(output, expected);
+
+    HIP_CHECK(hipFree(d_keys_in));
+    HIP_CHECK(hipFree(d_keys_out));
+    HIP_CHECK(hipFree(d_temp_storage));
+}
+
+TEST(HipcubV2Tests, ReduceAndScanWithDeviceAllocator)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T        = int;
+    const int size = 4321;
+
+    std::vector<T> input(size);
+    for(int i = 0; i < size; i++)
+    {
+        input[i] = i % 13;
+    }
+    std::vector<T> expected(size);
+    std::partial_sum(input.begin(), input.end(), expected.begin());
+
+    T* d_input;
+    T* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+    hipcub::v2::device_allocator allocator;
+
+    auto sum = hipcub::v2::reduce_sum<T>::create(size);
+    HIP_CHECK(sum.error());
+    HIP_CHECK((*sum)(allocator, hipStream_t(0), d_input, d_output).error());
+    T result;
+    HIP_CHECK(hipMemcpy(&result, d_output, sizeof(T), hipMemcpyDeviceToHost));
+    ASSERT_EQ(result, expected.back());
+
+    auto scan = hipcub::v2::inclusive_sum<T>::create(size);
+    HIP_CHECK(scan.error());
+    HIP_CHECK((*scan)(allocator, hipStream_t(0), d_input, d_output).error());
+    std::vector<T> output(size);
+    HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+    ASSERT_EQ(output, expected);
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
@@ -39,6 +39,7 @@
 #include "test_utils_custom_test_types.hpp"
 #include "test_utils_data_generation.hpp"
 #include "test_utils_assertions.hpp"
+#include "test_utils_host_reference.hpp"
 
 // Seed values
 #include "test_seed.hpp"
@@ -29,6 +29,7 @@
 #include "test_utils_half.hpp"
 #include "test_utils_bfloat16.hpp"
 #include "test_utils_custom_test_types.hpp"
+#include "test_utils_host_buffer.hpp"
 
 namespace test_utils{
 
@@ -44,33 +45,52 @@ bool inline bit_equal(const T a, const T b){
 /// \param result
 /// \param expected
 /// \param max_length
-template<class T>
-inline void assert_eq(const std::vector<T>& result, const std::vector<T>& expected, const size_t max_length = SIZE_MAX)
+/// The elements are compared in parallel (see find_first_mismatch()), only the first mismatch
+/// is reported.
+template<class T, class Allocator>
+inline void assert_eq(const std::vector<T, Allocator>& result, const std::vector<T, Allocator>& expected, const size_t max_length = SIZE_MAX)
 {
     if(max_length == SIZE_MAX || max_length > expected.size()) ASSERT_EQ(result.size(), expected.size());
-    for(size_t i = 0; i < std::min(result.size(), max_length); i++)
+    const size_t length = std::min(result.size(), max_length);
+    // Check to also regard equality of NaN's, -NaN, +inf, -inf as correct.
+    const size_t i = find_first_mismatch(length, [&](size_t j)
+                                         { return bit_equal(result[j], expected[j]) || result[j] == expected[j]; });
+    if(i != length)
     {
-        if(bit_equal(result[i], expected[i])) continue; // Check to also regard equality of NaN's, -NaN, +inf, -inf as correct.
         ASSERT_EQ(result[i], expected[i]) << "where index = " << i;
     }
 }
 
-inline void assert_eq(const std::vector<test_utils::half>& result, const std::vector<test_utils::half>& expected, const size_t max_length = SIZE_MAX)
+template<class Allocator>
+inline void assert_eq(const std::vector<test_utils::half, Allocator>& result, const std::vector<test_utils::half, Allocator>& expected, const size_t max_length = SIZE_MAX)
 {
     if(max_length == SIZE_MAX || max_length > expected.size()) ASSERT_EQ(result.size(), expected.size());
-    for(size_t i = 0; i < std::min(result.size(), max_length); i++)
+    const size_t length = std::min(result.size(), max_length);
+    // Check to also regard equality of NaN's, -NaN, +inf, -inf as correct.
+    const size_t i = find_first_mismatch(length, [&](size_t j)
+                                         {
+                                             return bit_equal(result[j], expected[j])
+                                                    || test_utils::native_half(result[j]) == test_utils::native_half(expected[j]);
+                                         });
+    if(i != length)
     {
-        if(bit_equal(result[i], expected[i])) continue; // Check to also regard equality of NaN's, -NaN, +inf, -inf as correct.
         ASSERT_EQ(test_utils::native_half(result[i]), test_utils::native_half(expected[i])) << "where index = " << i;
     }
 }
 
-inline void assert_eq(const std::vector<test_utils::bfloat16>& result, const std::vector<test_utils::bfloat16>& expected, const size_t max_length = SIZE_MAX)
+template<class Allocator>
+inline void assert_eq(const std::vector<test_utils::bfloat16, Allocator>& result, const std::vector<test_utils::bfloat16, Allocator>& expected, const size_t max_length = SIZE_MAX)
 {
     if(max_length == SIZE_MAX || max_length > expected.size()) ASSERT_EQ(result.size(), expected.size());
-    for(size_t i = 0; i < std::min(result.size(), max_length); i++)
+    const size_t length = std::min(result.size(), max_length);
+    // Check to also regard equality of NaN's, -NaN, +inf, -inf as correct.
+    const size_t i = find_first_mismatch(length, [&](size_t j)
+                                         {
+                                             return bit_equal(result[j], expected[j])
+                                                    || test_utils::native_bfloat16(result[j]) == test_utils::native_bfloat16(expected[j]);
+                                         });
+    if(i != length)
     {
-        if(bit_equal(result[i], expected[i])) continue; // Check to also regard equality of NaN's, -NaN, +inf, -inf as correct.
         ASSERT_EQ(test_utils::native_bfloat16(result[i]), test_utils::native_bfloat16(expected[i])) << "where index = " << i;
     }
 }
@@ -111,7 +131,7 @@ inline auto assert_near(const std::vector<T>& result, const std::vector<T>& expe
 
 template<class T>
 inline auto assert_near(const std::vector<T>& result, const std::vector<T>& expected, const float percent)
-    -> typename std::enable_if<std::is_integral<T>::value>::type
+    -> typename std::enable_if<test_utils::is_integral<T>::value>::type
 {
     (void)percent;
     ASSERT_EQ(result.size(), expected.size());
@@ -188,13 +208,14 @@ inline auto assert_near(const T& result, const T& expected, const float percent)
 
 template<class T>
 inline auto assert_near(const T& result, const T& expected, const float)
-    -> typename std::enable_if<std::is_integral<T>::value>::type
+    -> typename std::enable_if<test_utils::is_integral<T>::value>::type
 {
     ASSERT_EQ(result, expected);
 }
 
 template<class T, std::enable_if_t<std::is_same<T, test_utils::bfloat16>::value ||
-                                       std::is_same<T, test_utils::half>::value, bool> = true>
+                                       std::is_same<T, test_utils::half>::value ||
+                                       test_utils::is_fp8<T>::value, bool> = true>
 inline void assert_near(const T& result, const T& expected, const float percent)
 {
     if(bit_equal(result, expected)) return; // Check to also regard equality of NaN's, -NaN, +inf, -inf as correct.
@@ -222,19 +243,18 @@ inline auto assert_near(const custom_test_type<T>& result, const custom_test_typ
 
 // End assert_near
 
-template<class T>
-inline void assert_bit_eq(const std::vector<T>& result, const std::vector<T>& expected)
+template<class T, class Allocator>
+inline void assert_bit_eq(const std::vector<T, Allocator>& result, const std::vector<T, Allocator>& expected)
 {
     ASSERT_EQ(result.size(), expected.size());
-    for(size_t i = 0; i < result.size(); i++)
+    const size_t i = find_first_mismatch(result.size(), [&](size_t j)
+                                         { return bit_equal(result[j], expected[j]); });
+    if(i != result.size())
     {
-        if(!bit_equal(result[i], expected[i]))
-        {
-            FAIL() << "Expected strict/bitwise equality of these values: " << std::endl
-                   << "     result[i]: " << result[i] << std::endl
-                   << "     expected[i]: " << expected[i] << std::endl
-                   << "where index = " << i;
-        }
+        FAIL() << "Expected strict/bitwise equality of these values: " << std::endl
+               << "     result[i]: " << result[i] << std::endl
+               << "     expected[i]: " << expected[i] << std::endl
+               << "where index = " << i;
     }
 }
 
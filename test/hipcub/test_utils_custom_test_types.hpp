@@ -26,6 +26,14 @@
 #include "test_utils_half.hpp"
 #include "test_utils_bfloat16.hpp"
 
+#include <ostream>
+#include <type_traits>
+
+#ifdef HIPCUB_ROCPRIM_API
+    #include "hipcub/util_fp8.hpp"
+    #include "hipcub/util_radix_key_traits.hpp"
+#endif
+
 namespace test_utils {
 
 template<class T>
@@ -276,5 +284,90 @@ struct inner_type<custom_test_type<T>> {
     using type = T;
 };
 
+// 128-bit integers are not std::is_integral in strict ISO mode
+template<class T>
+struct is_int128 : std::false_type
+{};
+
+#ifdef HIPCUB_IS_INT128_ENABLED
+template<>
+struct is_int128<__int128_t> : std::true_type
+{};
+
+template<>
+struct is_int128<__uint128_t> : std::true_type
+{};
+
+/// Prints 128-bit integers in decimal, the standard streams only know up to 64 bits.
+inline std::ostream& operator<<(std::ostream& os, __uint128_t value)
+{
+    char  buffer[40];
+    char* p = buffer + sizeof(buffer);
+    *--p    = '\0';
+    do
+    {
+        *--p = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+    while(value != 0);
+    return os << p;
+}
+
+inline std::ostream& operator<<(std::ostream& os, __int128_t value)
+{
+    if(value < 0)
+    {
+        return os << '-' << (~static_cast<__uint128_t>(value) + 1);
+    }
+    return os << static_cast<__uint128_t>(value);
+}
+#endif
+
+// is_integral which supports custom_test_type<U> classes
+template<class T>
+struct is_integral : std::integral_constant<bool, std::is_integral<T>::value || is_int128<T>::value>
+{};
+
+#ifdef HIPCUB_ROCPRIM_API
+// Radix sort key with a RadixSortKeyTraits specialization: highest score first, then lowest id
+struct custom_radix_key
+{
+    float score;
+    int   id;
+};
+
+struct custom_radix_key_less
+{
+    bool operator()(const custom_radix_key& lhs, const custom_radix_key& rhs) const
+    {
+        return lhs.score > rhs.score || (lhs.score == rhs.score && lhs.id < rhs.id);
+    }
+};
+
+inline bool operator==(const custom_radix_key& lhs, const custom_radix_key& rhs)
+{
+    return lhs.score == rhs.score && lhs.id == rhs.id;
+}
+
+inline std::ostream& operator<<(std::ostream& stream, const custom_radix_key& value)
+{
+    stream << "[" << value.score << "; " << value.id << "]";
+    return stream;
+}
+#endif // HIPCUB_ROCPRIM_API
+
 } // end of test_utils namespace
+
+#ifdef HIPCUB_ROCPRIM_API
+BEGIN_HIPCUB_NAMESPACE
+template<>
+struct RadixSortKeyTraits<test_utils::custom_radix_key>
+    : RadixKeyFields<
+          test_utils::custom_radix_key,
+          RadixKeyField<test_utils::custom_radix_key, float, &test_utils::custom_radix_key::score, true>,
+          RadixKeyField<test_utils::custom_radix_key, int, &test_utils::custom_radix_key::id>>
+{};
+END_HIPCUB_NAMESPACE
+#endif // HIPCUB_ROCPRIM_API
+
 #endif  // HIPCUB_TEST_HIPCUB_TEST_UTILS_CUSTOM_TEST_TYPES_HPP_
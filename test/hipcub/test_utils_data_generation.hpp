@@ -25,12 +25,18 @@
 
 // Std::memcpy and std::memcmp
 #include <cstring>
+#include <ostream>
 
+#include <algorithm>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 #include "test_utils_half.hpp"
 #include "test_utils_bfloat16.hpp"
 #include "test_utils_custom_test_types.hpp"
+#include "test_utils_host_buffer.hpp"
+#include "test_utils_random.hpp"
 
 namespace test_utils
 {
@@ -121,6 +127,126 @@ public:
         return -std::numeric_limits<float>::infinity();
     };
 };
+
+#ifdef HIPCUB_ROCPRIM_API
+template<>
+struct numeric_limits<hipcub::fp8_e4m3> : public std::numeric_limits<hipcub::fp8_e4m3>
+{
+    using T = hipcub::fp8_e4m3;
+
+    static constexpr bool is_specialized = true;
+    static constexpr bool has_infinity   = false;
+    static constexpr bool has_quiet_NaN  = true;
+
+    static inline T min()
+    {
+        return T::from_bits(0x08);
+    }
+    static inline T max()
+    {
+        return T::from_bits(0x7e);
+    }
+    static inline T lowest()
+    {
+        return T::from_bits(0xfe);
+    }
+    // E4M3 has no infinity, conversions saturate to the largest finite value.
+    static inline T infinity()
+    {
+        return max();
+    }
+    static inline T quiet_NaN()
+    {
+        return T::from_bits(0x7f);
+    }
+};
+
+template<>
+struct numeric_limits<hipcub::fp8_e5m2> : public std::numeric_limits<hipcub::fp8_e5m2>
+{
+    using T = hipcub::fp8_e5m2;
+
+    static constexpr bool is_specialized = true;
+    static constexpr bool has_infinity   = true;
+    static constexpr bool has_quiet_NaN  = true;
+
+    static inline T min()
+    {
+        return T::from_bits(0x04);
+    }
+    static inline T max()
+    {
+        return T::from_bits(0x7b);
+    }
+    static inline T lowest()
+    {
+        return T::from_bits(0xfb);
+    }
+    static inline T infinity()
+    {
+        return T::from_bits(0x7c);
+    }
+    static inline T infinity_neg()
+    {
+        return T::from_bits(0xfc);
+    }
+    static inline T quiet_NaN()
+    {
+        return T::from_bits(0x7e);
+    }
+};
+#endif
+
+#ifdef HIPCUB_IS_INT128_ENABLED
+// std::numeric_limits is not specialized for 128-bit integers in strict ISO mode.
+template<>
+struct numeric_limits<__int128_t> : public std::numeric_limits<__int128_t>
+{
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed      = true;
+    static constexpr bool is_integer     = true;
+    static constexpr int  digits         = 127;
+
+    static constexpr __int128_t min()
+    {
+        return static_cast<__int128_t>(__uint128_t(1) << 127);
+    }
+
+    static constexpr __int128_t lowest()
+    {
+        return min();
+    }
+
+    static constexpr __int128_t max()
+    {
+        return static_cast<__int128_t>(~__uint128_t(0) >> 1);
+    }
+};
+
+template<>
+struct numeric_limits<__uint128_t> : public std::numeric_limits<__uint128_t>
+{
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed      = false;
+    static constexpr bool is_integer     = true;
+    static constexpr int  digits         = 128;
+
+    static constexpr __uint128_t min()
+    {
+        return 0;
+    }
+
+    static constexpr __uint128_t lowest()
+    {
+        return 0;
+    }
+
+    static constexpr __uint128_t max()
+    {
+        return ~__uint128_t(0);
+    }
+};
+#endif
 // End of extended numeric_limits
 
 template<class T>
@@ -129,6 +255,14 @@ using is_half = std::is_same<test_utils::half, typename std::remove_cv<T>::type>
 template<class T>
 using is_bfloat16 = std::is_same<test_utils::bfloat16, typename std::remove_cv<T>::type>;
 
+#ifdef HIPCUB_ROCPRIM_API
+template<class T>
+using is_fp8 = hipcub::detail::is_fp8<typename std::remove_cv<T>::type>;
+#else
+template<class T>
+using is_fp8 = std::false_type;
+#endif
+
 template<class T>
 using is_native_half = std::is_same<test_utils::native_half, typename std::remove_cv<T>::type>;
 
@@ -161,7 +295,7 @@ template<class T>
 struct is_special_floating_point
     : std::integral_constant<bool,
                              is_half<T>::value || is_bfloat16<T>::value || is_native_half<T>::value
-                                 || is_native_bfloat16<T>::value>
+                                 || is_native_bfloat16<T>::value || is_fp8<T>::value>
 {};
 
 template<class T>
@@ -171,11 +305,6 @@ struct is_floating_point
                                  || is_special_floating_point<T>::value>
 {};
 
-// is_integral which supports custom_test_type<U> classes
-template<class T>
-struct is_integral : std::integral_constant<bool, std::is_integral<T>::value>
-{};
-
 template<class T>
 struct is_arithmetic
     : std::integral_constant<bool, is_integral<T>::value || is_floating_point<T>::value>
@@ -253,7 +382,7 @@ struct special_values {
 
     public:
     static std::vector<T> vector(){
-        if(std::is_integral<T>::value){
+        if(test_utils::is_integral<T>::value){
             return std::vector<T>();
         }else {
             using traits          = hipcub::NumericTraits<T>;
@@ -301,54 +430,85 @@ void add_special_values(std::vector<T>& source, int seed_value)
     }
 }
 
-// std::uniform_int_distribution is undefined for anything other than
-// short, int, long, long long, unsigned short, unsigned int, unsigned long, or unsigned long long.
-// Actually causes problems with signed/unsigned char on Windows using clang.
-template <typename T>
-struct is_valid_for_int_distribution :
-    std::integral_constant<bool,
-                           std::is_same<short, T>::value ||
-                               std::is_same<unsigned short, T>::value ||
-                               std::is_same<int, T>::value ||
-                               std::is_same<unsigned int, T>::value ||
-                               std::is_same<long, T>::value ||
-                               std::is_same<unsigned long, T>::value ||
-                               std::is_same<long long, T>::value ||
-                               std::is_same<unsigned long long, T>::value
-                           > {};
+namespace detail
+{
+
+inline unsigned long long make_random_key(int seed_value)
+{
+    return counter_based_engine::mix(static_cast<unsigned long long>(seed_value));
+}
+
+/// Fills data[i] = generate(i) for all i on all hardware threads.
+template<class Container, class Generator>
+inline void parallel_generate(Container& data, Generator generate)
+{
+    parallel_for_chunks(data.size(),
+                        [&](size_t begin, size_t end)
+                        {
+                            for(size_t i = begin; i < end; i++)
+                            {
+                                data[i] = generate(i);
+                            }
+                        });
+}
+
+} // namespace detail
+
+template<class T>
+inline auto get_random_data(size_t size, T min, T max, int seed_value) ->
+    typename std::enable_if<std::is_integral<T>::value && !is_int128<T>::value,
+                            std::vector<T>>::type
+{
+    const unsigned long long key = detail::make_random_key(seed_value);
+    std::vector<T>           data(size);
+    detail::parallel_generate(data,
+                              [&](size_t i)
+                              {
+                                  detail::counter_based_engine engine(key, i);
+                                  return detail::to_integer_range(engine(), min, max);
+                              });
+    return data;
+}
 
+#ifdef HIPCUB_IS_INT128_ENABLED
 template<class T>
 inline auto get_random_data(size_t size, T min, T max, int seed_value)
-    -> typename std::enable_if<std::is_integral<T>::value, std::vector<T>>::type
+    -> typename std::enable_if<is_int128<T>::value, std::vector<T>>::type
 {
-    std::default_random_engine gen(seed_value);
-    using dis_type = typename std::conditional<
-        is_valid_for_int_distribution<T>::value,
-        T,
-        typename std::conditional<std::is_signed<T>::value,
-                                  int,
-                                  unsigned int>::type
-        >::type;
-    std::uniform_int_distribution<dis_type> distribution(static_cast<dis_type>(min), static_cast<dis_type>(max));
-    std::vector<T> data(size);
-    std::generate(data.begin(), data.end(), [&]() { return distribution(gen); });
+    const unsigned long long key = detail::make_random_key(seed_value);
+    std::vector<T>           data(size);
+    detail::parallel_generate(data,
+                              [&](size_t i)
+                              {
+                                  // Two draws per element so that the upper and lower halves
+                                  // are both random.
+                                  detail::counter_based_engine engine(key, 2 * i);
+                                  const __uint128_t            high = engine();
+                                  const __uint128_t            bits = (high << 64) | engine();
+                                  return detail::to_int128_range(bits, min, max);
+                              });
     return data;
 }
+#endif
 
 template<class T, class S, class U>
 inline auto get_random_data(size_t size, S min, U max, int seed_value)
-    -> typename std::enable_if<!std::is_integral<T>::value && !is_custom_test_type<T>::value, std::vector<T>>::type
+    -> typename std::enable_if<!test_utils::is_integral<T>::value && !is_custom_test_type<T>::value, std::vector<T>>::type
 {
-    std::default_random_engine gen(seed_value);
     using dis_type =
         typename std::conditional<test_utils::is_special_floating_point<T>::value, float, T>::type;
-    std::uniform_real_distribution<dis_type> distribution(static_cast<dis_type>(min), static_cast<dis_type>(max));
-    std::vector<T> data(size);
-    std::generate(
-        data.begin(),
-        data.end(),
-        [&]() { return static_cast<T>(distribution(gen)); }
-    );
+    const unsigned long long key     = detail::make_random_key(seed_value);
+    const dis_type           dis_min = static_cast<dis_type>(min);
+    const dis_type           dis_max = static_cast<dis_type>(max);
+    std::vector<T>           data(size);
+    detail::parallel_generate(data,
+                              [&](size_t i)
+                              {
+                                  detail::counter_based_engine engine(key, i);
+                                  const double fraction = detail::to_unit_fraction(engine());
+                                  return static_cast<T>(
+                                      static_cast<dis_type>(dis_min + (dis_max - dis_min) * fraction));
+                              });
     return data;
 }
 
@@ -361,17 +521,16 @@ inline auto get_random_data(size_t                 size,
                                 && std::is_integral<typename T::value_type>::value,
                             std::vector<T>>::type
 {
-    std::default_random_engine gen(seed_value);
-    using dis_type = typename std::conditional<
-        is_valid_for_int_distribution<typename T::value_type>::value,
-        typename T::value_type,
-        typename std::conditional<std::is_signed<typename T::value_type>::value,
-                                  int,
-                                  unsigned int>::type
-        >::type;
-    std::uniform_int_distribution<dis_type> distribution(static_cast<dis_type>(min), static_cast<dis_type>(max));
-    std::vector<T> data(size);
-    std::generate(data.begin(), data.end(), [&]() { return T(distribution(gen), distribution(gen)); });
+    const unsigned long long key = detail::make_random_key(seed_value);
+    std::vector<T>           data(size);
+    detail::parallel_generate(data,
+                              [&](size_t i)
+                              {
+                                  detail::counter_based_engine engine(key, 2 * i);
+                                  const auto x = detail::to_integer_range(engine(), min, max);
+                                  const auto y = detail::to_integer_range(engine(), min, max);
+                                  return T(x, y);
+                              });
     return data;
 }
 
@@ -384,10 +543,19 @@ inline auto get_random_data(size_t                 size,
                                 && std::is_floating_point<typename T::value_type>::value,
                             std::vector<T>>::type
 {
-    std::default_random_engine gen(seed_value);
-    std::uniform_real_distribution<typename T::value_type> distribution(min, max);
-    std::vector<T> data(size);
-    std::generate(data.begin(), data.end(), [&]() { return T(distribution(gen), distribution(gen)); });
+    using value_type             = typename T::value_type;
+    const unsigned long long key = detail::make_random_key(seed_value);
+    std::vector<T>           data(size);
+    detail::parallel_generate(data,
+                              [&](size_t i)
+                              {
+                                  detail::counter_based_engine engine(key, 2 * i);
+                                  const value_type x = static_cast<value_type>(
+                                      min + (max - min) * detail::to_unit_fraction(engine()));
+                                  const value_type y = static_cast<value_type>(
+                                      min + (max - min) * detail::to_unit_fraction(engine()));
+                                  return T(x, y);
+                              });
     return data;
 }
 
@@ -401,19 +569,32 @@ inline auto get_random_value(T min, T max, int seed_value) ->
 template<class T>
 inline std::vector<T> get_random_data01(size_t size, float p, int seed_value)
 {
-    const size_t max_random_size = 1024 * 1024;
-    std::default_random_engine gen(seed_value);
-    std::bernoulli_distribution distribution(p);
-    std::vector<T> data(size);
-    std::generate(data.begin(),
-                  data.begin() + std::min(size, max_random_size),
-                  [&]() { return convert_to_device<T>(distribution(gen)); });
-    for(size_t i = max_random_size; i < size; i += max_random_size)
+    const unsigned long long key = detail::make_random_key(seed_value);
+    std::vector<T>           data(size);
+    detail::parallel_generate(data,
+                              [&](size_t i)
+                              {
+                                  detail::counter_based_engine engine(key, i);
+                                  return convert_to_device<T>(detail::to_unit_fraction(engine()) < p);
+                              });
+    return data;
+}
+
+#ifdef HIPCUB_ROCPRIM_API
+inline std::vector<custom_radix_key> get_random_custom_radix_keys(size_t size, int seed_value)
+{
+    // Few distinct scores, so that the id decides the order of many keys
+    const std::vector<int> scores = get_random_data<int>(size, -100, 100, seed_value);
+    const std::vector<int> ids    = get_random_data<int>(size, -1000, 1000, seed_value + 1);
+
+    std::vector<custom_radix_key> keys(size);
+    for(size_t i = 0; i < size; i++)
     {
-        std::copy_n(data.begin(), std::min(size - i, max_random_size), data.begin() + i);
+        keys[i] = {scores[i] * 0.25f, ids[i]};
     }
-    return data;
+    return keys;
 }
+#endif // HIPCUB_ROCPRIM_API
 
 } // namespace test_utils
 
@@ -0,0 +1,294 @@
+// MIT License
+//
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef HIPCUB_TEST_HIPCUB_TEST_UTILS_HOST_BUFFER_HPP_
+#define HIPCUB_TEST_HIPCUB_TEST_UTILS_HOST_BUFFER_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+namespace test_utils
+{
+
+namespace detail
+{
+
+// Granularity of the work distributed over the host threads.
+constexpr size_t host_chunk_size = 64 * 1024;
+
+// Allocations of at least this size are backed by transparent huge pages where available.
+constexpr size_t huge_page_size = 2 * 1024 * 1024;
+
+inline void* allocate_host_pages(size_t bytes)
+{
+#if defined(__linux__)
+    if(bytes >= huge_page_size)
+    {
+        // Over-allocate to align the mapping to a huge page boundary, then return the excess.
+        const size_t mapped_bytes = bytes + huge_page_size;
+        void*        mapping      = mmap(nullptr,
+                             mapped_bytes,
+                             PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS,
+                             -1,
+                             0);
+        if(mapping == MAP_FAILED)
+        {
+            throw std::bad_alloc();
+        }
+        const uintptr_t begin = reinterpret_cast<uintptr_t>(mapping);
+        const uintptr_t aligned
+            = (begin + huge_page_size - 1) & ~static_cast<uintptr_t>(huge_page_size - 1);
+        const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        const size_t tail_offset
+            = (aligned - begin + bytes + page_size - 1) & ~static_cast<size_t>(page_size - 1);
+        if(aligned != begin)
+        {
+            munmap(mapping, aligned - begin);
+        }
+        if(tail_offset < mapped_bytes)
+        {
+            munmap(reinterpret_cast<void*>(begin + tail_offset), mapped_bytes - tail_offset);
+        }
+    #ifdef MADV_HUGEPAGE
+        // Only a hint, transparent huge pages may be disabled on the system.
+        madvise(reinterpret_cast<void*>(aligned), bytes, MADV_HUGEPAGE);
+    #endif
+        return reinterpret_cast<void*>(aligned);
+    }
+#endif
+    return ::operator new(bytes);
+}
+
+inline void deallocate_host_pages(void* ptr, size_t bytes) noexcept
+{
+#if defined(__linux__)
+    if(bytes >= huge_page_size)
+    {
+        munmap(ptr, bytes);
+        return;
+    }
+#endif
+    (void)bytes;
+    ::operator delete(ptr);
+}
+
+} // namespace detail
+
+/// Calls chunk_op(begin, end) for consecutive chunks of [0, size) on all hardware threads.
+/// Each thread processes its chunks in increasing order. Sizes of a single chunk run on the
+/// calling thread.
+template<class ChunkOp>
+inline void parallel_for_chunks(size_t  size,
+                                ChunkOp chunk_op,
+                                size_t  chunk_size = detail::host_chunk_size)
+{
+    const size_t num_chunks = (size + chunk_size - 1) / chunk_size;
+    const size_t num_threads
+        = std::max<size_t>(1, std::min<size_t>(std::thread::hardware_concurrency(), num_chunks));
+
+    auto worker = [&](const size_t thread_id)
+    {
+        for(size_t chunk = thread_id; chunk < num_chunks; chunk += num_threads)
+        {
+            const size_t begin = chunk * chunk_size;
+            chunk_op(begin, std::min(size, begin + chunk_size));
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for(size_t thread_id = 1; thread_id < num_threads; thread_id++)
+    {
+        threads.emplace_back(worker, thread_id);
+    }
+    worker(0);
+    for(auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+/// Allocator for large host buffers used for staging and reference results.
+/// Large allocations are aligned to and backed by huge pages (Linux only), which avoids most
+/// of the page faults when 2^30 elements are touched. Elements are default-initialized, so
+/// resizing a buffer of trivial types does not touch its pages: the pages are placed on the
+/// NUMA node of the thread that writes them first (see make_host_buffer()).
+template<class T>
+struct host_allocator
+{
+    using value_type = T;
+
+    host_allocator() = default;
+
+    template<class U>
+    host_allocator(const host_allocator<U>&) noexcept
+    {}
+
+    T* allocate(size_t n)
+    {
+        return static_cast<T*>(detail::allocate_host_pages(n * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, size_t n) noexcept
+    {
+        detail::deallocate_host_pages(ptr, n * sizeof(T));
+    }
+
+    template<class U>
+    void construct(U* ptr) noexcept(std::is_nothrow_default_constructible<U>::value)
+    {
+        ::new(static_cast<void*>(ptr)) U;
+    }
+
+    template<class U, class... Args>
+    void construct(U* ptr, Args&&... args)
+    {
+        ::new(static_cast<void*>(ptr)) U(std::forward<Args>(args)...);
+    }
+};
+
+template<class T, class U>
+inline bool operator==(const host_allocator<T>&, const host_allocator<U>&)
+{
+    return true;
+}
+
+template<class T, class U>
+inline bool operator!=(const host_allocator<T>&, const host_allocator<U>&)
+{
+    return false;
+}
+
+template<class T>
+using host_buffer = std::vector<T, host_allocator<T>>;
+
+/// Returns a buffer of size value-initialized elements, first touched in parallel.
+template<class T>
+inline host_buffer<T> make_host_buffer(size_t size)
+{
+    host_buffer<T> buffer(size);
+    parallel_for_chunks(size,
+                        [&](size_t begin, size_t end)
+                        { std::fill(buffer.begin() + begin, buffer.begin() + end, T()); });
+    return buffer;
+}
+
+/// Returns a copy of source, first touched in parallel.
+template<class Container>
+inline auto make_host_buffer(const Container& source)
+    -> host_buffer<typename Container::value_type>
+{
+    host_buffer<typename Container::value_type> buffer(source.size());
+    parallel_for_chunks(source.size(),
+                        [&](size_t begin, size_t end)
+                        {
+                            std::copy(std::next(source.begin(), begin),
+                                      std::next(source.begin(), end),
+                                      buffer.begin() + begin);
+                        });
+    return buffer;
+}
+
+/// Parallel std::stable_sort: sorts one range per hardware thread, then merges neighbouring
+/// ranges pairwise. std::inplace_merge keeps the order of equivalent elements, so the result
+/// is identical to std::stable_sort.
+template<class RandomIt, class Compare>
+inline void host_stable_sort(RandomIt first, RandomIt last, Compare compare)
+{
+    const size_t size = static_cast<size_t>(std::distance(first, last));
+    const size_t num_threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    const size_t run_size
+        = std::max(detail::host_chunk_size, (size + num_threads - 1) / num_threads);
+    const size_t num_runs = (size + run_size - 1) / run_size;
+
+    auto for_each_run = [&](size_t width, size_t count, auto run_op)
+    {
+        parallel_for_chunks(
+            count,
+            [&](size_t begin, size_t end)
+            {
+                for(size_t run = begin; run < end; run++)
+                {
+                    run_op(std::min(size, run * width), std::min(size, (run + 1) * width));
+                }
+            },
+            1);
+    };
+
+    for_each_run(run_size,
+                 num_runs,
+                 [&](size_t begin, size_t end)
+                 { std::stable_sort(first + begin, first + end, compare); });
+    for(size_t width = run_size; width < size; width *= 2)
+    {
+        for_each_run(2 * width,
+                     (size + 2 * width - 1) / (2 * width),
+                     [&](size_t begin, size_t end)
+                     {
+                         const size_t middle = std::min(end, begin + width);
+                         std::inplace_merge(first + begin, first + middle, first + end, compare);
+                     });
+    }
+}
+
+/// Returns the smallest i in [0, size) for which equal(i) is false, or size if there is none.
+/// The indices are checked in parallel, chunks past a known mismatch are skipped.
+template<class Equal>
+inline size_t find_first_mismatch(size_t size, Equal equal)
+{
+    std::atomic<size_t> first_mismatch(size);
+    parallel_for_chunks(size,
+                        [&](size_t begin, size_t end)
+                        {
+                            for(size_t i = begin;
+                                i < end && i < first_mismatch.load(std::memory_order_relaxed);
+                                i++)
+                            {
+                                if(!equal(i))
+                                {
+                                    size_t current = first_mismatch.load();
+                                    while(i < current
+                                          && !first_mismatch.compare_exchange_weak(current, i))
+                                    {}
+                                    return;
+                                }
+                            }
+                        });
+    return first_mismatch.load();
+}
+
+} // namespace test_utils
+
+#endif // HIPCUB_TEST_HIPCUB_TEST_UTILS_HOST_BUFFER_HPP_
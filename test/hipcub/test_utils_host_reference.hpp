@@ -0,0 +1,239 @@
+// MIT License
+//
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef HIPCUB_TEST_HIPCUB_TEST_UTILS_HOST_REFERENCE_HPP_
+#define HIPCUB_TEST_HIPCUB_TEST_UTILS_HOST_REFERENCE_HPP_
+
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "test_utils_host_buffer.hpp"
+
+// Expected results of heavy host reference computations (e.g. the sorts of the large radix
+// sort inputs) can be stored on disk and reused by later runs. The cache is enabled by setting
+// the HIPCUB_TEST_REFERENCE_CACHE environment variable to an existing directory (see the
+// HIPCUB_TEST_REFERENCE_CACHE CMake option). Entries are keyed by the test, the seed and a hash
+// of the inputs, so changing the input generation never reuses stale results. The directory
+// can be deleted at any time.
+
+namespace test_utils
+{
+
+// Only results of inputs at least this large are cached, smaller ones are cheaper to
+// recompute than to load.
+constexpr size_t min_cached_reference_size = 1 << 18;
+
+// Incremented when the layout of the cache files changes.
+constexpr uint64_t host_reference_version = 1;
+
+namespace detail
+{
+
+constexpr uint64_t fnv_offset_basis = 14695981039346656037ull;
+constexpr uint64_t fnv_prime        = 1099511628211ull;
+
+inline uint64_t hash_bytes(const unsigned char* bytes, size_t size, uint64_t hash)
+{
+    for(size_t i = 0; i < size; i++)
+    {
+        hash = (hash ^ bytes[i]) * fnv_prime;
+    }
+    return hash;
+}
+
+// Hashes the chunks of the buffer in parallel, then the chunk hashes in order.
+template<class Container>
+inline uint64_t hash_buffer(const Container& buffer, uint64_t hash)
+{
+    using value_type   = typename Container::value_type;
+    const size_t bytes = buffer.size() * sizeof(value_type);
+    const unsigned char* data = reinterpret_cast<const unsigned char*>(buffer.data());
+
+    std::vector<uint64_t> chunk_hashes((bytes + host_chunk_size - 1) / host_chunk_size);
+    parallel_for_chunks(bytes,
+                        [&](size_t begin, size_t end)
+                        {
+                            chunk_hashes[begin / host_chunk_size]
+                                = hash_bytes(data + begin, end - begin, fnv_offset_basis);
+                        });
+    hash = hash_bytes(reinterpret_cast<const unsigned char*>(&bytes), sizeof(bytes), hash);
+    return hash_bytes(reinterpret_cast<const unsigned char*>(chunk_hashes.data()),
+                      chunk_hashes.size() * sizeof(uint64_t),
+                      hash);
+}
+
+inline uint64_t hash_buffers(uint64_t hash)
+{
+    return hash;
+}
+
+template<class Container, class... Containers>
+inline uint64_t hash_buffers(uint64_t hash, const Container& buffer, const Containers&... buffers)
+{
+    return hash_buffers(hash_buffer(buffer, hash), buffers...);
+}
+
+inline std::string host_reference_path(const std::string& key)
+{
+    const char* directory = std::getenv("HIPCUB_TEST_REFERENCE_CACHE");
+    if(directory == nullptr || directory[0] == '\0' || key.empty())
+    {
+        return std::string();
+    }
+    return std::string(directory) + "/" + key + ".bin";
+}
+
+template<class Container>
+inline bool write_host_reference(std::FILE* file, const Container& buffer)
+{
+    const uint64_t header[2]
+        = {sizeof(typename Container::value_type), static_cast<uint64_t>(buffer.size())};
+    return std::fwrite(header, sizeof(header), 1, file) == 1
+           && std::fwrite(buffer.data(), header[0], buffer.size(), file) == buffer.size();
+}
+
+template<class Container>
+inline bool read_host_reference(std::FILE* file, Container& buffer)
+{
+    uint64_t header[2];
+    if(std::fread(header, sizeof(header), 1, file) != 1
+       || header[0] != sizeof(typename Container::value_type))
+    {
+        return false;
+    }
+    buffer.resize(static_cast<size_t>(header[1]));
+    return std::fread(buffer.data(), header[0], buffer.size(), file) == buffer.size();
+}
+
+inline bool write_host_references(std::FILE*)
+{
+    return true;
+}
+
+template<class Container, class... Containers>
+inline bool write_host_references(std::FILE* file, const Container& buffer, const Containers&... buffers)
+{
+    return write_host_reference(file, buffer) && write_host_references(file, buffers...);
+}
+
+inline bool read_host_references(std::FILE*)
+{
+    return true;
+}
+
+template<class Container, class... Containers>
+inline bool read_host_references(std::FILE* file, Container& buffer, Containers&... buffers)
+{
+    return read_host_reference(file, buffer) && read_host_references(file, buffers...);
+}
+
+} // namespace detail
+
+/// Returns the cache key of a host reference computed from the inputs by the current test,
+/// or an empty key (not cached) if the inputs are too small to be worth caching.
+/// The inputs must be contiguous containers of trivially copyable elements.
+template<class Container, class... Containers>
+inline std::string make_host_reference_key(unsigned int       seed_value,
+                                           const Container&   input,
+                                           const Containers&... inputs)
+{
+    if(input.size() < min_cached_reference_size)
+    {
+        return std::string();
+    }
+
+    const ::testing::TestInfo* test_info
+        = ::testing::UnitTest::GetInstance()->current_test_info();
+    std::string test_name = test_info == nullptr
+                                ? std::string("unknown")
+                                : std::string(test_info->test_suite_name()) + "."
+                                      + test_info->name();
+    for(char& c : test_name)
+    {
+        if(!std::isalnum(static_cast<unsigned char>(c)) && c != '.')
+        {
+            c = '_';
+        }
+    }
+
+    const uint64_t hash
+        = detail::hash_buffers(detail::hash_bytes(reinterpret_cast<const unsigned char*>(
+                                                      &host_reference_version),
+                                                  sizeof(host_reference_version),
+                                                  detail::fnv_offset_basis),
+                               input,
+                               inputs...);
+    std::ostringstream key;
+    key << test_name << "-" << seed_value << "-" << std::hex << hash;
+    return key.str();
+}
+
+/// Fills the outputs with the host reference stored under key if the cache is enabled and
+/// contains it. Otherwise calls compute(), which must fill the outputs, and stores them.
+/// The outputs must be resizable contiguous containers of trivially copyable elements.
+template<class Compute, class... Containers>
+inline void host_reference(const std::string& key, Compute compute, Containers&... outputs)
+{
+    const std::string path = detail::host_reference_path(key);
+    if(!path.empty())
+    {
+        if(std::FILE* file = std::fopen(path.c_str(), "rb"))
+        {
+            const bool loaded = detail::read_host_references(file, outputs...);
+            std::fclose(file);
+            if(loaded)
+            {
+                return;
+            }
+        }
+    }
+
+    compute();
+
+    if(!path.empty())
+    {
+        // Write to a temporary file first, concurrent shards never see partial entries.
+        std::ostringstream temporary_path;
+        temporary_path << path << "." << std::random_device{}() << ".tmp";
+        if(std::FILE* file = std::fopen(temporary_path.str().c_str(), "wb"))
+        {
+            const bool written = detail::write_host_references(file, outputs...);
+            if(std::fclose(file) == 0 && written)
+            {
+                std::rename(temporary_path.str().c_str(), path.c_str());
+            }
+            std::remove(temporary_path.str().c_str());
+        }
+    }
+}
+
+} // namespace test_utils
+
+#endif // HIPCUB_TEST_HIPCUB_TEST_UTILS_HOST_REFERENCE_HPP_
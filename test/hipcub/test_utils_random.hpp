@@ -0,0 +1,158 @@
+// MIT License
+//
+// Copyright (c) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef HIPCUB_TEST_TEST_UTILS_RANDOM_HPP_
+#define HIPCUB_TEST_TEST_UTILS_RANDOM_HPP_
+
+// Random number generation shared by the tests and the benchmarks, so that both generate
+// their data the same way.
+
+#include <hipcub/config.hpp>
+
+#include <type_traits>
+
+namespace test_utils
+{
+namespace detail
+{
+
+/// Counter-based random number generator. The n-th output of a stream is the SplitMix64
+/// finalizer applied to key + n * gamma, so any element of a sequence can be computed
+/// directly from its index, in parallel and on the device, without carrying state.
+struct counter_based_engine
+{
+    using result_type = unsigned long long;
+
+    static constexpr result_type gamma = 0x9e3779b97f4a7c15ull;
+
+    result_type key;
+    result_type counter;
+
+    HIPCUB_HOST_DEVICE counter_based_engine(result_type key, result_type counter = 0)
+        : key(key), counter(counter)
+    {}
+
+    HIPCUB_HOST_DEVICE static constexpr result_type min()
+    {
+        return 0;
+    }
+
+    HIPCUB_HOST_DEVICE static constexpr result_type max()
+    {
+        return ~result_type(0);
+    }
+
+    HIPCUB_HOST_DEVICE static result_type mix(result_type z)
+    {
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    HIPCUB_HOST_DEVICE result_type operator()()
+    {
+        return mix(key + (counter++) * gamma);
+    }
+
+    HIPCUB_HOST_DEVICE void discard(result_type n)
+    {
+        counter += n;
+    }
+};
+
+/// Maps 64 random bits to a double in [0, 1) using the upper 53 bits.
+HIPCUB_HOST_DEVICE inline double to_unit_fraction(unsigned long long bits)
+{
+    return static_cast<double>(bits >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/// Upper 64 bits of the 128-bit product a * b.
+HIPCUB_HOST_DEVICE inline unsigned long long multiply_high(unsigned long long a,
+                                                           unsigned long long b)
+{
+    const unsigned long long a_low  = a & 0xffffffffull;
+    const unsigned long long a_high = a >> 32;
+    const unsigned long long b_low  = b & 0xffffffffull;
+    const unsigned long long b_high = b >> 32;
+
+    const unsigned long long low_low   = a_low * b_low;
+    const unsigned long long high_low  = a_high * b_low;
+    const unsigned long long low_high  = a_low * b_high;
+    const unsigned long long high_high = a_high * b_high;
+
+    const unsigned long long cross = (low_low >> 32) + (high_low & 0xffffffffull) + low_high;
+    return high_high + (high_low >> 32) + (cross >> 32);
+}
+
+/// Maps 64 random bits to an offset in [0, range]. The bits are scaled by range + 1 with a
+/// multiply-high instead of a modulo, which would favor the low offsets whenever range + 1
+/// does not divide 2^64.
+HIPCUB_HOST_DEVICE inline unsigned long long to_range_offset(unsigned long long bits,
+                                                             unsigned long long range)
+{
+    return range == ~0ull ? bits : multiply_high(bits, range + 1);
+}
+
+/// Maps 64 random bits to an integer in [min, max].
+template<class T>
+HIPCUB_HOST_DEVICE inline T to_integer_range(unsigned long long bits, T min, T max)
+{
+    using unsigned_type = typename std::make_unsigned<T>::type;
+    const unsigned_type range  = static_cast<unsigned_type>(static_cast<unsigned_type>(max)
+                                                           - static_cast<unsigned_type>(min));
+    const unsigned_type offset = static_cast<unsigned_type>(to_range_offset(bits, range));
+    return static_cast<T>(static_cast<unsigned_type>(min) + offset);
+}
+
+#ifdef HIPCUB_IS_INT128_ENABLED
+/// Upper 128 bits of the 256-bit product a * b.
+HIPCUB_HOST_DEVICE inline __uint128_t multiply_high(__uint128_t a, __uint128_t b)
+{
+    const __uint128_t mask   = ~0ull;
+    const __uint128_t a_low  = a & mask;
+    const __uint128_t a_high = a >> 64;
+    const __uint128_t b_low  = b & mask;
+    const __uint128_t b_high = b >> 64;
+
+    const __uint128_t low_low   = a_low * b_low;
+    const __uint128_t high_low  = a_high * b_low;
+    const __uint128_t low_high  = a_low * b_high;
+    const __uint128_t high_high = a_high * b_high;
+
+    const __uint128_t cross = (low_low >> 64) + (high_low & mask) + low_high;
+    return high_high + (high_low >> 64) + (cross >> 64);
+}
+
+/// Maps 128 random bits to a 128-bit integer in [min, max], see \p to_range_offset.
+template<class T>
+HIPCUB_HOST_DEVICE inline T to_int128_range(__uint128_t bits, T min, T max)
+{
+    const __uint128_t range  = static_cast<__uint128_t>(max) - static_cast<__uint128_t>(min);
+    const __uint128_t offset = range == ~__uint128_t(0) ? bits : multiply_high(bits, range + 1);
+    return static_cast<T>(static_cast<__uint128_t>(min) + offset);
+}
+#endif
+
+} // namespace detail
+} // namespace test_utils
+
+#endif // HIPCUB_TEST_TEST_UTILS_RANDOM_HPP_
@@ -24,6 +24,7 @@
 #define HIPCUB_TEST_TEST_UTILS_SORT_COMPARATOR_HPP_
 
 #ifdef __HIP_PLATFORM_AMD__
+#include <rocprim/rocprim_version.hpp>
 #include <rocprim/type_traits.hpp>
 #endif
 
@@ -32,6 +33,13 @@
 
 #include <cstring>
 
+// Radix sorting 128-bit keys on the device relies on the radix key encoding of the backend,
+// rocPRIM supports it since 3.0.
+#if defined(HIPCUB_IS_INT128_ENABLED) \
+    && (defined(HIPCUB_CUB_API) || (defined(ROCPRIM_VERSION) && ROCPRIM_VERSION >= 300000))
+    #define HIPCUB_TEST_INT128_RADIX_SORT 1
+#endif
+
 namespace test_utils
 {
 